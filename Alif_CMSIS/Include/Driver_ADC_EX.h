@@ -0,0 +1,123 @@
+/* Copyright (C) 2024 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**************************************************************************//**
+ * @file     Driver_ADC_EX.h
+ * @version  V1.0.0
+ * @brief    Extension of CMSIS Driver_ADC.h
+ * @bug      None.
+ * @Note     None
+ ******************************************************************************/
+
+#ifndef DRIVER_ADC_EX_H_
+#define DRIVER_ADC_EX_H_
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#include "Driver_ADC.h"
+
+/****** ADC Control Codes *****/
+#define ARM_ADC_STREAM_SETUP              (0xA0UL)    ///< Continuous capture into a sample buffer; arg: pointer to \ref ARM_ADC_STREAM, 0 = off
+#define ARM_ADC_STREAM_RELEASE            (0xA1UL)    ///< Give a buffer half back to the driver; arg: 0 = first half, 1 = second half
+#define ARM_ADC_STREAM_GET_STATUS         (0xA2UL)    ///< Get the capture counters; arg: pointer to \ref ARM_ADC_STREAM_STATUS
+#define ARM_ADC_SCAN_SETUP                (0xA3UL)    ///< Scan a channel group, one event per scan; arg: pointer to \ref ARM_ADC_SCAN_GROUP, 0 = off
+#define ARM_ADC_CAPTURE_SETUP             (0xA4UL)    ///< Comparator triggered capture, armed; arg: pointer to \ref ARM_ADC_CAPTURE, 0 = off
+#define ARM_ADC_CAPTURE_REARM             (0xA5UL)    ///< Arm the capture again once its window is read; arg: none
+#define ARM_ADC_CAPTURE_GET_INFO          (0xA6UL)    ///< Get the captured window; arg: pointer to \ref ARM_ADC_CAPTURE_INFO
+
+/****** ADC Events *****/
+#define ARM_ADC_EVENT_STREAM_HALF         (1 << 7)    ///< First buffer half filled, owned by the application until released
+#define ARM_ADC_EVENT_STREAM_FULL         (1 << 8)    ///< Second buffer half filled, owned by the application until released
+#define ARM_ADC_EVENT_SCAN_COMPLETE       (1 << 9)    ///< Scan group vector updated; value: timestamp of the scan
+#define ARM_ADC_EVENT_CAPTURE_COMPLETE    (1 << 10)   ///< Capture window complete; value: buffer index of the trigger sample
+
+/****** ADC Stream Samples *****/
+#define ARM_ADC_STREAM_SAMPLE_CHANNEL_Pos  28
+#define ARM_ADC_STREAM_SAMPLE_VALUE_Msk    ((1UL << ARM_ADC_STREAM_SAMPLE_CHANNEL_Pos) - 1)
+#define ARM_ADC_STREAM_SAMPLE_CHANNEL(s)   ((uint32_t)(s) >> ARM_ADC_STREAM_SAMPLE_CHANNEL_Pos)   ///< Channel of a buffer entry
+#define ARM_ADC_STREAM_SAMPLE_VALUE(s)     ((uint32_t)(s) & ARM_ADC_STREAM_SAMPLE_VALUE_Msk)      ///< Sample value of a buffer entry
+
+/**
+\brief Sample buffer for \ref ARM_ADC_STREAM_SETUP.
+
+In continuous conversion mode every sample is stored in the buffer, tagged
+with its channel, from the DONE0 interrupt without a per-sample event. The
+buffer is used as two halves: \ref ARM_ADC_EVENT_STREAM_HALF and
+\ref ARM_ADC_EVENT_STREAM_FULL signal a filled half, which the application
+hands back with \ref ARM_ADC_STREAM_RELEASE. Samples that arrive while the
+next half is still with the application are dropped and counted as overruns.
+*/
+typedef struct {
+  uint32_t *data;                       ///< Sample buffer, see ARM_ADC_STREAM_SAMPLE_CHANNEL/VALUE
+  uint32_t  num;                        ///< Number of entries, even
+} ARM_ADC_STREAM;
+
+/**
+\brief Capture counters, see \ref ARM_ADC_STREAM_GET_STATUS.
+*/
+typedef struct {
+  uint32_t samples;                     ///< Samples stored since setup
+  uint32_t overruns;                    ///< Samples dropped since setup
+} ARM_ADC_STREAM_STATUS;
+
+/**
+\brief Channel group for \ref ARM_ADC_SCAN_SETUP.
+
+The ADC scans the channels of the group in ascending order, the other
+channels are masked in the sequencer. Once all of them are sampled the
+DONE1 interrupt copies the whole sample register bank into data, one entry
+per channel of the group, and signals \ref ARM_ADC_EVENT_SCAN_COMPLETE;
+the per-sample DONE0 interrupt stays masked. The vector is overwritten by
+the next scan. If timestamp is set, the counter it points to, e.g. the
+UTIMER_CNTR register of a free running UTIMER channel, is read at the same
+time and passed as the event value.
+*/
+typedef struct {
+  uint32_t                 channels;    ///< Channel mask, ARM_ADC_MASK_CHANNEL_x
+  uint32_t                *data;        ///< Sample vector, one entry per channel in the mask
+  const volatile uint32_t *timestamp;   ///< Counter read on every scan, NULL = none
+} ARM_ADC_SCAN_GROUP;
+
+/**
+\brief Triggered capture for \ref ARM_ADC_CAPTURE_SETUP.
+
+Works like the trigger of an oscilloscope. In continuous conversion mode the
+samples, tagged as with \ref ARM_ADC_STREAM, are written round the buffer
+without events until one of the comparator conditions in trigger occurs.
+Then post_trigger more samples are taken, the buffer is frozen and
+\ref ARM_ADC_EVENT_CAPTURE_COMPLETE is signaled. The window holds the
+samples before the trigger, the trigger sample and the samples after it;
+\ref ARM_ADC_CAPTURE_GET_INFO tells where it starts in the buffer.
+*/
+typedef struct {
+  uint32_t *data;                       ///< Capture buffer, see ARM_ADC_STREAM_SAMPLE_CHANNEL/VALUE
+  uint32_t  num;                        ///< Number of entries
+  uint32_t  post_trigger;               ///< Samples after the trigger sample, 1 .. num - 1
+  uint32_t  trigger;                    ///< Trigger conditions, ARM_ADC_COMPARATOR_THRESHOLD_x
+} ARM_ADC_CAPTURE;
+
+/**
+\brief Captured window, see \ref ARM_ADC_CAPTURE_GET_INFO.
+*/
+typedef struct {
+  uint32_t start;                       ///< Buffer index of the oldest sample, the window wraps at the buffer end
+  uint32_t count;                       ///< Samples in the window, less than num if triggered early
+  uint32_t trigger;                     ///< Buffer index of the trigger sample
+  uint32_t complete;                    ///< 1 if the window is complete
+} ARM_ADC_CAPTURE_INFO;
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DRIVER_ADC_EX_H_ */
@@ -38,6 +38,13 @@
 #define ARM_CAN_DISABLE_TIMESTAMP                   (16UL << ARM_CAN_CONTROL_Pos) ///< Disable CAN msg timestamp; arg: NULL
 #define ARM_CAN_GET_TX_TIMESTAMP                    (17UL << ARM_CAN_CONTROL_Pos) ///< Get CAN Tx msg timestamp; arg: Address of variable to store it
 #define ARM_CAN_GET_RX_TIMESTAMP                    (18UL << ARM_CAN_CONTROL_Pos) ///< Get CAN Rx msg timestamp; arg: Address of variable to store it
+#define ARM_CAN_SET_RX_FIFO                         (19UL << ARM_CAN_CONTROL_Pos) ///< Drain Rx buffer into a msg fifo in the IRQ; arg: Address of \ref ARM_CAN_RX_FIFO, 0 = off
+#define ARM_CAN_SET_RX_DISPATCH                     (20UL << ARM_CAN_CONTROL_Pos) ///< Hand msgs to handlers by ID; arg: Address of \ref ARM_CAN_RX_DISPATCH, 0 = off
+#define ARM_CAN_RX_FIFO_READ                        (21UL << ARM_CAN_CONTROL_Pos) ///< Read msgs from the fifo; arg: Address of \ref ARM_CAN_RX_FIFO_BATCH
+#define ARM_CAN_SET_TX_QUEUE                        (22UL << ARM_CAN_CONTROL_Pos) ///< Send through a priority ordered queue; arg: Address of \ref ARM_CAN_TX_QUEUE, 0 = off
+#define ARM_CAN_TX_QUEUE_SEND                       (23UL << ARM_CAN_CONTROL_Pos) ///< Add a frame to the Tx queue; arg: Address of \ref ARM_CAN_TX_FRAME
+#define ARM_CAN_TX_QUEUE_EXPIRE                     (24UL << ARM_CAN_CONTROL_Pos) ///< Drop expired frames, aborting the primary buf if needed; arg: NULL
+#define ARM_CAN_GET_TX_QUEUE_STATUS                 (25UL << ARM_CAN_CONTROL_Pos) ///< Get Tx queue statistics; arg: Address of \ref ARM_CAN_TX_QUEUE_STATUS
 
 /* CAN Control arguments ISO/Non-ISO modes */
 #define ARM_CAN_SPECIFICATION_NON_ISO               1U           ///< Bosch (Non-ISO) Specification
@@ -79,5 +86,116 @@
 #define ARM_CAN_EVENT_RBUF_ALMOST_FULL              (1UL << 3)   ///< Rx buffer is almost full
 #define ARM_CAN_EVENT_ARBITRATION_LOST              (1UL << 4)   ///< Arbitration lost during msg transmission
 #define ARM_CAN_EVENT_PRIMARY_TBUF_SEND_COMPLETE    (1UL << 5)   ///< Primary Tx buffer send complete
+#define ARM_CAN_EVENT_TX_EXPIRED                    (1UL << 6)   ///< Tx queue frames dropped past their deadline
+
+/* Max entries of a dispatch table */
+#define ARM_CAN_RX_DISPATCH_MAX_ENTRIES             32U
+
+/**
+\brief Received CAN message, see \ref ARM_CAN_SET_RX_FIFO.
+*/
+typedef struct _ARM_CAN_RX_MSG {
+  ARM_CAN_MSG_INFO info;                ///< Msg header, id includes ARM_CAN_ID_IDE_Msk for extended frames
+  uint32_t         timestamp;           ///< Rx timestamp, see ARM_CAN_ENABLE_TIMESTAMP
+  uint8_t          data[64];            ///< Payload, length given by info.dlc
+} ARM_CAN_RX_MSG;
+
+/**
+\brief Rx msg fifo for \ref ARM_CAN_SET_RX_FIFO.
+
+The interrupt handler moves every received msg from the Rx buffer into the
+next free msg of the fifo and signals ARM_CAN_EVENT_RECEIVE once per
+interrupt, not per msg. The application takes them out in batches with
+\ref ARM_CAN_RX_FIFO_READ. Msgs that find the fifo full are dropped and
+signaled with ARM_CAN_EVENT_RECEIVE_OVERRUN. ARM_CAN_MessageRead is not
+available while the fifo is set. Not supported in blocking mode.
+*/
+typedef struct _ARM_CAN_RX_FIFO {
+  ARM_CAN_RX_MSG *msgs;                 ///< Fifo storage
+  uint32_t        num;                  ///< Number of msgs, power of 2
+} ARM_CAN_RX_FIFO;
+
+/**
+\brief Batch read of \ref ARM_CAN_RX_FIFO_READ.
+*/
+typedef struct _ARM_CAN_RX_FIFO_BATCH {
+  ARM_CAN_RX_MSG *msgs;                 ///< Destination
+  uint32_t        num;                  ///< Max msgs to read
+  uint32_t        count;                ///< Msgs read, set by the driver
+  uint32_t        overruns;             ///< Msgs dropped since the fifo was set, set by the driver
+} ARM_CAN_RX_FIFO_BATCH;
+
+typedef void (*ARM_CAN_RX_Handler_t) (const ARM_CAN_RX_MSG *msg);  ///< Pointer to dispatch handler
+
+/**
+\brief Entry of a dispatch table, see \ref ARM_CAN_RX_DISPATCH.
+*/
+typedef struct _ARM_CAN_RX_DISPATCH_ENTRY {
+  uint32_t             id;              ///< Msg ID, ARM_CAN_STANDARD_ID or ARM_CAN_EXTENDED_ID
+  ARM_CAN_RX_Handler_t handler;         ///< Handler of the msgs with this ID
+} ARM_CAN_RX_DISPATCH_ENTRY;
+
+/**
+\brief Dispatch table for \ref ARM_CAN_SET_RX_DISPATCH, works with the Rx fifo.
+
+The driver hashes the IDs of the table. Msgs with an ID in the table are
+passed to its handler from the interrupt handler and do not enter the fifo;
+the msg is only valid during the call. IDs must be unique. The table must
+remain valid while it is set.
+*/
+typedef struct _ARM_CAN_RX_DISPATCH {
+  const ARM_CAN_RX_DISPATCH_ENTRY *entries;   ///< Table entries
+  uint32_t                         num;       ///< Number of entries, up to ARM_CAN_RX_DISPATCH_MAX_ENTRIES
+} ARM_CAN_RX_DISPATCH;
+
+/* Max frames of a Tx queue and of a secondary buf batch */
+#define ARM_CAN_TX_QUEUE_MAX_FRAMES                 32U
+#define ARM_CAN_TX_QUEUE_MAX_STB_DEPTH              4U
+
+/**
+\brief Frame to send through \ref ARM_CAN_TX_QUEUE_SEND.
+*/
+typedef struct _ARM_CAN_TX_FRAME {
+  ARM_CAN_MSG_INFO info;                ///< Msg header, as for ARM_CAN_MessageSend
+  uint32_t         deadline;            ///< Timer counter value after which the frame is dropped, 0 = none
+  uint8_t          data[64];            ///< Payload
+  uint8_t          size;                ///< Payload size, matching info.dlc
+} ARM_CAN_TX_FRAME;
+
+/**
+\brief Tx queue for \ref ARM_CAN_SET_TX_QUEUE.
+
+Frames are copied into the queue and sent in CAN arbitration order, lowest ID
+first and in order of queueing for equal IDs. The head of the queue always
+goes to the primary Tx buffer, which the controller sends ahead of the
+secondary buffer. With stb_depth set, the secondary buffer is refilled in
+priority mode with a batch of up to stb_depth further frames each time it
+runs empty, which saves interrupts on busy buses but lets a later urgent
+frame wait behind one frame of that batch. ARM_CAN_EVENT_SEND_COMPLETE is
+signaled once per Tx interrupt. ARM_CAN_MessageSend is not available while
+the queue is set.
+
+Deadlines and latencies are in ticks of the CANFD timer counter, see
+\ref ARM_CAN_CONTROL_TIMER_COUNTER. Expired frames are dropped when they
+reach a Tx buffer, or by \ref ARM_CAN_TX_QUEUE_EXPIRE, and signaled with
+ARM_CAN_EVENT_TX_EXPIRED. Frames already in the secondary buffer are sent.
+*/
+typedef struct _ARM_CAN_TX_QUEUE {
+  ARM_CAN_TX_FRAME *frames;             ///< Queue storage
+  uint32_t          num;                ///< Number of frames, up to ARM_CAN_TX_QUEUE_MAX_FRAMES
+  uint32_t          stb_depth;          ///< Frames per secondary buf batch, 0 = primary buf only
+} ARM_CAN_TX_QUEUE;
+
+/**
+\brief Tx queue statistics, see \ref ARM_CAN_GET_TX_QUEUE_STATUS.
+*/
+typedef struct _ARM_CAN_TX_QUEUE_STATUS {
+  uint32_t depth;                       ///< Frames queued or in a Tx buffer
+  uint32_t max_depth;                   ///< Highest depth since the queue was set
+  uint32_t sent;                        ///< Frames sent
+  uint32_t expired;                     ///< Frames dropped past their deadline
+  uint32_t latency_avg;                 ///< Average queueing to Tx complete time
+  uint32_t latency_max;                 ///< Longest queueing to Tx complete time
+} ARM_CAN_TX_QUEUE_STATUS;
 
 #endif /* DRIVER_CAN_EX_H_ */
@@ -29,7 +29,7 @@ extern "C"
 {
 #endif
 
-#define ARM_CDC200_API_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,0)  /* API version */
+#define ARM_CDC200_API_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,1)  /* API version */
 
 /****** CDC200 Background color blue *****/
 #define ARM_CDC200_BGC_BLUE_Pos        0UL       ///< bits 7..0
@@ -56,6 +56,8 @@ extern "C"
 #define CDC200_CONFIGURE_LAYER_WINDOW    (1U << 6)    ///< Configure Layer window
 #define CDC200_CONFIGURE_BG_COLOR        (1U << 7)    ///< Configure Background color
 #define CDC200_CONFIGURE_LAYER_BLENDING  (1U << 8)    ///< Configure Layer blending
+#define CDC200_FRAMEBUF_UPDATE_VSYNC     (1U << 9)    ///< Update layer Frame buffer at next vertical blanking
+#define CDC200_PAGE_FLIP                 (1U << 10)   ///< Queue next Frame buffer of one or both layers for vertical blanking
 
 /**
 \brief CDC200 Layer index
@@ -112,9 +114,19 @@ typedef struct _ARM_CDC200_LAYER_INFO {
   uint16_t                       num_lines;              ///< CDC200 Layer number of lines in the color FB
 } ARM_CDC200_LAYER_INFO;
 
+/**
+\brief CDC200 Page flip information
+*/
+typedef struct _ARM_CDC200_PAGE_FLIP_INFO {
+  uint32_t                       fb_addr[2];             ///< Next FB address per layer (ARM_CDC200_LAYER_1/2), 0 = keep current
+} ARM_CDC200_PAGE_FLIP_INFO;
+
 /****** CDC200 events *****/
 #define ARM_CDC_DSI_ERROR_EVENT      (1U << 0)    ///< DSI error event
 #define ARM_CDC_SCANLINE0_EVENT      (1U << 1)    ///< Scanline0 irq event
+#define ARM_CDC_FRAMEBUF_UPDATE_EVENT (1U << 2)   ///< Frame buffer update requested by CDC200_FRAMEBUF_UPDATE_VSYNC applied
+#define ARM_CDC_LAYER1_FLIP_EVENT    (1U << 3)    ///< Layer 1 switched to the next queued Frame buffer, previous one is free
+#define ARM_CDC_LAYER2_FLIP_EVENT    (1U << 4)    ///< Layer 2 switched to the next queued Frame buffer, previous one is free
 
 // Function documentation
 /**
@@ -152,6 +164,8 @@ typedef struct _ARM_CDC200_LAYER_INFO {
                  - \ref CDC200_CONFIGURE_LAYER_WINDOW :    Configure Layer window
                  - \ref CDC200_CONFIGURE_BG_COLOR :        Configure Background color
                  - \ref CDC200_CONFIGURE_LAYER_BLENDING :  Configure Layer blending
+                 - \ref CDC200_FRAMEBUF_UPDATE_VSYNC :     Update layer Frame buffer at next vertical blanking
+                 - \ref CDC200_PAGE_FLIP :                 Queue next Frame buffer of one or both layers
   \param[in]   arg Argument of operation.
                 - CDC200_CONFIGURE_DISPLAY :         Frame buffer address
                 - CDC200_FRAMEBUF_UPDATE :           Frame buffer address
@@ -165,6 +179,12 @@ typedef struct _ARM_CDC200_LAYER_INFO {
                                                        - /ref ARM_CDC200_BGC_GREEN(x)
                                                        - /ref ARM_CDC200_BGC_RED(x)
                 - CDC200_CONFIGURE_LAYER_BLENDING :  Pointer to layer info \ref ARM_CDC200_LAYER_INFO
+                - CDC200_FRAMEBUF_UPDATE_VSYNC :     Frame buffer address of layer 1, returns ARM_DRIVER_ERROR_BUSY
+                                                     while a previous update of layer 1 is not yet displayed
+                - CDC200_PAGE_FLIP :                 Pointer to page flip info \ref ARM_CDC200_PAGE_FLIP_INFO.
+                                                     All layers of one request switch at the same vertical
+                                                     blanking, requests are applied in order, one per frame.
+                                                     Returns ARM_DRIVER_ERROR_BUSY if the flip queue is full.
   \return      \ref execution_status.
 
   \fn          int32_t ARM_CDC200_GetVerticalPosition (void)
@@ -27,7 +27,7 @@ extern "C"
 
 #include "Driver_Common.h"
 
-#define ARM_CPI_API_VERSION                                        ARM_DRIVER_VERSION_MAJOR_MINOR(1,0)  /* API version */
+#define ARM_CPI_API_VERSION                                        ARM_DRIVER_VERSION_MAJOR_MINOR(1,1)  /* API version */
 
 /****** CPI Control Codes *****/
 #define CPI_SOFTRESET                                              (0x01UL) ///< CPI Software Reset; arg: 0=disable, 1=enable
@@ -35,6 +35,8 @@ extern "C"
 #define CPI_EVENTS_CONFIGURE                                       (0x03UL) ///< CAMERA EVENTS configure; arg: list of events to enable (ARM_CPI_EVENT_*)
 #define CPI_CAMERA_SENSOR_GAIN                                     (0x04UL) ///< CAMERA SENSOR gain set; arg: 0x10000 * gain, 0=read only. Returns current/updated gain if no error.
 #define CPI_CONFIGURE                                              (0x05UL) ///< CPI configure
+#define CPI_FRAME_QUEUE_CONFIGURE                                  (0x06UL) ///< CPI video frame queue configure; arg: pointer to \ref ARM_CPI_FRAME_QUEUE_CONFIG
+#define CPI_FRAME_QUEUE_DISPLAY_LINK                               (0x07UL) ///< Show completed frames on CDC200 layer 1 without copy; arg: 0=disable, 1=enable
 
 /****** CPI Events *****/
 #define ARM_CPI_EVENT_CAMERA_CAPTURE_STOPPED                       (1UL << 0) ///< Camera Capture Stopped
@@ -44,6 +46,36 @@ extern "C"
 #define ARM_CPI_EVENT_ERR_CAMERA_OUTPUT_FIFO_OVERRUN               (1UL << 4) ///< Camera FIFO under run Error
 #define ARM_CPI_EVENT_ERR_HARDWARE                                 (1UL << 5) ///< Hardware Bus Error
 #define ARM_CPI_EVENT_MIPI_CSI2_ERROR                              (1UL << 6) ///< MIPI CSI2 Error
+#define ARM_CPI_EVENT_CAMERA_FRAME_READY                           (1UL << 7) ///< Frame queue: completed frame available, see \ref GetFrame
+#define ARM_CPI_EVENT_CAMERA_FRAME_DROPPED                         (1UL << 8) ///< Frame queue: frame dropped, no free buffer available
+
+/**
+\brief CPI frame queue backpressure policy.
+*/
+typedef enum _ARM_CPI_FRAME_QUEUE_POLICY {
+  ARM_CPI_FRAME_QUEUE_DROP_NEWEST,            ///< No free buffer: drop the frame being captured, keep completed frames
+  ARM_CPI_FRAME_QUEUE_REUSE_OLDEST            ///< No free buffer: recycle the oldest completed frame not yet fetched
+} ARM_CPI_FRAME_QUEUE_POLICY;
+
+/**
+\brief CPI frame queue configuration.
+*/
+typedef struct _ARM_CPI_FRAME_QUEUE_CONFIG {
+  void                          **buffers;        ///< Array of frame buffers donated to the driver
+  uint32_t                      num_buffers;      ///< Number of frame buffers (2 to 8)
+  ARM_CPI_FRAME_QUEUE_POLICY    policy;           ///< Backpressure policy
+  uint32_t                      (*get_timestamp)(void); ///< Timestamp source sampled at frame completion (optional, may be NULL)
+} ARM_CPI_FRAME_QUEUE_CONFIG;
+
+/**
+\brief CPI completed frame information.
+*/
+typedef struct _ARM_CPI_FRAME_INFO {
+  void                          *buffer;          ///< Frame buffer holding the completed frame
+  uint32_t                      sequence;         ///< Frame sequence number, counts every captured frame
+  uint32_t                      timestamp;        ///< Value of get_timestamp() at frame completion
+  uint32_t                      dropped;          ///< Total number of frames dropped so far
+} ARM_CPI_FRAME_INFO;
 
 // Function documentation
 /**
@@ -92,6 +124,23 @@ extern "C"
   \param[in]   control : Operation
   \param[in]   arg     : Argument of operation (optional)
   \return      common \ref execution_status
+
+  \fn          int32_t CaptureVideoQueue (void)
+  \brief       Start CPI in Video mode using the buffers donated with \ref CPI_FRAME_QUEUE_CONFIGURE.
+                On every VSYNC the capture address is switched to the next free buffer and
+                the completed frame is queued, \ref ARM_CPI_EVENT_CAMERA_FRAME_READY is signalled.
+  \return      \ref execution_status
+
+  \fn          int32_t GetFrame (ARM_CPI_FRAME_INFO *frame)
+  \brief       Get the oldest completed frame from the frame queue.
+                The buffer is owned by the application until returned with \ref ReleaseFrame.
+  \param[out]  frame : Pointer to \ref ARM_CPI_FRAME_INFO
+  \return      \ref execution_status, ARM_DRIVER_ERROR_BUSY if no frame is available
+
+  \fn          int32_t ReleaseFrame (void *framebuffer)
+  \brief       Return a frame buffer obtained with \ref GetFrame to the frame queue.
+  \param[in]   framebuffer : Frame buffer to be reused for capturing
+  \return      \ref execution_status
 */
 
 typedef void (*ARM_CPI_SignalEvent_t) (uint32_t event);  ///< Pointer to \ref ARM_CPI_SignalEvent_t : Signal CPI Event.
@@ -102,7 +151,8 @@ typedef void (*ARM_CPI_SignalEvent_t) (uint32_t event);  ///< Pointer to \ref AR
 typedef struct _ARM_CPI_CAPABILITIES {
   uint32_t snapshot           : 1;        ///< Supports CPI Snapshot mode, In this mode CPI will capture one frame then it gets stop.
   uint32_t video              : 1;        ///< Supports CPI video mode
-  uint32_t reserved           : 30;       ///< Reserved (must be zero)
+  uint32_t frame_queue        : 1;        ///< Supports CPI video mode with multi-buffer frame queue
+  uint32_t reserved           : 29;       ///< Reserved (must be zero)
 } ARM_CPI_CAPABILITIES;
 
 
@@ -119,6 +169,9 @@ typedef struct _ARM_DRIVER_CPI{
   int32_t                             (*CaptureVideo)    (void *framebuffer_startaddr);                    ///< Pointer to \ref CPI_CaptureVideo    : Start CPI Interface in Video mode.
   int32_t                             (*Stop)            (void);                                           ///< Pointer to \ref CPI_Stop            : Stop  CPI Interface.
   int32_t                             (*Control)         (uint32_t control, uint32_t arg);                 ///< Pointer to \ref CPI_Control         : Control CPI Interface.
+  int32_t                             (*CaptureVideoQueue) (void);                                         ///< Pointer to \ref CPI_CaptureVideoQueue : Start CPI Interface in Video mode with frame queue.
+  int32_t                             (*GetFrame)        (ARM_CPI_FRAME_INFO *frame);                      ///< Pointer to \ref CPI_GetFrame        : Get completed frame from frame queue.
+  int32_t                             (*ReleaseFrame)    (void *framebuffer);                              ///< Pointer to \ref CPI_ReleaseFrame    : Return frame buffer to frame queue.
 } const ARM_DRIVER_CPI;
 
 #ifdef  __cplusplus
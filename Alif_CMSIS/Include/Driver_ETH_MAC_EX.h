@@ -0,0 +1,131 @@
+/* Copyright (C) 2024 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**************************************************************************//**
+ * @file     Driver_ETH_MAC_EX.h
+ * @version  V1.0.0
+ * @brief    Extension of CMSIS Driver_ETH_MAC.h
+ * @bug      None.
+ * @Note     None
+ ******************************************************************************/
+
+#ifndef DRIVER_ETH_MAC_EX_H_
+#define DRIVER_ETH_MAC_EX_H_
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#include "Driver_ETH_MAC.h"
+
+/****** ETH MAC Control Codes *****/
+#define ARM_ETH_MAC_SET_BUFFER_POOL       (0xA0UL)    ///< Zero-copy mode; arg: pointer to \ref ARM_ETH_MAC_BUFFER_POOL, 0 = copy mode
+#define ARM_ETH_MAC_RX_FRAME_TAKE         (0xA1UL)    ///< Take the received frame buffer; arg: pointer to \ref ARM_ETH_MAC_FRAME_BUFFER
+#define ARM_ETH_MAC_TX_FRAME_SEND         (0xA2UL)    ///< Send a frame from the caller buffer; arg: pointer to \ref ARM_ETH_MAC_FRAME_BUFFER
+#define ARM_ETH_MAC_RX_FRAME_STATUS       (0xA3UL)    ///< Get status of the received frame; arg: pointer to uint32_t (ARM_ETH_MAC_RX_...)
+#define ARM_ETH_MAC_SET_RX_COALESCE       (0xA4UL)    ///< Rx interrupt coalescing; arg: ARM_ETH_MAC_RX_COALESCE_FRAMES(n) | ARM_ETH_MAC_RX_COALESCE_TIMEOUT(t)
+#define ARM_ETH_MAC_RX_FRAMES_READ        (0xA5UL)    ///< Read all pending frames up to a limit; arg: pointer to \ref ARM_ETH_MAC_FRAME_BATCH
+#define ARM_ETH_MAC_GET_STATS             (0xA6UL)    ///< Get the frame and drop counters; arg: pointer to \ref ARM_ETH_MAC_STATS
+#define ARM_ETH_MAC_TX_FRAMES_SEND        (0xA7UL)    ///< Send frames from their fragments (zero-copy); arg: pointer to \ref ARM_ETH_MAC_TX_BATCH
+
+/****** ETH MAC Rx interrupt coalescing *****/
+#define ARM_ETH_MAC_RX_COALESCE_FRAMES_Pos   0
+#define ARM_ETH_MAC_RX_COALESCE_FRAMES_Msk  (0xFFUL << ARM_ETH_MAC_RX_COALESCE_FRAMES_Pos)
+#define ARM_ETH_MAC_RX_COALESCE_FRAMES(n)   (((uint32_t)(n) << ARM_ETH_MAC_RX_COALESCE_FRAMES_Pos) & ARM_ETH_MAC_RX_COALESCE_FRAMES_Msk)   ///< Frames per Rx interrupt (1 = every frame)
+#define ARM_ETH_MAC_RX_COALESCE_TIMEOUT_Pos  8
+#define ARM_ETH_MAC_RX_COALESCE_TIMEOUT_Msk (0xFFUL << ARM_ETH_MAC_RX_COALESCE_TIMEOUT_Pos)
+#define ARM_ETH_MAC_RX_COALESCE_TIMEOUT(t)  (((uint32_t)(t) << ARM_ETH_MAC_RX_COALESCE_TIMEOUT_Pos) & ARM_ETH_MAC_RX_COALESCE_TIMEOUT_Msk) ///< Rx watchdog in units of 256 AXI clock cycles (0 = keep current)
+
+/****** ETH MAC Rx frame status *****/
+#define ARM_ETH_MAC_RX_CHECKSUM_VERIFIED  (1UL << 0)  ///< IPv4 header and TCP/UDP/ICMP checksums verified by hardware
+#define ARM_ETH_MAC_RX_IP_HEADER_ERROR    (1UL << 1)  ///< IP header checksum or length error
+#define ARM_ETH_MAC_RX_PAYLOAD_ERROR      (1UL << 2)  ///< TCP/UDP/ICMP checksum error
+
+/* Size of every Rx pool buffer. Pool buffers must be aligned to the
+ * 32-byte cache line, as the driver invalidates them for the DMA. */
+#define ARM_ETH_MAC_BUFFER_SIZE           1536U
+
+/**
+\brief Application-owned buffer pool for zero-copy mode.
+
+In zero-copy mode every Rx DMA descriptor holds a buffer taken from the pool.
+\ref ARM_ETH_MAC_RX_FRAME_TAKE hands the filled buffer over to the caller and
+attaches a new one from rx_alloc. Frames sent with \ref ARM_ETH_MAC_TX_FRAME_SEND
+are transmitted straight from the caller buffer, which is passed back to
+tx_done from the ETH interrupt once the DMA has finished with it.
+The structure must remain valid while it is in use by the driver.
+*/
+typedef struct {
+  void     *context;                                     ///< Passed back to the callbacks
+  uint8_t *(*rx_alloc)   (void *context);                ///< Return an empty Rx buffer, or NULL if none is left
+  void     (*rx_free)    (void *context, uint8_t *buf);  ///< Take back an Rx buffer that was never filled
+  void     (*tx_done)    (void *context, const uint8_t *buf); ///< Tx buffer sent (called from the ETH interrupt)
+} ARM_ETH_MAC_BUFFER_POOL;
+
+/**
+\brief Frame buffer for zero-copy Rx and Tx.
+*/
+typedef struct {
+  uint8_t  *data;                       ///< Frame data
+  uint32_t  len;                        ///< Frame length in bytes
+  uint32_t  status;                     ///< Rx frame status (ARM_ETH_MAC_RX_...), unused on Tx
+} ARM_ETH_MAC_FRAME_BUFFER;
+
+/**
+\brief Frame list for \ref ARM_ETH_MAC_RX_FRAMES_READ.
+
+In copy mode data and len of every entry give the destination buffer and its
+size, and len is updated to the number of bytes copied. In zero-copy mode the
+entries are filled in as with \ref ARM_ETH_MAC_RX_FRAME_TAKE.
+*/
+typedef struct {
+  ARM_ETH_MAC_FRAME_BUFFER *frames;     ///< Frame entries
+  uint32_t                  num;        ///< In: number of entries, out: number of frames read
+} ARM_ETH_MAC_FRAME_BATCH;
+
+/**
+\brief Gather list of a frame for \ref ARM_ETH_MAC_TX_FRAMES_SEND.
+
+The fragments, e.g. the pbufs of a chain, are sent in order without being
+copied, two per Tx DMA descriptor. Once the whole frame is sent, the data of
+its first fragment is passed to tx_done; the other fragments are released
+along with it.
+*/
+typedef struct {
+  const ARM_ETH_MAC_FRAME_BUFFER *frags;  ///< Frame fragments, each up to 16383 bytes
+  uint32_t                        num_frags; ///< Number of fragments
+} ARM_ETH_MAC_TX_FRAME;
+
+/**
+\brief Frame list for \ref ARM_ETH_MAC_TX_FRAMES_SEND.
+*/
+typedef struct {
+  const ARM_ETH_MAC_TX_FRAME *frames;   ///< Frames to send
+  uint32_t                    num;      ///< In: number of frames, out: number of frames queued
+} ARM_ETH_MAC_TX_BATCH;
+
+/**
+\brief Frame and drop counters, see \ref ARM_ETH_MAC_GET_STATS.
+*/
+typedef struct {
+  uint32_t rx_frames;                   ///< Frames read from the Rx ring
+  uint32_t rx_ring_full;                ///< Times the Rx DMA ran out of descriptors
+  uint32_t rx_overflow;                 ///< Frames lost on Rx FIFO overflow
+  uint32_t rx_dropped;                  ///< Frames dropped by the Rx MTL or DMA
+  uint32_t tx_frames;                   ///< Frames handed to the Tx DMA
+  uint32_t tx_ring_full;                ///< Tx requests rejected on a full Tx ring
+} ARM_ETH_MAC_STATS;
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DRIVER_ETH_MAC_EX_H_ */
@@ -24,6 +24,9 @@ extern "C"
 /* I3C Control Codes: Bus mode */
 #define I3C_MASTER_SET_BUS_MODE                         (1UL << 0)  ///< Set bus mode to pure i3c, mixed i3c + i2c fast etc.
 #define I3C_SLAVE_SET_ADDR                              (1UL << 1)  ///< Set slave addr and initialize slave
+#define I3C_MASTER_SET_IBI                              (1UL << 2)  ///< Accept IBIs of a slave; arg: pointer to \ref ARM_I3C_IBI_CONFIG
+#define I3C_MASTER_CLEAR_IBI                            (1UL << 3)  ///< Reject IBIs of a slave again; arg: dynamic address
+#define I3C_MASTER_XFER_LIST                            (1UL << 4)  ///< Run a list of private transfers; arg: pointer to \ref ARM_I3C_XFER_LIST
 
 /* I3C Control Codes: Bus mode arguments */
 #define I3C_BUS_MODE_PURE                               (0x00UL)    ///< Pure i3c device
@@ -39,6 +42,18 @@ extern "C"
 #define ARM_I3C_EVENT_TRANSFER_ERROR                    (1UL << 1)  /* Master and slave Transmit/Receive Error  */
 #define ARM_I3C_EVENT_SLV_DYN_ADDR_ASSGN                (1UL << 2)  /* Slave Dynamic Address Assigned(only for Slave mode) */
 
+/****** I3C IBI Event *****/
+#define ARM_I3C_IBI_EVENT_SIR                           (1UL << 0)  /* Slave interrupt request, mdb and payload valid   */
+#define ARM_I3C_IBI_EVENT_READ_DONE                     (1UL << 1)  /* Follow-up private read done, data and len valid  */
+#define ARM_I3C_IBI_EVENT_READ_ERROR                    (1UL << 2)  /* Follow-up private read failed                    */
+
+#define ARM_I3C_IBI_PAYLOAD_MAX                         32          /* IBI payload bytes kept per request, incl. mdb   */
+
+/****** I3C Transfer List Status *****/
+#define ARM_I3C_XFER_OK                                 (0x00U)     /* Transfer done                                    */
+#define ARM_I3C_XFER_NOT_RUN                            (0xFFU)     /* Transfer dropped after an earlier error          */
+                                                                    /* else: response error status of the controller   */
+
 /* I3C CCC (Common Command Codes) related definitions */
 #define I3C_CCC_DIRECT                                  BIT(7)
 
@@ -90,6 +105,66 @@ typedef struct _I3C_CMD {
   uint8_t   addr;
 } I3C_CMD;
 
+/**
+\brief In-band interrupt of a slave, passed to \ref ARM_I3C_IBI_Handler_t.
+*/
+typedef struct _ARM_I3C_IBI {
+  uint8_t        addr;      ///< Dynamic address of the slave
+  uint8_t        mdb;       ///< Mandatory data byte, if the slave sends one
+  uint16_t       len;       ///< SIR: payload bytes after the mdb; READ_DONE: bytes read
+  const uint8_t *data;      ///< SIR: payload; READ_DONE: follow-up read buffer
+} ARM_I3C_IBI;
+
+typedef void (*ARM_I3C_IBI_Handler_t) (uint32_t event, const ARM_I3C_IBI *ibi);  ///< IBI handler, called from the i3c IRQ
+
+/**
+\brief IBI acceptance of a slave for \ref I3C_MASTER_SET_IBI.
+
+The slave is marked in the DAT to have its slave interrupt requests acked;
+the caller then enables them on the slave itself with the directed ENEC CCC
+(\ref I3C_CCC_ENEC, I3C_CCC_EVENT_SIR), which is not sent here. The IBI
+status queue is drained in the i3c IRQ: every request is passed to cb with
+\ref ARM_I3C_IBI_EVENT_SIR. If read_len is set, a private read of read_len
+bytes into read_buf is issued next, as soon as the bus is free, and passed
+to cb with \ref ARM_I3C_IBI_EVENT_READ_DONE; the driver is busy meanwhile.
+*/
+typedef struct _ARM_I3C_IBI_CONFIG {
+  uint8_t               addr;      ///< Dynamic address of an attached i3c slave
+  uint8_t               with_mdb;  ///< 1 if the slave sends a mandatory data byte (BCR[2])
+  uint16_t              read_len;  ///< Follow-up private read length, 0 = none (not with DMA)
+  uint8_t              *read_buf;  ///< Follow-up read buffer
+  ARM_I3C_IBI_Handler_t cb;        ///< Handler of the slave
+} ARM_I3C_IBI_CONFIG;
+
+/**
+\brief Private transfer of a \ref ARM_I3C_XFER_LIST.
+*/
+typedef struct _ARM_I3C_XFER_DESC {
+  uint8_t   addr;           ///< Dynamic address of an i3c slave, static address of an i2c slave
+  uint8_t   rnw;            ///< 1 = read, 0 = write
+  uint16_t  len;            ///< Number of bytes
+  void     *data;           ///< Data to write, buffer for the data read
+  uint16_t  actual;         ///< out: read: bytes received
+  uint8_t   status;         ///< out: ARM_I3C_XFER_OK, ARM_I3C_XFER_NOT_RUN or the error status
+} ARM_I3C_XFER_DESC;
+
+/**
+\brief Transfer list for \ref I3C_MASTER_XFER_LIST.
+
+The transfers, to one or more attached slaves, are written to the command
+queue as many at a time as the queue and the data buffers hold; within such
+a batch they follow each other with a repeated start. The next batch is
+queued from the IRQ. ARM_I3C_EVENT_TRANSFER_DONE is signaled once, after
+the last transfer; on an error the rest of the list is dropped and
+ARM_I3C_EVENT_TRANSFER_ERROR is signaled, the status of every transfer
+tells which ones ran. Not available with DMA; the list must remain valid
+until the event.
+*/
+typedef struct _ARM_I3C_XFER_LIST {
+  ARM_I3C_XFER_DESC *xfers; ///< Transfers
+  uint32_t           num;   ///< Number of transfers
+} ARM_I3C_XFER_LIST;
+
 /**
 \brief I3C Status
 */
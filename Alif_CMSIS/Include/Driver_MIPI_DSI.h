@@ -21,7 +21,7 @@
 
 #include "Driver_Common.h"
 
-#define ARM_MIPI_DSI_API_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,0)  /* API version */
+#define ARM_MIPI_DSI_API_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,1)  /* API version */
 
 /**
 \brief MIPI DSI event types
@@ -74,6 +74,11 @@
   \brief       Shutdown DSI.
   \return      \ref execution_status
 
+  \fn          int32_t  ARM_MIPI_DSI_UpdateRegion (const ARM_MIPI_DSI_REGION *region)
+  \brief       Transfer a rectangular region of the framebuffer to a command mode panel.
+  \param[in]   region  Pointer to \ref ARM_MIPI_DSI_REGION.
+  \return      \ref execution_status
+
   \fn          void ARM_MIPI_DSI_SignalEvent (uint32_t int_event)
   \brief       Signal MIPI DSI Events.
   \param[in]   int_event  \ref MIPI DSI event types.
@@ -86,8 +91,21 @@
 typedef enum _ARM_MIPI_DSI_CONTROL {
     DSI_CONFIGURE_HOST,
     DSI_CONFIGURE_DPI,
+    DSI_CONFIGURE_TEAR_EFFECT,              ///< arg: 1 = sync region updates to panel tearing effect, 0 = disable
 } ARM_MIPI_DSI_CONTROL;
 
+/**
+\brief MIPI DSI command mode partial update region.
+*/
+typedef struct _ARM_MIPI_DSI_REGION {
+    uint16_t    x;                          ///< Left column of the region
+    uint16_t    y;                          ///< Top line of the region
+    uint16_t    width;                      ///< Region width in pixels
+    uint16_t    height;                     ///< Region height in lines
+    const void  *framebuffer;               ///< Framebuffer start address, in panel pixel byte order
+    uint32_t    stride;                     ///< Framebuffer line length in bytes
+} ARM_MIPI_DSI_REGION;
+
 /**
 \brief MIPI DSI signal event.
 */
@@ -100,7 +118,8 @@ typedef struct {
     uint32_t reentrant_operation         :1;    ///< Support for reentrant calls
     uint32_t dpi_interface               :1;    ///< Support video mode Interface
     uint32_t dbi_interface               :1;    ///< Support command mode Interface
-    uint32_t reserved                    :29;   ///< Reserved (must be zero)
+    uint32_t partial_update              :1;    ///< Support command mode partial region update
+    uint32_t reserved                    :28;   ///< Reserved (must be zero)
 }ARM_MIPI_DSI_CAPABILITIES;
 
 /**
@@ -116,6 +135,7 @@ typedef struct {
     int32_t                             (*StartCommandMode)(void);                                        ///< Pointer to \ref ARM_MIPI_DSI_StartCommandMode : Configure DSI to start Command mode.
     int32_t                             (*StartVideoMode)  (void);                                        ///< Pointer to \ref ARM_MIPI_DSI_StartVideoMode : Configure DSI to start Video mode.
     int32_t                             (*Stop)            (void);                                        ///< Pointer to \ref ARM_MIPI_DSI_Stop: Shutdown DSI.
+    int32_t                             (*UpdateRegion)    (const ARM_MIPI_DSI_REGION *region);           ///< Pointer to \ref ARM_MIPI_DSI_UpdateRegion: Transfer framebuffer region in command mode.
 }ARM_DRIVER_MIPI_DSI;
 
 #endif /* DRIVER_MIPI_DSI_H_ */
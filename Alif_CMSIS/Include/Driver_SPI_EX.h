@@ -0,0 +1,68 @@
+/* Copyright (C) 2024 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**************************************************************************//**
+ * @file     Driver_SPI_EX.h
+ * @version  V1.0.0
+ * @brief    Extension of CMSIS Driver_SPI.h
+ * @bug      None.
+ * @Note     None
+ ******************************************************************************/
+
+#ifndef DRIVER_SPI_EX_H_
+#define DRIVER_SPI_EX_H_
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#include "Driver_SPI.h"
+
+/****** SPI Control Codes *****/
+#define ARM_SPI_QUEUE_TRANSFERS         (0xA0UL << ARM_SPI_CONTROL_Pos)     ///< Start a transaction queue (master only); arg: pointer to \ref ARM_SPI_TRANSFER_QUEUE
+#define ARM_SPI_GET_QUEUE_COUNT         (0xA1UL << ARM_SPI_CONTROL_Pos)     ///< Get the number of queue entries completed; arg: none
+
+/**
+\brief Entry of a SPI transaction queue.
+
+Every entry carries the settings of its slave. Settings equal to those of the
+previous entry are not written again, so runs of transfers to one slave are
+chained without reprogramming the bus.
+*/
+typedef struct {
+  const void *data_out;                 ///< Data to send, NULL to receive only (sends the default Tx value)
+  void       *data_in;                  ///< Buffer for received data, NULL to send only
+  uint32_t    num;                      ///< Number of data frames
+  uint32_t    frame_format;             ///< Clock polarity and phase: ARM_SPI_CPOLx_CPHAx
+  uint32_t    bus_speed;                ///< Bus speed in bps, 0 = keep current
+  uint8_t     data_bits;                ///< Frame size in bits (4..32), 0 = keep current
+  uint8_t     slave_select;             ///< Slave select line (0..3), used with ARM_SPI_SS_MASTER_HW_OUTPUT
+} ARM_SPI_TRANSFER_ENTRY;
+
+/**
+\brief SPI transaction queue for \ref ARM_SPI_QUEUE_TRANSFERS.
+
+The entries are run in order, each started from the completion interrupt of
+the previous one. ARM_SPI_EVENT_TRANSFER_COMPLETE is signaled once, after the
+last entry; on ARM_SPI_EVENT_DATA_LOST the rest of the queue is dropped and
+\ref ARM_SPI_GET_QUEUE_COUNT tells the failed entry. The entries must remain
+valid until the queue completes.
+*/
+typedef struct {
+  const ARM_SPI_TRANSFER_ENTRY *entries;  ///< Queue entries
+  uint32_t                      num;      ///< Number of entries
+} ARM_SPI_TRANSFER_QUEUE;
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DRIVER_SPI_EX_H_ */
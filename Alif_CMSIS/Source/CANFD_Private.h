@@ -30,6 +30,9 @@
 
 #define CANFD_MAX_OBJ_SUPPORTED  2U
 
+/* Rx dispatch hash buckets, power of 2, at least twice the max entries */
+#define CANFD_RX_DISPATCH_HASH_SIZE  (2U * ARM_CAN_RX_DISPATCH_MAX_ENTRIES)
+
 /*CANFD operational Modes */
 typedef enum _CANFD_OP_MODE
 {
@@ -61,6 +64,51 @@ typedef struct _CANFD_DRIVER_STATE
     uint32_t    reserved          :25;          /* Reserved              */
 }CANFD_DRIVER_STATE;
 
+/* CANFD Rx msg fifo */
+typedef struct _CANFD_RX_FIFO
+{
+    ARM_CAN_RX_MSG              *msgs;          /* Fifo storage, NULL when not in use     */
+    uint32_t                    num;            /* Number of msgs, power of 2             */
+    volatile uint32_t           head;           /* Msgs written, by the IRQ               */
+    volatile uint32_t           tail;           /* Msgs read, by the application          */
+    volatile uint32_t           overruns;       /* Msgs dropped with the fifo full        */
+}CANFD_RX_FIFO;
+
+/* CANFD Rx ID dispatch */
+typedef struct _CANFD_RX_DISPATCH
+{
+    const ARM_CAN_RX_DISPATCH_ENTRY *entries;                       /* Dispatch table, NULL when not in use */
+    uint8_t                     hash[CANFD_RX_DISPATCH_HASH_SIZE];  /* Entry index + 1, 0 = free bucket     */
+    ARM_CAN_RX_MSG              msg;                                /* Msg passed to the handler            */
+}CANFD_RX_DISPATCH;
+
+/* No Tx queue frame */
+#define CANFD_TX_QUEUE_NONE          0xFFU
+
+/* CANFD Tx queue */
+typedef struct _CANFD_TX_QUEUE
+{
+    ARM_CAN_TX_FRAME            *frames;                                  /* Queue storage, NULL when not in use  */
+    uint32_t                    num;                                      /* Number of frames                     */
+    uint32_t                    stb_depth;                                /* Frames per secondary buf batch       */
+    uint32_t                    seq;                                      /* Queueing order                       */
+    uint32_t                    key[ARM_CAN_TX_QUEUE_MAX_FRAMES];         /* Arbitration priority of the frames   */
+    uint32_t                    order[ARM_CAN_TX_QUEUE_MAX_FRAMES];       /* Queueing order of the frames         */
+    uint32_t                    queued_at[ARM_CAN_TX_QUEUE_MAX_FRAMES];   /* Timer counter at queueing            */
+    uint8_t                     heap[ARM_CAN_TX_QUEUE_MAX_FRAMES];        /* Waiting frames, min heap             */
+    uint8_t                     free[ARM_CAN_TX_QUEUE_MAX_FRAMES];        /* Free frames, stack                   */
+    uint8_t                     stb[ARM_CAN_TX_QUEUE_MAX_STB_DEPTH];      /* Frames in the secondary buf          */
+    uint8_t                     heap_cnt;                                 /* Waiting frames                       */
+    uint8_t                     free_cnt;                                 /* Free frames                          */
+    uint8_t                     stb_cnt;                                  /* Frames in the secondary buf          */
+    uint8_t                     ptb;                                      /* Frame in the primary buf             */
+    uint32_t                    max_depth;                                /* Statistics                           */
+    uint32_t                    sent;
+    uint32_t                    expired;
+    uint32_t                    latency_max;
+    uint64_t                    latency_sum;
+}CANFD_TX_QUEUE;
+
 /* Resource structure for CANFD */
 typedef struct _CANFD_RESOURCES
 {
@@ -79,6 +127,9 @@ typedef struct _CANFD_RESOURCES
     ARM_CAN_STATUS              status;                        /* CANFD instance status                         */
     bool                        fd_mode;                       /* CANFD Clock Control                           */
     CANFD_OBJ_STATUS            objs[CANFD_MAX_OBJ_SUPPORTED]; /* Number of objects supported */
+    CANFD_RX_FIFO               rx_fifo;                       /* Rx msg fifo                                   */
+    CANFD_RX_DISPATCH           rx_dispatch;                   /* Rx ID dispatch                                */
+    CANFD_TX_QUEUE              tx_queue;                      /* Tx priority queue                             */
 }CANFD_RESOURCES;
 
 #endif /* CANFD_PRIVATE_H_ */
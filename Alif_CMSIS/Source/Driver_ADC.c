@@ -14,6 +14,14 @@
 
 #define ARM_ADC_DRV_VERISON ARM_DRIVER_VERSION_MAJOR_MINOR(1,0) /*DRIVER VERSION*/
 
+/* Comparator events that can trigger a capture */
+#define ADC_CAPTURE_TRIGGER_Msk  (ARM_ADC_COMPARATOR_THRESHOLD_ABOVE_A     | \
+                                  ARM_ADC_COMPARATOR_THRESHOLD_ABOVE_B     | \
+                                  ARM_ADC_COMPARATOR_THRESHOLD_BELOW_A     | \
+                                  ARM_ADC_COMPARATOR_THRESHOLD_BELOW_B     | \
+                                  ARM_ADC_COMPARATOR_THRESHOLD_BETWEEN_A_B | \
+                                  ARM_ADC_COMPARATOR_THRESHOLD_OUTSIDE_A_B)
+
 /* Driver Version */
 static const ARM_DRIVER_VERSION DriverVersion ={
     ARM_ADC_API_VERSION,
@@ -41,6 +49,65 @@ static void Analog_Config(void)
     analog_config_cmp_reg2();
 }
 
+/*
+ * @func      : void ADC_Stream_Events(ADC_RESOURCES *ADC)
+ * @brief     : signal the stream buffer halves and capture windows filled
+ *              by the DONE0 interrupt
+ * @parameter : ADC : pointer to ADC_RESOURCES structure
+ * @return    : NONE
+ */
+static void ADC_Stream_Events(ADC_RESOURCES *ADC)
+{
+    conv_info_t *conv = &ADC->conv;
+
+    if (conv->status & ADC_CONV_STAT_STREAM_HALF)
+    {
+        /* clearing stream status */
+        conv->status = (conv->status & ~ADC_CONV_STAT_STREAM_HALF);
+
+        ADC->cb_event(ARM_ADC_EVENT_STREAM_HALF, 0, 0);
+    }
+
+    if (conv->status & ADC_CONV_STAT_STREAM_FULL)
+    {
+        /* clearing stream status */
+        conv->status = (conv->status & ~ADC_CONV_STAT_STREAM_FULL);
+
+        ADC->cb_event(ARM_ADC_EVENT_STREAM_FULL, 0, 1);
+    }
+
+    if (conv->status & ADC_CONV_STAT_CAPTURE_COMPLETE)
+    {
+        /* clearing capture status */
+        conv->status = (conv->status & ~ADC_CONV_STAT_CAPTURE_COMPLETE);
+
+        ADC->cb_event(ARM_ADC_EVENT_CAPTURE_COMPLETE, 0, conv->capture->trigger_idx);
+    }
+}
+
+/*
+ * @func      : void ADC_Scan_Events(ADC_RESOURCES *ADC)
+ * @brief     : signal the scan group vector updated by the DONE1 interrupt
+ * @parameter : ADC : pointer to ADC_RESOURCES structure
+ * @return    : NONE
+ */
+static void ADC_Scan_Events(ADC_RESOURCES *ADC)
+{
+    conv_info_t *conv = &ADC->conv;
+
+    if (conv->status & ADC_CONV_STAT_SCAN_COMPLETE)
+    {
+        /* a single shot scan is over */
+        if (conv->mode == ADC_CONV_MODE_SINGLE_SHOT)
+            ADC->busy = 0U;
+
+        /* clearing scan status */
+        conv->status = (conv->status & ~ADC_CONV_STAT_SCAN_COMPLETE);
+
+        ADC->cb_event(ARM_ADC_EVENT_SCAN_COMPLETE, 0, conv->scan->timestamp);
+    }
+}
+
 /*
  * @func           : int32_t ADC_Initialize(ADC_RESOURCES *ADC, ARM_ADC_SignalEvent_t cb_event)
  * @brief          : initialize the device
@@ -90,6 +157,11 @@ static int32_t ADC_Uninitialize(ADC_RESOURCES *ADC)
     /* Reset last read channel */
     ADC->conv.read_channel = 0;
 
+    /* Drop the stream buffer, scan group and capture */
+    ADC->conv.stream  = NULL;
+    ADC->conv.scan    = NULL;
+    ADC->conv.capture = NULL;
+
     /* flags */
     ADC->state = 0;
 
@@ -300,6 +372,10 @@ static int32_t ADC_Start( ADC_RESOURCES *ADC)
     /* enable the interrupt(unmask the interrupt 0x0)*/
     adc_unmask_interrupt(ADC->regs);
 
+    /* one interrupt per scan, from DONE1 */
+    if (ADC->conv.scan)
+        adc_mask_done0_interrupt(ADC->regs);
+
     if (ADC->ext_trig_val)
     {
         /* Enable the trigger */
@@ -357,6 +433,9 @@ static int32_t ADC_Stop(ADC_RESOURCES *ADC)
         }
     }
 
+    /* a stream runs until stopped */
+    ADC->busy = 0U;
+
     return ARM_DRIVER_OK;
 }
 
@@ -381,6 +460,12 @@ static int32_t ADC_Stop(ADC_RESOURCES *ADC)
 static int32_t ADC_Control(ADC_RESOURCES *ADC, uint32_t Control, uint32_t arg)
 {
     int ret = ARM_DRIVER_OK;
+    ARM_ADC_STREAM        *stream;
+    ARM_ADC_STREAM_STATUS *stream_status;
+    ARM_ADC_SCAN_GROUP    *group;
+    ARM_ADC_CAPTURE       *capture;
+    ARM_ADC_CAPTURE_INFO  *capture_info;
+    uint32_t              first;
 
     /* Check Power done or not */
     if (!(ADC->state & ADC_FLAG_DRV_POWER_DONE))
@@ -483,6 +568,10 @@ static int32_t ADC_Control(ADC_RESOURCES *ADC, uint32_t Control, uint32_t arg)
             if(!(arg == 0 || arg == 1))
                 return ARM_DRIVER_ERROR_PARAMETER;
 
+            /* streaming and capture need continuous conversion */
+            if (arg && (ADC->conv.stream || ADC->conv.capture))
+                return ARM_DRIVER_ERROR;
+
             /* set conversion mode */
             if (arg)
             {
@@ -600,6 +689,140 @@ static int32_t ADC_Control(ADC_RESOURCES *ADC, uint32_t Control, uint32_t arg)
             set_adc24_output_rate(arg);
         break;
 
+        case ARM_ADC_STREAM_SETUP:
+
+            if (ADC->busy)
+                return ARM_DRIVER_ERROR_BUSY;
+
+            if (!arg)
+            {
+                /* back to an event per sample */
+                ADC->conv.stream = NULL;
+                break;
+            }
+
+            stream = (ARM_ADC_STREAM *)arg;
+
+            if (!stream->data || (stream->num < 2) || (stream->num & 1))
+                return ARM_DRIVER_ERROR_PARAMETER;
+
+            if ((ADC->conv.mode != ADC_CONV_MODE_CONTINUOUS) || ADC->conv.scan || ADC->conv.capture)
+                return ARM_DRIVER_ERROR;
+
+            adc_stream_init(&ADC->stream, stream->data, stream->num);
+            ADC->conv.stream = &ADC->stream;
+        break;
+
+        case ARM_ADC_STREAM_RELEASE:
+
+            if (!ADC->conv.stream || (arg > 1))
+                return ARM_DRIVER_ERROR_PARAMETER;
+
+            adc_stream_release(ADC->conv.stream, arg);
+        break;
+
+        case ARM_ADC_STREAM_GET_STATUS:
+
+            if (!ADC->conv.stream || !arg)
+                return ARM_DRIVER_ERROR_PARAMETER;
+
+            stream_status = (ARM_ADC_STREAM_STATUS *)arg;
+            stream_status->samples  = ADC->conv.stream->samples;
+            stream_status->overruns = ADC->conv.stream->overruns;
+        break;
+
+        case ARM_ADC_SCAN_SETUP:
+
+            if (ADC->busy)
+                return ARM_DRIVER_ERROR_BUSY;
+
+            if (!arg)
+            {
+                /* back to an event per sample */
+                ADC->conv.scan = NULL;
+                break;
+            }
+
+            group = (ARM_ADC_SCAN_GROUP *)arg;
+
+            if (!group->data || !group->channels || (group->channels & ~ADC_MSK_ALL_CHANNELS))
+                return ARM_DRIVER_ERROR_PARAMETER;
+
+            if (ADC->conv.stream || ADC->conv.capture)
+                return ARM_DRIVER_ERROR;
+
+            ADC->scan.channels      = group->channels;
+            ADC->scan.values        = group->data;
+            ADC->scan.timestamp_src = group->timestamp;
+            ADC->scan.timestamp     = 0;
+            ADC->scan.count         = 0;
+
+            /* mask the channels out of the group, rotate from the first one */
+            first = __builtin_ctz(group->channels);
+
+            adc_sequencer_msk_ch_control(ADC->regs, ~group->channels & ADC_MSK_ALL_CHANNELS);
+            adc_init_channel_select(ADC->regs, first);
+            adc_set_multi_ch_scan_mode(ADC->regs, &ADC->conv);
+
+            ADC->conv.read_channel = first;
+            ADC->conv.scan         = &ADC->scan;
+        break;
+
+        case ARM_ADC_CAPTURE_SETUP:
+
+            if (ADC->busy)
+                return ARM_DRIVER_ERROR_BUSY;
+
+            if (!arg)
+            {
+                /* back to an event per sample */
+                ADC->conv.capture = NULL;
+                break;
+            }
+
+            capture = (ARM_ADC_CAPTURE *)arg;
+
+            if (!capture->data || (capture->num < 2) ||
+                !capture->post_trigger || (capture->post_trigger >= capture->num) ||
+                !capture->trigger || (capture->trigger & ~ADC_CAPTURE_TRIGGER_Msk))
+                return ARM_DRIVER_ERROR_PARAMETER;
+
+            if ((ADC->conv.mode != ADC_CONV_MODE_CONTINUOUS) || ADC->conv.stream || ADC->conv.scan)
+                return ARM_DRIVER_ERROR;
+
+            ADC->capture.buf          = capture->data;
+            ADC->capture.num          = capture->num;
+            ADC->capture.post         = capture->post_trigger;
+            ADC->capture.trigger_mask = capture->trigger;   /* same bits as ADC_CONV_STAT_CMP_THLD_x */
+
+            adc_capture_arm(&ADC->capture);
+            ADC->conv.capture = &ADC->capture;
+        break;
+
+        case ARM_ADC_CAPTURE_REARM:
+
+            if (!ADC->conv.capture)
+                return ARM_DRIVER_ERROR;
+
+            /* only a complete window can be discarded */
+            if (ADC->conv.capture->state != ADC_CAPTURE_STATE_DONE)
+                return ARM_DRIVER_ERROR_BUSY;
+
+            adc_capture_arm(ADC->conv.capture);
+        break;
+
+        case ARM_ADC_CAPTURE_GET_INFO:
+
+            if (!ADC->conv.capture || !arg)
+                return ARM_DRIVER_ERROR_PARAMETER;
+
+            capture_info = (ARM_ADC_CAPTURE_INFO *)arg;
+            capture_info->count    = ADC->conv.capture->filled;
+            capture_info->start    = (capture_info->count < ADC->conv.capture->num) ? 0 : ADC->conv.capture->idx;
+            capture_info->trigger  = ADC->conv.capture->trigger_idx;
+            capture_info->complete = (ADC->conv.capture->state == ADC_CAPTURE_STATE_DONE);
+        break;
+
         default:
             return ARM_DRIVER_ERROR_PARAMETER;
     }
@@ -648,6 +871,8 @@ void ADC120_DONE0_IRQHandler(void)
 
   adc_done0_irq_handler(ADC120_RES.regs, conv);
 
+  ADC_Stream_Events(&ADC120_RES);
+
   if (conv->status & ADC_CONV_STAT_COMPLETE)
   {
       /* set busy flag to 0U */
@@ -672,6 +897,8 @@ void ADC120_DONE1_IRQHandler (void)
 
     adc_done1_irq_handler(ADC120_RES.regs, conv);
 
+    ADC_Scan_Events(&ADC120_RES);
+
     if (conv->status & ADC_CONV_STAT_COMPLETE)
     {
         /* set busy flag to 0U */
@@ -898,6 +1125,8 @@ void ADC121_DONE0_IRQHandler(void)
 
   adc_done0_irq_handler(ADC121_RES.regs, conv);
 
+  ADC_Stream_Events(&ADC121_RES);
+
   if (conv->status & ADC_CONV_STAT_COMPLETE)
   {
       /* set busy flag to 0U */
@@ -922,6 +1151,8 @@ void ADC121_DONE1_IRQHandler (void)
 
     adc_done1_irq_handler(ADC121_RES.regs, conv);
 
+    ADC_Scan_Events(&ADC121_RES);
+
     if (conv->status & ADC_CONV_STAT_COMPLETE)
     {
         /* set busy flag to 0U */
@@ -1148,6 +1379,8 @@ void ADC122_DONE0_IRQHandler(void)
 
   adc_done0_irq_handler(ADC122_RES.regs, conv);
 
+  ADC_Stream_Events(&ADC122_RES);
+
   if (conv->status & ADC_CONV_STAT_COMPLETE)
   {
       /* set busy flag to 0U */
@@ -1172,6 +1405,8 @@ void ADC122_DONE1_IRQHandler (void)
 
     adc_done1_irq_handler(ADC122_RES.regs, conv);
 
+    ADC_Scan_Events(&ADC122_RES);
+
     if (conv->status & ADC_CONV_STAT_COMPLETE)
     {
         /* set busy flag to 0U */
@@ -1396,6 +1631,8 @@ void ADC24_DONE0_IRQHandler(void)
 
   adc_done0_irq_handler(ADC24_RES.regs, conv);
 
+  ADC_Stream_Events(&ADC24_RES);
+
   if (conv->status & ADC_CONV_STAT_COMPLETE)
   {
       /* set busy flag to 0U */
@@ -1420,6 +1657,8 @@ void ADC24_DONE1_IRQHandler (void)
 
     adc_done1_irq_handler(ADC24_RES.regs, conv);
 
+    ADC_Scan_Events(&ADC24_RES);
+
     if (conv->status & ADC_CONV_STAT_COMPLETE)
     {
         /* set busy flag to 0U */
@@ -16,6 +16,7 @@
 #include CMSIS_device_header
 
 #include "Driver_ADC.h"
+#include "Driver_ADC_EX.h"
 #include "adc.h"
 #include "sys_ctrl_adc.h"
 
@@ -30,6 +31,9 @@ typedef struct _ADC_RESOURCES
     ARM_ADC_SignalEvent_t   cb_event;                  /* ADC APPLICATION CALLBACK EVENT                       */
     ADC_Type                *regs;                     /* ADC register base address                            */
     conv_info_t             conv;                      /* ADC conversion information                           */
+    adc_stream_t            stream;                    /* ADC continuous capture buffer                        */
+    adc_scan_t              scan;                      /* ADC scan group                                       */
+    adc_capture_t           capture;                   /* ADC triggered capture                                */
     ADC_INSTANCE            drv_instance;              /* ADC Driver instances                                 */
     IRQn_Type               intr_done0_irq_num;        /* ADC avg sample ready interrupt number                */
     IRQn_Type               intr_done1_irq_num;        /* ADC all sample taken interrupt number                */
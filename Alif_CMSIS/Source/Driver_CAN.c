@@ -411,6 +411,11 @@ static int32_t ARM_CAN_Uninitialize(CANFD_RESOURCES* CANFD)
     CANFD->data_transfer.tx_ptr      = NULL;
     CANFD->data_transfer.rx_ptr      = NULL;
 
+    /* Drop the Rx fifo, the dispatch table and the Tx queue */
+    CANFD->rx_fifo.msgs              = NULL;
+    CANFD->rx_dispatch.entries       = NULL;
+    CANFD->tx_queue.frames           = NULL;
+
     CANFD->op_mode                   = CANFD_OP_MODE_NONE;
 
     /* Unload Callback functions */
@@ -984,6 +989,12 @@ static int32_t ARM_CAN_MessageSend(CANFD_RESOURCES* CANFD, uint32_t obj_idx,
         return ARM_DRIVER_ERROR_PARAMETER;
     }
 
+    /* The Tx buffers are fed by the Tx queue */
+    if(CANFD->tx_queue.frames != NULL)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
     /* If the node is in other than below modes, returns an error */
     if((CANFD->op_mode != CANFD_OP_MODE_NORMAL)               &&
        (CANFD->op_mode != CANFD_OP_MODE_LOOPBACK_EXTERNAL)    &&
@@ -1127,6 +1138,12 @@ static int32_t ARM_CAN_MessageRead(CANFD_RESOURCES* CANFD, uint32_t obj_idx,
         return ARM_DRIVER_ERROR_PARAMETER;
     }
 
+    /* The Rx buffer is drained by the IRQ into the fifo */
+    if(CANFD->rx_fifo.msgs != NULL)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
     /* Check if Message read is busy */
     if(CANFD->state.rx_busy == true)
     {
@@ -1174,6 +1191,806 @@ static int32_t ARM_CAN_MessageRead(CANFD_RESOURCES* CANFD, uint32_t obj_idx,
     return ARM_DRIVER_OK;
 }
 
+/**
+ * @fn      uint32_t CANFD_RxDispatchHash(uint32_t id)
+ * @brief   Hashes a msg ID to a dispatch bucket.
+ * @note    none.
+ * @param   id : Msg ID, with ARM_CAN_ID_IDE_Msk for extended frames
+ * @return  bucket index
+ */
+static inline uint32_t CANFD_RxDispatchHash(uint32_t id)
+{
+    id ^= (id >> 16U);
+    id *= 0x45D9F3BU;
+    id ^= (id >> 16U);
+
+    return (id & (CANFD_RX_DISPATCH_HASH_SIZE - 1U));
+}
+
+/**
+ * @fn      const ARM_CAN_RX_DISPATCH_ENTRY* CANFD_RxDispatchLookup(
+ *                                              const CANFD_RX_DISPATCH *dispatch,
+ *                                              uint32_t id)
+ * @brief   Finds the dispatch entry of a msg ID.
+ * @note    The table is at most half full, so the probe ends at a free bucket.
+ * @param   dispatch : Pointer to the dispatch info
+ * @param   id       : Msg ID, with ARM_CAN_ID_IDE_Msk for extended frames
+ * @return  dispatch entry, NULL if the ID has no handler
+ */
+static const ARM_CAN_RX_DISPATCH_ENTRY* CANFD_RxDispatchLookup(
+                                           const CANFD_RX_DISPATCH *dispatch,
+                                           uint32_t id)
+{
+    const ARM_CAN_RX_DISPATCH_ENTRY *entries = dispatch->entries;
+    uint32_t bucket                          = CANFD_RxDispatchHash(id);
+
+    if(entries == NULL)
+    {
+        return NULL;
+    }
+
+    while(dispatch->hash[bucket])
+    {
+        if(entries[dispatch->hash[bucket] - 1U].id == id)
+        {
+            return &entries[dispatch->hash[bucket] - 1U];
+        }
+        bucket = ((bucket + 1U) & (CANFD_RX_DISPATCH_HASH_SIZE - 1U));
+    }
+    return NULL;
+}
+
+/**
+ * @fn      int32_t CANFD_RxDispatchSetup(CANFD_RESOURCES* CANFD,
+ *                                        const ARM_CAN_RX_DISPATCH *table)
+ * @brief   Builds the hash of a dispatch table.
+ * @note    The table is detached while it is hashed, msgs received
+ *          meanwhile go to the fifo.
+ * @param   CANFD  : Pointer to canfd resources structure.
+ * @param   table  : Dispatch table, NULL to stop dispatching
+ * @return  \ref execution_status
+ */
+static int32_t CANFD_RxDispatchSetup(CANFD_RESOURCES* CANFD,
+                                     const ARM_CAN_RX_DISPATCH *table)
+{
+    CANFD_RX_DISPATCH *dispatch = &CANFD->rx_dispatch;
+    uint32_t iter               = 0U;
+    uint32_t bucket             = 0U;
+
+    dispatch->entries = NULL;
+
+    if(table == NULL)
+    {
+        return ARM_DRIVER_OK;
+    }
+
+    if((table->entries == NULL) || (table->num == 0U) ||
+       (table->num > ARM_CAN_RX_DISPATCH_MAX_ENTRIES))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    memset(dispatch->hash, 0, sizeof(dispatch->hash));
+
+    for(iter = 0U; iter < table->num; iter++)
+    {
+        if(table->entries[iter].handler == NULL)
+        {
+            return ARM_DRIVER_ERROR_PARAMETER;
+        }
+
+        bucket = CANFD_RxDispatchHash(table->entries[iter].id);
+        while(dispatch->hash[bucket])
+        {
+            /* IDs must be unique */
+            if(table->entries[dispatch->hash[bucket] - 1U].id ==
+               table->entries[iter].id)
+            {
+                return ARM_DRIVER_ERROR_PARAMETER;
+            }
+            bucket = ((bucket + 1U) & (CANFD_RX_DISPATCH_HASH_SIZE - 1U));
+        }
+        dispatch->hash[bucket] = (uint8_t)(iter + 1U);
+    }
+
+    dispatch->entries = table->entries;
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn      uint32_t CANFD_RxFifoDrain(CANFD_RESOURCES* CANFD)
+ * @brief   Moves all msgs of the Rx buffer into the fifo, or to their
+ *          dispatch handler.
+ * @note    Called from the IRQ handler.
+ * @param   CANFD  : Pointer to canfd resources structure.
+ * @return  ARM_CAN_EVENT_RECEIVE and ARM_CAN_EVENT_RECEIVE_OVERRUN to signal
+ */
+static uint32_t CANFD_RxFifoDrain(CANFD_RESOURCES* CANFD)
+{
+    CANFD_RX_FIFO *fifo                    = &CANFD->rx_fifo;
+    const ARM_CAN_RX_DISPATCH_ENTRY *entry = NULL;
+    ARM_CAN_RX_MSG *msg                    = NULL;
+    canfd_rx_info_t rx_header;
+    uint32_t head                          = fifo->head;
+    uint32_t id                            = 0U;
+    uint32_t event                         = 0U;
+
+    while(canfd_rx_msg_available(CANFD->regs))
+    {
+        canfd_get_rx_header(CANFD->regs, &rx_header);
+
+        id    = (rx_header.id | (rx_header.frame_type << ARM_CAN_ID_IDE_Pos));
+        entry = CANFD_RxDispatchLookup(&CANFD->rx_dispatch, id);
+
+        if(entry != NULL)
+        {
+            msg = &CANFD->rx_dispatch.msg;
+        }
+        else if((head - fifo->tail) < fifo->num)
+        {
+            msg = &fifo->msgs[head & (fifo->num - 1U)];
+        }
+        else
+        {
+            /* Fifo is full, drops the msg */
+            canfd_read_rx_data(CANFD->regs, NULL, 0U);
+            fifo->overruns++;
+            event |= ARM_CAN_EVENT_RECEIVE_OVERRUN;
+            continue;
+        }
+
+        canfd_read_rx_data(CANFD->regs, (uint32_t*)msg->data,
+                           (rx_header.rtr ? 0U :
+                            canfd_dlc_to_payload_map[rx_header.dlc]));
+
+        msg->info.id   = id;
+        msg->info.rtr  = rx_header.rtr;
+        msg->info.edl  = rx_header.edl;
+        msg->info.brs  = rx_header.brs;
+        msg->info.esi  = rx_header.esi;
+        msg->info.dlc  = rx_header.dlc;
+        msg->timestamp = rx_header.timestamp[0U];
+
+        if(entry != NULL)
+        {
+            entry->handler(msg);
+        }
+        else
+        {
+            head++;
+            event |= ARM_CAN_EVENT_RECEIVE;
+        }
+    }
+
+    fifo->head = head;
+
+    return event;
+}
+
+/**
+ * @fn      uint32_t CANFD_RxFifoRead(CANFD_RESOURCES* CANFD,
+ *                                    ARM_CAN_RX_MSG *msgs,
+ *                                    uint32_t num)
+ * @brief   Copies msgs out of the Rx fifo.
+ * @note    none.
+ * @param   CANFD  : Pointer to canfd resources structure.
+ * @param   msgs   : Destination
+ * @param   num    : Max msgs to read
+ * @return  Msgs read
+ */
+static uint32_t CANFD_RxFifoRead(CANFD_RESOURCES* CANFD,
+                                 ARM_CAN_RX_MSG *msgs,
+                                 uint32_t num)
+{
+    CANFD_RX_FIFO *fifo = &CANFD->rx_fifo;
+    uint32_t tail       = fifo->tail;
+    uint32_t count      = (fifo->head - tail);
+    uint32_t iter       = 0U;
+
+    if(count > num)
+    {
+        count = num;
+    }
+
+    for(iter = 0U; iter < count; iter++)
+    {
+        memcpy(&msgs[iter], &fifo->msgs[(tail + iter) & (fifo->num - 1U)],
+               sizeof(ARM_CAN_RX_MSG));
+    }
+
+    /* Hands the slots back to the IRQ */
+    fifo->tail = (tail + count);
+
+    return count;
+}
+
+/**
+ * @fn      uint32_t CANFD_TxPriorityKey(uint32_t id)
+ * @brief   Maps a msg ID to its bus arbitration priority.
+ * @note    Base ID first; an extended frame loses against a standard
+ *          frame with the same base ID.
+ * @param   id : Msg ID, with ARM_CAN_ID_IDE_Msk for extended frames
+ * @return  Priority key, lower is sent first
+ */
+static inline uint32_t CANFD_TxPriorityKey(uint32_t id)
+{
+    if(id & ARM_CAN_ID_IDE_Msk)
+    {
+        id = ARM_CAN_OBJECT_ID(id);
+        return (((id >> 18U) << 19U) | (1U << 18U) | (id & 0x3FFFFU));
+    }
+    return (ARM_CAN_STANDARD_ID(id) << 19U);
+}
+
+/**
+ * @fn      bool CANFD_TxExpired(const ARM_CAN_TX_FRAME *frame, uint32_t now)
+ * @brief   Checks the deadline of a frame.
+ * @note    none.
+ * @param   frame : Tx frame
+ * @param   now   : Timer counter value
+ * @return  true if the frame is past its deadline
+ */
+static inline bool CANFD_TxExpired(const ARM_CAN_TX_FRAME *frame, uint32_t now)
+{
+    return ((frame->deadline != 0U) &&
+            ((int32_t)(now - frame->deadline) >= 0));
+}
+
+/**
+ * @fn      bool CANFD_TxHeapBefore(const CANFD_TX_QUEUE *queue,
+ *                                  uint8_t a, uint8_t b)
+ * @brief   Orders two queued frames.
+ * @note    none.
+ * @param   queue : Pointer to the Tx queue
+ * @param   a     : frame
+ * @param   b     : frame
+ * @return  true if frame a is sent before frame b
+ */
+static inline bool CANFD_TxHeapBefore(const CANFD_TX_QUEUE *queue,
+                                      uint8_t a, uint8_t b)
+{
+    if(queue->key[a] != queue->key[b])
+    {
+        return (queue->key[a] < queue->key[b]);
+    }
+    return ((int32_t)(queue->order[a] - queue->order[b]) < 0);
+}
+
+/**
+ * @fn      void CANFD_TxHeapSift(CANFD_TX_QUEUE *queue, uint32_t pos)
+ * @brief   Moves the frame at pos down the heap to its place.
+ * @note    none.
+ * @param   queue : Pointer to the Tx queue
+ * @param   pos   : heap position
+ * @return  none
+ */
+static void CANFD_TxHeapSift(CANFD_TX_QUEUE *queue, uint32_t pos)
+{
+    uint8_t  frame = queue->heap[pos];
+    uint32_t child = 0U;
+
+    while((child = ((2U * pos) + 1U)) < queue->heap_cnt)
+    {
+        if(((child + 1U) < queue->heap_cnt) &&
+           CANFD_TxHeapBefore(queue, queue->heap[child + 1U], queue->heap[child]))
+        {
+            child++;
+        }
+        if(!CANFD_TxHeapBefore(queue, queue->heap[child], frame))
+        {
+            break;
+        }
+        queue->heap[pos] = queue->heap[child];
+        pos              = child;
+    }
+    queue->heap[pos] = frame;
+}
+
+/**
+ * @fn      void CANFD_TxHeapPush(CANFD_TX_QUEUE *queue, uint8_t frame)
+ * @brief   Adds a frame to the heap.
+ * @note    none.
+ * @param   queue : Pointer to the Tx queue
+ * @param   frame : frame
+ * @return  none
+ */
+static void CANFD_TxHeapPush(CANFD_TX_QUEUE *queue, uint8_t frame)
+{
+    uint32_t pos    = queue->heap_cnt++;
+    uint32_t parent = 0U;
+
+    while(pos)
+    {
+        parent = ((pos - 1U) / 2U);
+        if(!CANFD_TxHeapBefore(queue, frame, queue->heap[parent]))
+        {
+            break;
+        }
+        queue->heap[pos] = queue->heap[parent];
+        pos              = parent;
+    }
+    queue->heap[pos] = frame;
+}
+
+/**
+ * @fn      void CANFD_TxHeapPop(CANFD_TX_QUEUE *queue)
+ * @brief   Removes the head frame from the heap.
+ * @note    none.
+ * @param   queue : Pointer to the Tx queue
+ * @return  none
+ */
+static void CANFD_TxHeapPop(CANFD_TX_QUEUE *queue)
+{
+    queue->heap[0U] = queue->heap[--queue->heap_cnt];
+    if(queue->heap_cnt)
+    {
+        CANFD_TxHeapSift(queue, 0U);
+    }
+}
+
+/**
+ * @fn      uint8_t CANFD_TxQueuePeek(CANFD_TX_QUEUE *queue, uint32_t now,
+ *                                    uint32_t *event)
+ * @brief   Returns the next frame to send, left on the heap, dropping
+ *          the expired ones on the way.
+ * @note    none.
+ * @param   queue : Pointer to the Tx queue
+ * @param   now   : Timer counter value
+ * @param   event : ARM_CAN_EVENT_TX_EXPIRED is added if frames were dropped
+ * @return  frame, CANFD_TX_QUEUE_NONE if none is waiting
+ */
+static uint8_t CANFD_TxQueuePeek(CANFD_TX_QUEUE *queue, uint32_t now,
+                                 uint32_t *event)
+{
+    uint8_t frame = CANFD_TX_QUEUE_NONE;
+
+    while(queue->heap_cnt)
+    {
+        frame = queue->heap[0U];
+        if(!CANFD_TxExpired(&queue->frames[frame], now))
+        {
+            return frame;
+        }
+
+        CANFD_TxHeapPop(queue);
+        queue->free[queue->free_cnt++] = frame;
+        queue->expired++;
+        *event |= ARM_CAN_EVENT_TX_EXPIRED;
+    }
+    return CANFD_TX_QUEUE_NONE;
+}
+
+/**
+ * @fn      uint8_t CANFD_TxQueueNext(CANFD_TX_QUEUE *queue, uint32_t now,
+ *                                    uint32_t *event)
+ * @brief   Takes the next frame to send off the heap, dropping the
+ *          expired ones on the way.
+ * @note    none.
+ * @param   queue : Pointer to the Tx queue
+ * @param   now   : Timer counter value
+ * @param   event : ARM_CAN_EVENT_TX_EXPIRED is added if frames were dropped
+ * @return  frame, CANFD_TX_QUEUE_NONE if none is waiting
+ */
+static uint8_t CANFD_TxQueueNext(CANFD_TX_QUEUE *queue, uint32_t now,
+                                 uint32_t *event)
+{
+    uint8_t frame = CANFD_TxQueuePeek(queue, now, event);
+
+    if(frame != CANFD_TX_QUEUE_NONE)
+    {
+        CANFD_TxHeapPop(queue);
+    }
+    return frame;
+}
+
+/**
+ * @fn      bool CANFD_TxQueueBeforeStb(const CANFD_TX_QUEUE *queue,
+ *                                      uint8_t frame)
+ * @brief   Checks if a frame may go out ahead of the secondary buf batch.
+ * @note    The controller sends the primary buf first, a frame loaded
+ *          there must not overtake a waiting frame of higher priority.
+ * @param   queue : Pointer to the Tx queue
+ * @param   frame : frame
+ * @return  true if frame is sent before every frame in the secondary buf
+ */
+static bool CANFD_TxQueueBeforeStb(const CANFD_TX_QUEUE *queue,
+                                   uint8_t frame)
+{
+    uint32_t iter = 0U;
+
+    for(iter = 0U; iter < queue->stb_cnt; iter++)
+    {
+        if(!CANFD_TxHeapBefore(queue, frame, queue->stb[iter]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @fn      void CANFD_TxQueueDone(CANFD_TX_QUEUE *queue, uint8_t frame,
+ *                                 uint32_t now)
+ * @brief   Accounts a sent frame and frees it.
+ * @note    none.
+ * @param   queue : Pointer to the Tx queue
+ * @param   frame : frame
+ * @param   now   : Timer counter value
+ * @return  none
+ */
+static void CANFD_TxQueueDone(CANFD_TX_QUEUE *queue, uint8_t frame,
+                              uint32_t now)
+{
+    uint32_t latency = (now - queue->queued_at[frame]);
+
+    queue->sent++;
+    queue->latency_sum += latency;
+    if(latency > queue->latency_max)
+    {
+        queue->latency_max = latency;
+    }
+    queue->free[queue->free_cnt++] = frame;
+}
+
+/**
+ * @fn      void CANFD_TxQueueLoad(CANFD_RESOURCES* CANFD, uint8_t frame,
+ *                                 uint8_t buf_type)
+ * @brief   Loads a queued frame into a Tx buffer.
+ * @note    none.
+ * @param   CANFD    : Pointer to canfd resources structure.
+ * @param   frame    : frame
+ * @param   buf_type : Tx Buffer type
+ * @return  none
+ */
+static void CANFD_TxQueueLoad(CANFD_RESOURCES* CANFD, uint8_t frame,
+                              uint8_t buf_type)
+{
+    const ARM_CAN_TX_FRAME *tx_frame = &CANFD->tx_queue.frames[frame];
+    canfd_tx_info_t tx_header;
+
+    memset(&tx_header, 0x0, sizeof(canfd_tx_info_t));
+
+    /* Stores the message id based on message frame ID type */
+    tx_header.frame_type = (tx_frame->info.id >> ARM_CAN_ID_IDE_Pos);
+    if(tx_header.frame_type)
+    {
+        tx_header.id = (ARM_CAN_EXTENDED_ID(tx_frame->info.id)
+                        & (~ARM_CAN_ID_IDE_Msk));
+    }
+    else
+    {
+        tx_header.id = ARM_CAN_STANDARD_ID(tx_frame->info.id);
+    }
+
+    tx_header.edl      = tx_frame->info.edl;
+    tx_header.brs      = tx_frame->info.brs;
+    tx_header.dlc      = tx_frame->info.dlc;
+    tx_header.rtr      = tx_frame->info.rtr;
+    tx_header.buf_type = buf_type;
+
+    canfd_select_tx_buf(CANFD->regs, buf_type);
+    canfd_load_tx_msg(CANFD->regs, tx_header, tx_frame->data, tx_frame->size);
+}
+
+/**
+ * @fn      uint32_t CANFD_TxQueueRefill(CANFD_RESOURCES* CANFD)
+ * @brief   Feeds the idle Tx buffers from the queue: the head to the
+ *          primary buf if it is ahead of the secondary buf batch, a
+ *          batch to the secondary buf once it is empty.
+ * @note    Called from the IRQ handler or with the IRQ disabled.
+ * @param   CANFD  : Pointer to canfd resources structure.
+ * @return  ARM_CAN_EVENT_TX_EXPIRED to signal, or 0
+ */
+static uint32_t CANFD_TxQueueRefill(CANFD_RESOURCES* CANFD)
+{
+    CANFD_TX_QUEUE *queue = &CANFD->tx_queue;
+    uint32_t now          = canfd_counter_get(CANFD->cnt_regs);
+    uint32_t event        = 0U;
+    uint8_t  frame        = CANFD_TX_QUEUE_NONE;
+
+    if(queue->ptb == CANFD_TX_QUEUE_NONE)
+    {
+        /* The primary buf stays idle rather than overtake the batch */
+        frame = CANFD_TxQueuePeek(queue, now, &event);
+        if((frame != CANFD_TX_QUEUE_NONE) &&
+           CANFD_TxQueueBeforeStb(queue, frame))
+        {
+            CANFD_TxHeapPop(queue);
+            CANFD_TxQueueLoad(CANFD, frame, CANFD_BUF_TYPE_PRIMARY);
+            canfd_start_tx(CANFD->regs, CANFD_BUF_TYPE_PRIMARY);
+            queue->ptb = frame;
+        }
+    }
+
+    if(queue->stb_depth && (queue->stb_cnt == 0U))
+    {
+        while(queue->stb_cnt < queue->stb_depth)
+        {
+            frame = CANFD_TxQueueNext(queue, now, &event);
+            if(frame == CANFD_TX_QUEUE_NONE)
+            {
+                break;
+            }
+            CANFD_TxQueueLoad(CANFD, frame, CANFD_BUF_TYPE_SECONDARY);
+            queue->stb[queue->stb_cnt++] = frame;
+        }
+        if(queue->stb_cnt)
+        {
+            canfd_start_tx(CANFD->regs, CANFD_BUF_TYPE_SECONDARY);
+        }
+    }
+
+    return event;
+}
+
+/**
+ * @fn      uint32_t CANFD_TxQueueComplete(CANFD_RESOURCES* CANFD,
+ *                                         uint32_t irq_event)
+ * @brief   Frees the sent frames and refills the Tx buffers.
+ * @note    Called from the IRQ handler.
+ * @param   CANFD      : Pointer to canfd resources structure.
+ * @param   irq_event  : Tx complete events
+ * @return  ARM_CAN_EVENT_SEND_COMPLETE and ARM_CAN_EVENT_TX_EXPIRED to signal
+ */
+static uint32_t CANFD_TxQueueComplete(CANFD_RESOURCES* CANFD,
+                                      uint32_t irq_event)
+{
+    CANFD_TX_QUEUE *queue = &CANFD->tx_queue;
+    uint32_t now          = canfd_counter_get(CANFD->cnt_regs);
+    uint32_t iter         = 0U;
+
+    if((irq_event & CANFD_PRIMARY_BUF_TX_COMPLETE_EVENT) &&
+       (queue->ptb != CANFD_TX_QUEUE_NONE))
+    {
+        CANFD_TxQueueDone(queue, queue->ptb, now);
+        queue->ptb = CANFD_TX_QUEUE_NONE;
+    }
+
+    /* The batch is done once the whole secondary buf is sent */
+    if((irq_event & CANFD_SECONDARY_BUF_TX_COMPLETE_EVENT) &&
+       canfd_stb_empty(CANFD->regs))
+    {
+        for(iter = 0U; iter < queue->stb_cnt; iter++)
+        {
+            CANFD_TxQueueDone(queue, queue->stb[iter], now);
+        }
+        queue->stb_cnt = 0U;
+    }
+
+    return (ARM_CAN_EVENT_SEND_COMPLETE | CANFD_TxQueueRefill(CANFD));
+}
+
+/**
+ * @fn      int32_t CANFD_TxQueueSetup(CANFD_RESOURCES* CANFD,
+ *                                     const ARM_CAN_TX_QUEUE *tx_queue)
+ * @brief   Sets up or removes the Tx queue.
+ * @note    none.
+ * @param   CANFD     : Pointer to canfd resources structure.
+ * @param   tx_queue  : Tx queue, NULL to remove it
+ * @return  \ref execution_status
+ */
+static int32_t CANFD_TxQueueSetup(CANFD_RESOURCES* CANFD,
+                                  const ARM_CAN_TX_QUEUE *tx_queue)
+{
+    CANFD_TX_QUEUE *queue = &CANFD->tx_queue;
+    uint32_t iter         = 0U;
+
+    /* Frames still in the Tx buffers */
+    if((queue->frames != NULL) &&
+       ((queue->ptb != CANFD_TX_QUEUE_NONE) || queue->stb_cnt))
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    queue->frames = NULL;
+
+    if(tx_queue == NULL)
+    {
+        return ARM_DRIVER_OK;
+    }
+
+#if RTE_CANFD_BLOCKING_MODE_ENABLE
+    if(CANFD->blocking_mode)
+    {
+        return ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+#endif
+
+    if((tx_queue->frames == NULL) || (tx_queue->num == 0U) ||
+       (tx_queue->num > ARM_CAN_TX_QUEUE_MAX_FRAMES) ||
+       (tx_queue->stb_depth > ARM_CAN_TX_QUEUE_MAX_STB_DEPTH))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    for(iter = 0U; iter < tx_queue->num; iter++)
+    {
+        queue->free[iter] = (uint8_t)(tx_queue->num - 1U - iter);
+    }
+    queue->num         = tx_queue->num;
+    queue->stb_depth   = tx_queue->stb_depth;
+    queue->free_cnt    = (uint8_t)tx_queue->num;
+    queue->heap_cnt    = 0U;
+    queue->stb_cnt     = 0U;
+    queue->ptb         = CANFD_TX_QUEUE_NONE;
+    queue->max_depth   = 0U;
+    queue->sent        = 0U;
+    queue->expired     = 0U;
+    queue->latency_max = 0U;
+    queue->latency_sum = 0U;
+
+    /* The secondary buf sends its batch by ID */
+    if(queue->stb_depth)
+    {
+        canfd_set_stb_mode(CANFD->regs, CANFD_SECONDARY_BUF_MODE_PRIORITY);
+    }
+
+    queue->frames = tx_queue->frames;
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn      int32_t CANFD_TxQueueSend(CANFD_RESOURCES* CANFD,
+ *                                    const ARM_CAN_TX_FRAME *tx_frame)
+ * @brief   Adds a frame to the Tx queue.
+ * @note    none.
+ * @param   CANFD     : Pointer to canfd resources structure.
+ * @param   tx_frame  : Frame to send, copied into the queue
+ * @return  \ref execution_status
+ */
+static int32_t CANFD_TxQueueSend(CANFD_RESOURCES* CANFD,
+                                 const ARM_CAN_TX_FRAME *tx_frame)
+{
+    CANFD_TX_QUEUE *queue = &CANFD->tx_queue;
+    uint32_t event        = 0U;
+    uint8_t  frame        = CANFD_TX_QUEUE_NONE;
+
+    if(queue->frames == NULL)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
+    /* If the node is in other than below modes, returns an error */
+    if((CANFD->op_mode != CANFD_OP_MODE_NORMAL)               &&
+       (CANFD->op_mode != CANFD_OP_MODE_LOOPBACK_EXTERNAL)    &&
+       (CANFD->op_mode != CANFD_OP_MODE_LOOPBACK_INTERNAL))
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
+    /* Same checks as for ARM_CAN_MessageSend */
+    if((tx_frame == NULL)                                            ||
+       ((tx_frame->info.brs == 0x1U) && (tx_frame->info.rtr == 0x1U)) ||
+       (tx_frame->size != canfd_dlc_to_payload_map[tx_frame->info.dlc]))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    if((tx_frame->size > 0x8U) && ((tx_frame->info.edl == 0x0U) ||
+       (canfd_in_fd_mode() == false)))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    /* Come out of standby mode before starting transmission */
+    if(CANFD->state.standby == 0x1U)
+    {
+        canfd_disable_standby_mode(CANFD->regs);
+        CANFD->state.standby = 0x0U;
+        sys_busy_loop_us(CANFD_TRANSCEIVER_STANDBY_DELAY);
+    }
+
+    NVIC_DisableIRQ(CANFD->irq_num);
+
+    if(queue->free_cnt == 0U)
+    {
+        NVIC_EnableIRQ(CANFD->irq_num);
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    frame = queue->free[--queue->free_cnt];
+    memcpy(&queue->frames[frame], tx_frame, sizeof(ARM_CAN_TX_FRAME));
+    queue->key[frame]       = CANFD_TxPriorityKey(tx_frame->info.id);
+    queue->order[frame]     = queue->seq++;
+    queue->queued_at[frame] = canfd_counter_get(CANFD->cnt_regs);
+    CANFD_TxHeapPush(queue, frame);
+
+    if((queue->num - queue->free_cnt) > queue->max_depth)
+    {
+        queue->max_depth = (queue->num - queue->free_cnt);
+    }
+
+    event = CANFD_TxQueueRefill(CANFD);
+
+    NVIC_EnableIRQ(CANFD->irq_num);
+
+    if(event)
+    {
+        CANFD->cb_obj_event(CANFD->objs[ARM_CAN_OBJ_TX - 0x1U].obj_id, event);
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn      int32_t CANFD_TxQueueExpire(CANFD_RESOURCES* CANFD)
+ * @brief   Drops the queued frames past their deadline and aborts the
+ *          primary buf if its frame expired.
+ * @note    A frame already on the bus is not aborted; waits for it
+ *          to complete.
+ * @param   CANFD  : Pointer to canfd resources structure.
+ * @return  \ref execution_status
+ */
+static int32_t CANFD_TxQueueExpire(CANFD_RESOURCES* CANFD)
+{
+    CANFD_TX_QUEUE *queue = &CANFD->tx_queue;
+    uint32_t now          = canfd_counter_get(CANFD->cnt_regs);
+    uint32_t event        = 0U;
+    uint32_t iter         = 0U;
+    uint32_t kept         = 0U;
+    uint8_t  frame        = CANFD_TX_QUEUE_NONE;
+
+    if(queue->frames == NULL)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
+    NVIC_DisableIRQ(CANFD->irq_num);
+
+    /* Drops the expired waiting frames and rebuilds the heap */
+    for(iter = 0U; iter < queue->heap_cnt; iter++)
+    {
+        frame = queue->heap[iter];
+        if(CANFD_TxExpired(&queue->frames[frame], now))
+        {
+            queue->free[queue->free_cnt++] = frame;
+            queue->expired++;
+            event |= ARM_CAN_EVENT_TX_EXPIRED;
+        }
+        else
+        {
+            queue->heap[kept++] = frame;
+        }
+    }
+    queue->heap_cnt = (uint8_t)kept;
+    for(iter = (kept / 2U); iter-- > 0U;)
+    {
+        CANFD_TxHeapSift(queue, iter);
+    }
+
+    if((queue->ptb != CANFD_TX_QUEUE_NONE) &&
+       CANFD_TxExpired(&queue->frames[queue->ptb], now))
+    {
+        canfd_abort_tx(CANFD->regs, CANFD_BUF_TYPE_PRIMARY);
+        while(canfd_ptb_tx_active(CANFD->regs))
+        {
+            ;
+        }
+
+        /* If it was sent meanwhile, the IRQ handler accounts it */
+        if(!canfd_tx_complete(CANFD->regs, CANFD_BUF_TYPE_PRIMARY))
+        {
+            queue->free[queue->free_cnt++] = queue->ptb;
+            queue->ptb = CANFD_TX_QUEUE_NONE;
+            queue->expired++;
+            event |= ARM_CAN_EVENT_TX_EXPIRED;
+        }
+    }
+
+    event |= CANFD_TxQueueRefill(CANFD);
+
+    NVIC_EnableIRQ(CANFD->irq_num);
+
+    if(event)
+    {
+        CANFD->cb_obj_event(CANFD->objs[ARM_CAN_OBJ_TX - 0x1U].obj_id, event);
+    }
+
+    return ARM_DRIVER_OK;
+}
+
 /**
  * @fn      int32_t ARM_CAN_Control(CANFD_RESOURCES* CANFD,
  *                                  uint32_t control,
@@ -1189,6 +2006,10 @@ static int32_t ARM_CAN_Control(CANFD_RESOURCES* CANFD,
                                uint32_t control,
                                uint32_t arg)
 {
+    ARM_CAN_RX_FIFO       *rx_fifo  = NULL;
+    ARM_CAN_RX_FIFO_BATCH *rx_batch = NULL;
+    ARM_CAN_TX_QUEUE_STATUS *tx_status = NULL;
+
     if(CANFD->state.powered == 0x0U)
     {
         return ARM_DRIVER_ERROR;
@@ -1382,6 +2203,74 @@ static int32_t ARM_CAN_Control(CANFD_RESOURCES* CANFD,
             *((uint32_t*)arg) = CANFD->data_transfer.rx_header.timestamp[0U];
             break;
 
+        case ARM_CAN_SET_RX_FIFO:
+            /* Detaches the fifo from the IRQ while it is changed */
+            CANFD->rx_fifo.msgs = NULL;
+            if(!arg)
+            {
+                break;
+            }
+            rx_fifo = (ARM_CAN_RX_FIFO*)arg;
+#if RTE_CANFD_BLOCKING_MODE_ENABLE
+            if(CANFD->blocking_mode)
+            {
+                return ARM_DRIVER_ERROR_UNSUPPORTED;
+            }
+#endif
+            if((rx_fifo->msgs == NULL) || (rx_fifo->num == 0U) ||
+               (rx_fifo->num & (rx_fifo->num - 1U)))
+            {
+                return ARM_DRIVER_ERROR_PARAMETER;
+            }
+            CANFD->rx_fifo.num      = rx_fifo->num;
+            CANFD->rx_fifo.head     = 0U;
+            CANFD->rx_fifo.tail     = 0U;
+            CANFD->rx_fifo.overruns = 0U;
+            CANFD->rx_fifo.msgs     = rx_fifo->msgs;
+            break;
+
+        case ARM_CAN_SET_RX_DISPATCH:
+            return CANFD_RxDispatchSetup(CANFD, (const ARM_CAN_RX_DISPATCH*)arg);
+
+        case ARM_CAN_RX_FIFO_READ:
+            if((!arg) || (CANFD->rx_fifo.msgs == NULL))
+            {
+                return ARM_DRIVER_ERROR_PARAMETER;
+            }
+            rx_batch = (ARM_CAN_RX_FIFO_BATCH*)arg;
+            if(rx_batch->msgs == NULL)
+            {
+                return ARM_DRIVER_ERROR_PARAMETER;
+            }
+            rx_batch->count    = CANFD_RxFifoRead(CANFD, rx_batch->msgs, rx_batch->num);
+            rx_batch->overruns = CANFD->rx_fifo.overruns;
+            break;
+
+        case ARM_CAN_SET_TX_QUEUE:
+            return CANFD_TxQueueSetup(CANFD, (const ARM_CAN_TX_QUEUE*)arg);
+
+        case ARM_CAN_TX_QUEUE_SEND:
+            return CANFD_TxQueueSend(CANFD, (const ARM_CAN_TX_FRAME*)arg);
+
+        case ARM_CAN_TX_QUEUE_EXPIRE:
+            return CANFD_TxQueueExpire(CANFD);
+
+        case ARM_CAN_GET_TX_QUEUE_STATUS:
+            if((!arg) || (CANFD->tx_queue.frames == NULL))
+            {
+                return ARM_DRIVER_ERROR_PARAMETER;
+            }
+            tx_status              = (ARM_CAN_TX_QUEUE_STATUS*)arg;
+            tx_status->depth       = (CANFD->tx_queue.num - CANFD->tx_queue.free_cnt);
+            tx_status->max_depth   = CANFD->tx_queue.max_depth;
+            tx_status->sent        = CANFD->tx_queue.sent;
+            tx_status->expired     = CANFD->tx_queue.expired;
+            tx_status->latency_max = CANFD->tx_queue.latency_max;
+            tx_status->latency_avg = (CANFD->tx_queue.sent ?
+                                      (uint32_t)(CANFD->tx_queue.latency_sum /
+                                                 CANFD->tx_queue.sent) : 0U);
+            break;
+
         default:
             return ARM_DRIVER_ERROR_UNSUPPORTED;
     }
@@ -1483,6 +2372,7 @@ static ARM_CAN_STATUS ARM_CANx_GetStatus(void)
 void CANFD_IRQHandler(void)
 {
     uint32_t irq_event = 0U;
+    uint32_t rx_event  = 0U;
 
     CANFD_RES.status.unit_state      = ARM_CAN_UNIT_STATE_ACTIVE;
     CANFD_RES.status.last_error_code = ARM_CAN_LEC_NO_ERROR;
@@ -1496,7 +2386,33 @@ void CANFD_IRQHandler(void)
     /* Invokes low level function to check the IRQ */
     irq_event = canfd_irq_handler(CANFD_RES.regs);
 
-    if (irq_event & CANFD_RBUF_OVERRUN_EVENT)
+    if ((CANFD_RES.rx_fifo.msgs != NULL) &&
+        (irq_event & (CANFD_RBUF_OVERRUN_EVENT     |
+                      CANFD_RBUF_ALMOST_FULL_EVENT |
+                      CANFD_RBUF_AVAILABLE_EVENT)))
+    {
+        /* Drains the Rx buffer into the fifo, one event for all msgs */
+        rx_event = CANFD_RxFifoDrain(&CANFD_RES);
+        if (irq_event & CANFD_RBUF_OVERRUN_EVENT)
+        {
+            rx_event |= ARM_CAN_EVENT_RECEIVE_OVERRUN;
+        }
+        if (rx_event & ARM_CAN_EVENT_RECEIVE)
+        {
+            CANFD_RES.cb_obj_event(CANFD_RES.objs[ARM_CAN_OBJ_RX - 0x1U].obj_id,
+                                   ARM_CAN_EVENT_RECEIVE);
+        }
+        if (rx_event & ARM_CAN_EVENT_RECEIVE_OVERRUN)
+        {
+            CANFD_RES.cb_obj_event(CANFD_RES.objs[ARM_CAN_OBJ_RX - 0x1U].obj_id,
+                                   ARM_CAN_EVENT_RECEIVE_OVERRUN);
+        }
+        irq_event = (CANFD_RBUF_OVERRUN_EVENT    |
+                     CANFD_RBUF_FULL_EVENT       |
+                     CANFD_RBUF_ALMOST_FULL_EVENT|
+                     CANFD_RBUF_AVAILABLE_EVENT);
+    }
+    else if (irq_event & CANFD_RBUF_OVERRUN_EVENT)
     {
         /* If the Rbuf is overrun then performs below operation */
         CANFD_RES.cb_obj_event(CANFD_RES.objs[ARM_CAN_OBJ_RX - 0x1U].obj_id,
@@ -1524,6 +2440,21 @@ void CANFD_IRQHandler(void)
                      CANFD_RBUF_FULL_EVENT       |
                      CANFD_RBUF_ALMOST_FULL_EVENT);
     }
+    else if((CANFD_RES.tx_queue.frames != NULL) &&
+            (irq_event & (CANFD_PRIMARY_BUF_TX_COMPLETE_EVENT |
+                          CANFD_SECONDARY_BUF_TX_COMPLETE_EVENT)))
+    {
+        /* Clears the Tx complete flags before the Tx buffers are fed
+         * again, else the completion of a new frame could be lost */
+        irq_event &= (CANFD_PRIMARY_BUF_TX_COMPLETE_EVENT |
+                      CANFD_SECONDARY_BUF_TX_COMPLETE_EVENT);
+        canfd_clear_interrupt(CANFD_RES.regs, irq_event);
+
+        /* Frees the sent frames and feeds the Tx buffers from the queue */
+        CANFD_RES.cb_obj_event(CANFD_RES.objs[ARM_CAN_OBJ_TX - 0x1U].obj_id,
+                               CANFD_TxQueueComplete(&CANFD_RES, irq_event));
+        irq_event = 0U;
+    }
     else if(irq_event & CANFD_SECONDARY_BUF_TX_COMPLETE_EVENT)
     {
         /* If the Secondary buf Tx interrupt is occurred
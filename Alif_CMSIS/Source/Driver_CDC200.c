@@ -26,7 +26,7 @@
 #include "RTE_Device.h"
 #include "display.h"
 
-#define ARM_CDC200_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0) /*driver version*/
+#define ARM_CDC200_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 1) /*driver version*/
 
 #if !(RTE_CDC200)
 #error "CDC200 is not enabled in the RTE_Device.h"
@@ -222,6 +222,15 @@ static int32_t CDC200_PowerCtrl (ARM_POWER_STATE state,
             NVIC_DisableIRQ (CDC_SCANLINE0_IRQ_IRQn);
             NVIC_ClearPendingIRQ (CDC_SCANLINE0_IRQ_IRQn);
 
+            /*Disabling Register reload IRQ*/
+            NVIC_DisableIRQ (CDC_REG_RELOAD0_IRQ_IRQn);
+            NVIC_ClearPendingIRQ (CDC_REG_RELOAD0_IRQ_IRQn);
+
+            /*Drop queued page flips*/
+            cdc->flip.head           = 0;
+            cdc->flip.count          = 0;
+            cdc->flip.reload_pending = 0;
+
             /* Disabling pixel clock */
             disable_cdc_pixel_clk ();
 
@@ -285,6 +294,11 @@ static int32_t CDC200_PowerCtrl (ARM_POWER_STATE state,
             NVIC_SetPriority (CDC_SCANLINE0_IRQ_IRQn, cdc->irq_priority);
             NVIC_EnableIRQ (CDC_SCANLINE0_IRQ_IRQn);
 
+            /*Enabling Register reload IRQ, used for page flips*/
+            NVIC_ClearPendingIRQ (CDC_REG_RELOAD0_IRQ_IRQn);
+            NVIC_SetPriority (CDC_REG_RELOAD0_IRQ_IRQn, cdc->irq_priority);
+            NVIC_EnableIRQ (CDC_REG_RELOAD0_IRQ_IRQn);
+
             cdc->state.powered = 1;
             break;
         }
@@ -299,6 +313,84 @@ static int32_t CDC200_PowerCtrl (ARM_POWER_STATE state,
     return ARM_DRIVER_OK;
 }
 
+/**
+  \fn          static void CDC200_PageFlipCommit (CDC_RESOURCES *cdc)
+  \brief       Write the oldest queued page flip to the shadow registers.
+               All layers of the flip are reloaded together at the next vertical
+               blanking, the register reload IRQ reports completion.
+  \param[in]   cdc Pointer to CDC resources.
+*/
+static void CDC200_PageFlipCommit (CDC_RESOURCES *cdc)
+{
+    CDC_PAGE_FLIP_QUEUE *flip = &cdc->flip;
+    uint32_t layer;
+
+    if (flip->reload_pending || (flip->count == 0))
+    {
+        return;
+    }
+
+    for (layer = 0; layer < CDC_PAGE_FLIP_LAYERS; layer++)
+    {
+        flip->committed[layer] = flip->fb_addr[flip->head][layer];
+
+        if (flip->committed[layer])
+        {
+            cdc_set_layer_fb_addr_shadow (cdc->regs, (CDC_LAYER)layer, flip->committed[layer]);
+        }
+    }
+    flip->committed_event = flip->event[flip->head];
+
+    flip->head = (flip->head + 1) % CDC_PAGE_FLIP_QUEUE_DEPTH;
+    flip->count--;
+    flip->reload_pending = 1;
+
+    cdc_irq_enable (cdc->regs, CDC_IRQ_REGISTER_RELOAD);
+    cdc_global_shadow_reload (cdc->regs, CDC_SHADOW_RELOAD_VBR);
+}
+
+/**
+  \fn          static int32_t CDC200_PageFlip (CDC_RESOURCES *cdc, const uint32_t *fb_addr, uint32_t event)
+  \brief       Queue a page flip.
+  \param[in]   cdc Pointer to CDC resources.
+  \param[in]   fb_addr Next FB address per layer, 0 = keep current.
+  \param[in]   event Events to signal once the flip is applied.
+  \return      \ref execution_status.
+*/
+static int32_t CDC200_PageFlip (CDC_RESOURCES *cdc, const uint32_t *fb_addr, uint32_t event)
+{
+    CDC_PAGE_FLIP_QUEUE *flip = &cdc->flip;
+    uint32_t layer, tail;
+
+    if ((fb_addr[ARM_CDC200_LAYER_1] == 0) && (fb_addr[ARM_CDC200_LAYER_2] == 0))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    NVIC_DisableIRQ (CDC_REG_RELOAD0_IRQ_IRQn);
+
+    if (flip->count == CDC_PAGE_FLIP_QUEUE_DEPTH)
+    {
+        NVIC_EnableIRQ (CDC_REG_RELOAD0_IRQ_IRQn);
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    tail = (flip->head + flip->count) % CDC_PAGE_FLIP_QUEUE_DEPTH;
+
+    for (layer = 0; layer < CDC_PAGE_FLIP_LAYERS; layer++)
+    {
+        flip->fb_addr[tail][layer] = fb_addr[layer] ? LocalToGlobal((void*)fb_addr[layer]) : 0;
+    }
+    flip->event[tail] = event;
+    flip->count++;
+
+    CDC200_PageFlipCommit (cdc);
+
+    NVIC_EnableIRQ (CDC_REG_RELOAD0_IRQ_IRQn);
+
+    return ARM_DRIVER_OK;
+}
+
 /**
  \fn          static int32_t CDC200_control (uint32_t control, uint32_t arg,
                                              DISPLAY_PANEL_DEVICE *display_panel,
@@ -538,6 +630,35 @@ static int32_t CDC200_control (uint32_t control, uint32_t arg,
             break;
         }
 
+        case CDC200_FRAMEBUF_UPDATE_VSYNC:
+        {
+            uint32_t fb_addr[CDC_PAGE_FLIP_LAYERS] = {arg, 0};
+
+            /*Previous layer 1 buffer is still waiting for the vertical blanking*/
+            if (cdc->flip.count || (cdc->flip.reload_pending && cdc->flip.committed[CDC_LAYER_1]))
+            {
+                return ARM_DRIVER_ERROR_BUSY;
+            }
+
+            return CDC200_PageFlip (cdc, fb_addr, ARM_CDC_FRAMEBUF_UPDATE_EVENT);
+        }
+
+        case CDC200_PAGE_FLIP:
+        {
+            ARM_CDC200_PAGE_FLIP_INFO *flip_info = (ARM_CDC200_PAGE_FLIP_INFO *)arg;
+            uint32_t event;
+
+            if (flip_info == NULL)
+            {
+                return ARM_DRIVER_ERROR_PARAMETER;
+            }
+
+            event  = flip_info->fb_addr[ARM_CDC200_LAYER_1] ? ARM_CDC_LAYER1_FLIP_EVENT : 0;
+            event |= flip_info->fb_addr[ARM_CDC200_LAYER_2] ? ARM_CDC_LAYER2_FLIP_EVENT : 0;
+
+            return CDC200_PageFlip (cdc, flip_info->fb_addr, event);
+        }
+
         default:
         {
             return ARM_DRIVER_ERROR_UNSUPPORTED;
@@ -643,6 +764,44 @@ static void CDC200_ISR (CDC_RESOURCES *cdc)
     }
 }
 
+/**
+  \fn          static void CDC200_Reload_ISR (CDC_RESOURCES *cdc)
+  \brief       CDC200 register reload interrupt service routine
+  \param[in]   cdc  Pointer to CDC resources
+*/
+static void CDC200_Reload_ISR (CDC_RESOURCES *cdc)
+{
+    CDC_PAGE_FLIP_QUEUE *flip = &cdc->flip;
+    uint32_t irq_st = cdc_get_irq_status (cdc->regs);
+    uint32_t event  = 0;
+
+    if (!(irq_st & CDC_IRQ_REGISTER_RELOAD))
+    {
+        return;
+    }
+
+    cdc_irq_clear (cdc->regs, CDC_IRQ_REGISTER_RELOAD);
+
+    if (flip->reload_pending)
+    {
+        /*Committed buffers are scanned out now, the replaced ones are free*/
+        event = flip->committed_event;
+        flip->reload_pending = 0;
+
+        CDC200_PageFlipCommit (cdc);
+    }
+
+    if (flip->reload_pending == 0)
+    {
+        cdc_irq_disable (cdc->regs, CDC_IRQ_REGISTER_RELOAD);
+    }
+
+    if (event && cdc->cb_event)
+    {
+        cdc->cb_event (event);
+    }
+}
+
 #if (RTE_CDC200)
 
 /* DSI LCD Panel access structure */
@@ -765,6 +924,15 @@ void CDC_SCANLINE0_IRQHandler(void)
     CDC200_ISR (&CDC_RES);
 }
 
+/**
+  \fn          void CDC_REG_RELOAD0_IRQHandler (void)
+  \brief       CDC200 Register reload IRQ Handler.
+*/
+void CDC_REG_RELOAD0_IRQHandler(void)
+{
+    CDC200_Reload_ISR (&CDC_RES);
+}
+
 extern ARM_DRIVER_CDC200 Driver_CDC200;
 
 ARM_DRIVER_CDC200 Driver_CDC200 =
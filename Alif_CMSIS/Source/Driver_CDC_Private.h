@@ -32,6 +32,20 @@ extern "C"
 {
 #endif
 
+#define CDC_PAGE_FLIP_QUEUE_DEPTH   2U                 /**< Queued page flips, enough for triple buffering */
+#define CDC_PAGE_FLIP_LAYERS        2U                 /**< Number of CDC layers                           */
+
+/** \brief CDC page flip queue. */
+typedef struct _CDC_PAGE_FLIP_QUEUE {
+    uint32_t fb_addr[CDC_PAGE_FLIP_QUEUE_DEPTH][CDC_PAGE_FLIP_LAYERS]; /**< Queued FB addresses, 0 = keep  */
+    uint32_t event[CDC_PAGE_FLIP_QUEUE_DEPTH];   /**< Events to signal once the queued flip is applied */
+    uint8_t  head;                               /**< Oldest queued flip    */
+    uint8_t  count;                              /**< Number of queued flips */
+    uint8_t  reload_pending;                     /**< Flip waiting for vertical blanking reload */
+    uint32_t committed[CDC_PAGE_FLIP_LAYERS];    /**< FB addresses in shadow registers */
+    uint32_t committed_event;                    /**< Events of the flip in shadow registers */
+} CDC_PAGE_FLIP_QUEUE;
+
 /** \brief CDC Driver states. */
 typedef volatile struct _CDC_DRIVER_STATE {
     uint32_t initialized : 1;                    /**< Driver Initialized    */
@@ -49,6 +63,7 @@ typedef struct _CDC_RESOURCES {
     uint8_t                   const_alpha;           /**< Layer constant alpha             */
     CDC_BLEND_FACTOR          blend_factor;          /**< Layer blending factor            */
     uint32_t                  irq_priority;          /**< Interrupt priority               */
+    CDC_PAGE_FLIP_QUEUE       flip;                  /**< Page flip queue                  */
     CDC_DRIVER_STATE          state;                 /**< CDC driver status                */
 } CDC_RESOURCES;
 
@@ -53,7 +53,12 @@ extern ARM_DRIVER_MIPI_CSI2 Driver_MIPI_CSI2;
 void ARM_MIPI_CSI2_Event_Callback (uint32_t int_event);
 #endif
 
-#define ARM_CPI_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)  /* driver version */
+#if defined(RTE_Drivers_CDC200)
+#include "Driver_CDC200.h"
+extern ARM_DRIVER_CDC200 Driver_CDC200;
+#endif
+
+#define ARM_CPI_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 1)  /* driver version */
 
 /* Driver Version */
 static const ARM_DRIVER_VERSION DriverVersion = {
@@ -69,6 +74,9 @@ static const ARM_CPI_CAPABILITIES DriverCapabilities = {
     1, /* Supports CPI video mode,
            In this mode CPI will capture frame
            continuously. */
+    1, /* Supports CPI video mode with frame queue,
+           In this mode CPI will rotate through
+           application donated frame buffers. */
     0  /* Reserved (must be zero) */
 };
 
@@ -457,6 +465,443 @@ Error_Stop_CSI:
     return ARM_DRIVER_ERROR;
 }
 
+/**
+  \fn        void CPI_FrameFifoPush(CPI_FRAME_FIFO *fifo, uint8_t idx)
+  \brief     Append buffer index to the tail of frame queue FIFO.
+  \param[in] fifo  Pointer to frame queue FIFO
+  \param[in] idx   Buffer index
+  \return    none
+*/
+static void CPI_FrameFifoPush(CPI_FRAME_FIFO *fifo, uint8_t idx)
+{
+    fifo->idx[(fifo->head + fifo->count) % CPI_FRAME_QUEUE_MAX_BUFFERS] = idx;
+    fifo->count++;
+}
+
+/**
+  \fn        uint8_t CPI_FrameFifoPop(CPI_FRAME_FIFO *fifo)
+  \brief     Remove buffer index from the head of frame queue FIFO.
+  \param[in] fifo  Pointer to frame queue FIFO
+  \return    Buffer index or CPI_FRAME_QUEUE_INVALID_IDX if FIFO is empty
+*/
+static uint8_t CPI_FrameFifoPop(CPI_FRAME_FIFO *fifo)
+{
+    uint8_t idx;
+
+    if(fifo->count == 0U)
+    {
+        return CPI_FRAME_QUEUE_INVALID_IDX;
+    }
+
+    idx = fifo->idx[fifo->head];
+    fifo->head = (fifo->head + 1U) % CPI_FRAME_QUEUE_MAX_BUFFERS;
+    fifo->count--;
+
+    return idx;
+}
+
+/**
+  \fn        int32_t CPI_FrameQueueConfigure(CPI_RESOURCES *CPI, const ARM_CPI_FRAME_QUEUE_CONFIG *cfg)
+  \brief     Take ownership of the application frame buffers and reset the frame queue.
+  \param[in] CPI   Pointer to CPI resources structure
+  \param[in] cfg   Pointer to frame queue configuration
+  \return    \ref execution_status
+*/
+static int32_t CPI_FrameQueueConfigure(CPI_RESOURCES *CPI, const ARM_CPI_FRAME_QUEUE_CONFIG *cfg)
+{
+    CPI_FRAME_QUEUE *queue = &CPI->frame_queue;
+    uint8_t idx;
+
+    if(CPI->status.queue_running)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    if((cfg == NULL) || (cfg->buffers == NULL) ||
+       (cfg->num_buffers < 2U) || (cfg->num_buffers > CPI_FRAME_QUEUE_MAX_BUFFERS))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    queue->free.head  = 0U;
+    queue->free.count = 0U;
+    queue->done.head  = 0U;
+    queue->done.count = 0U;
+
+    for(idx = 0U; idx < cfg->num_buffers; idx++)
+    {
+        if(cfg->buffers[idx] == NULL)
+        {
+            return ARM_DRIVER_ERROR_PARAMETER;
+        }
+
+        queue->buffers[idx]   = cfg->buffers[idx];
+        queue->buf_state[idx] = CPI_FRAME_BUF_FREE;
+        CPI_FrameFifoPush(&queue->free, idx);
+    }
+
+    queue->num_buffers   = (uint8_t) cfg->num_buffers;
+    queue->active        = CPI_FRAME_QUEUE_INVALID_IDX;
+    queue->next          = CPI_FRAME_QUEUE_INVALID_IDX;
+    queue->disp_shown    = CPI_FRAME_QUEUE_INVALID_IDX;
+    queue->disp_queued   = CPI_FRAME_QUEUE_INVALID_IDX;
+    queue->policy        = cfg->policy;
+    queue->get_timestamp = cfg->get_timestamp;
+    queue->sequence      = 0U;
+    queue->dropped       = 0U;
+
+    CPI->status.queue_configured = 1;
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+  \fn        void CPI_FrameQueueRelease(CPI_RESOURCES *CPI, uint8_t idx)
+  \brief     Return a frame queue buffer to the free list.
+  \param[in] CPI   Pointer to CPI resources structure
+  \param[in] idx   Buffer index
+  \return    none
+*/
+static void CPI_FrameQueueRelease(CPI_RESOURCES *CPI, uint8_t idx)
+{
+    CPI->frame_queue.buf_state[idx] = CPI_FRAME_BUF_FREE;
+    CPI_FrameFifoPush(&CPI->frame_queue.free, idx);
+}
+
+#if defined(RTE_Drivers_CDC200)
+/**
+  \fn        uint32_t CPI_FrameQueueDisplay(CPI_RESOURCES *CPI, uint8_t idx)
+  \brief     Hand a completed frame to CDC200 layer 1 (called from IRQ).
+             The CDC200 switches to the frame at its next vertical blanking.
+             Once a further frame is accepted, the switch has happened and
+             the buffer scanned out before is free again.
+  \param[in] CPI   Pointer to CPI resources structure
+  \param[in] idx   Buffer index of the completed frame
+  \return    frame queue events \ref ARM_CPI_EVENT_CAMERA_FRAME_DROPPED
+*/
+static uint32_t CPI_FrameQueueDisplay(CPI_RESOURCES *CPI, uint8_t idx)
+{
+    CPI_FRAME_QUEUE *queue = &CPI->frame_queue;
+    int32_t ret;
+
+    ret = Driver_CDC200.Control(CDC200_FRAMEBUF_UPDATE_VSYNC, (uint32_t) queue->buffers[idx]);
+    if(ret != ARM_DRIVER_OK)
+    {
+        /* Previous frame not on screen yet, skip this one */
+        CPI_FrameQueueRelease(CPI, idx);
+        queue->dropped++;
+        return ARM_CPI_EVENT_CAMERA_FRAME_DROPPED;
+    }
+
+    if(queue->disp_shown != CPI_FRAME_QUEUE_INVALID_IDX)
+    {
+        CPI_FrameQueueRelease(CPI, queue->disp_shown);
+    }
+
+    queue->buf_state[idx] = CPI_FRAME_BUF_DISPLAY;
+    queue->disp_shown     = queue->disp_queued;
+    queue->disp_queued    = idx;
+
+    return 0U;
+}
+#endif
+
+/**
+  \fn        uint32_t CPI_FrameQueueVsync(CPI_RESOURCES *CPI)
+  \brief     Rotate frame queue buffers on VSYNC (called from IRQ).
+             VSYNC marks the start of a new frame, the CPI latches the frame
+             buffer address at that point. This function will
+                 - queue the frame held by the previously active buffer
+                 - promote the programmed buffer to active
+                 - program a free buffer for the following frame, or apply the
+                   backpressure policy if no buffer is free.
+  \param[in] CPI   Pointer to CPI resources structure
+  \return    frame queue events \ref ARM_CPI_EVENT_CAMERA_FRAME_READY,
+             \ref ARM_CPI_EVENT_CAMERA_FRAME_DROPPED
+*/
+static uint32_t CPI_FrameQueueVsync(CPI_RESOURCES *CPI)
+{
+    CPI_FRAME_QUEUE *queue = &CPI->frame_queue;
+    uint32_t event         = 0U;
+    uint8_t  completed     = CPI_FRAME_QUEUE_INVALID_IDX;
+    uint8_t  idx;
+
+    if(queue->active != CPI_FRAME_QUEUE_INVALID_IDX)
+    {
+        if(queue->active != queue->next)
+        {
+            idx = queue->active;
+#if defined(RTE_Drivers_CDC200)
+            if(CPI->status.display_link)
+            {
+                event |= CPI_FrameQueueDisplay(CPI, idx);
+            }
+            else
+#endif
+            {
+                queue->buf_state[idx]  = CPI_FRAME_BUF_DONE;
+                queue->buf_seq[idx]    = queue->sequence;
+                queue->buf_tstamp[idx] = queue->get_timestamp ? queue->get_timestamp() : 0U;
+                CPI_FrameFifoPush(&queue->done, idx);
+                completed = idx;
+                event |= ARM_CPI_EVENT_CAMERA_FRAME_READY;
+            }
+        }
+        else
+        {
+            /* Active buffer is re-used by the new frame, frame is lost */
+            queue->dropped++;
+            event |= ARM_CPI_EVENT_CAMERA_FRAME_DROPPED;
+        }
+        queue->sequence++;
+    }
+
+    queue->active = queue->next;
+
+    idx = CPI_FrameFifoPop(&queue->free);
+
+    /* Recycle the oldest completed frame not fetched by the application,
+     * never the one completed just now: it would not be delivered at all */
+    if((idx == CPI_FRAME_QUEUE_INVALID_IDX) &&
+       (queue->policy == ARM_CPI_FRAME_QUEUE_REUSE_OLDEST) &&
+       (queue->done.count != 0U) &&
+       (queue->done.idx[queue->done.head] != completed))
+    {
+        idx = CPI_FrameFifoPop(&queue->done);
+        queue->dropped++;
+        event |= ARM_CPI_EVENT_CAMERA_FRAME_DROPPED;
+    }
+
+    if(idx == CPI_FRAME_QUEUE_INVALID_IDX)
+    {
+        /* No buffer available, following frame overwrites the active one */
+        idx = queue->active;
+    }
+
+    queue->buf_state[idx] = CPI_FRAME_BUF_CAPTURE;
+    queue->next = idx;
+
+    cpi_set_framebuff_start_addr(CPI->regs, LocalToGlobal(queue->buffers[idx]));
+
+    return event;
+}
+
+/**
+  \fn        void CPI_FrameQueueStop(CPI_RESOURCES *CPI)
+  \brief     Return the buffers held by the CPI to the free list.
+             Completed frames and frames owned by the application are kept.
+  \param[in] CPI   Pointer to CPI resources structure
+  \return    none
+*/
+static void CPI_FrameQueueStop(CPI_RESOURCES *CPI)
+{
+    CPI_FRAME_QUEUE *queue = &CPI->frame_queue;
+    uint8_t idx;
+
+    for(idx = 0U; idx < queue->num_buffers; idx++)
+    {
+        if(queue->buf_state[idx] == CPI_FRAME_BUF_CAPTURE)
+        {
+            CPI_FrameQueueRelease(CPI, idx);
+        }
+    }
+
+    queue->active = CPI_FRAME_QUEUE_INVALID_IDX;
+    queue->next   = CPI_FRAME_QUEUE_INVALID_IDX;
+
+    CPI->status.queue_running = 0;
+}
+
+/**
+  \fn        int32_t CPI_FrameQueueDisplayLink(CPI_RESOURCES *CPI, uint32_t enable)
+  \brief     Link or unlink the frame queue to CDC200 layer 1.
+             While linked, completed frames are shown on the display instead of
+             being queued for \ref CPIx_GetFrame. On unlink the buffers held by
+             the display are returned to the free list, the application has to
+             point the CDC200 to another frame buffer before.
+  \param[in] CPI      Pointer to CPI resources structure
+  \param[in] enable   ENABLE / DISABLE
+  \return    \ref execution_status
+*/
+static int32_t CPI_FrameQueueDisplayLink(CPI_RESOURCES *CPI, uint32_t enable)
+{
+#if defined(RTE_Drivers_CDC200)
+    CPI_FRAME_QUEUE *queue = &CPI->frame_queue;
+
+    if(CPI->status.queue_configured == 0)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
+    if(CPI->status.queue_running)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    if(enable == ENABLE)
+    {
+        CPI->status.display_link = 1;
+    }
+    else if(enable == DISABLE)
+    {
+        if(queue->disp_shown != CPI_FRAME_QUEUE_INVALID_IDX)
+        {
+            CPI_FrameQueueRelease(CPI, queue->disp_shown);
+        }
+        if(queue->disp_queued != CPI_FRAME_QUEUE_INVALID_IDX)
+        {
+            CPI_FrameQueueRelease(CPI, queue->disp_queued);
+        }
+        queue->disp_shown        = CPI_FRAME_QUEUE_INVALID_IDX;
+        queue->disp_queued       = CPI_FRAME_QUEUE_INVALID_IDX;
+        CPI->status.display_link = 0;
+    }
+    else
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    return ARM_DRIVER_OK;
+#else
+    ARG_UNUSED(CPI);
+    ARG_UNUSED(enable);
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+}
+
+/**
+  \fn        int32_t CPIx_CaptureVideoQueue(CPI_RESOURCES *CPI, CAMERA_SENSOR_DEVICE *camera_sensor)
+  \brief     Start Camera Sensor and CPI in video mode on the frame queue.
+  \param[in] CPI             Pointer to CPI resources structure
+  \param[in] camera_sensor   Pointer to Camera Sensor Device resources structure
+  \return    \ref execution_status
+*/
+static int32_t CPIx_CaptureVideoQueue(CPI_RESOURCES *CPI, CAMERA_SENSOR_DEVICE *camera_sensor)
+{
+    CPI_FRAME_QUEUE *queue = &CPI->frame_queue;
+    int32_t ret;
+    uint8_t idx;
+
+    if(CPI->status.queue_configured == 0)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
+    if(CPI->status.queue_running)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    NVIC_DisableIRQ(CPI->irq_num);
+    idx = CPI_FrameFifoPop(&queue->free);
+    NVIC_EnableIRQ(CPI->irq_num);
+
+    if(idx == CPI_FRAME_QUEUE_INVALID_IDX)
+    {
+        /* All buffers are held by the application */
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    queue->buf_state[idx]     = CPI_FRAME_BUF_CAPTURE;
+    queue->active             = CPI_FRAME_QUEUE_INVALID_IDX;
+    queue->next               = idx;
+    CPI->status.queue_running = 1;
+
+    /* Buffers are rotated on VSYNC */
+    cpi_enable_interrupt(CPI->regs, CAM_INTR_VSYNC);
+
+    ret = CPIx_Capture(CPI, camera_sensor, queue->buffers[idx], CPI_MODE_SELECT_VIDEO);
+    if(ret != ARM_DRIVER_OK)
+    {
+        cpi_disable_interrupt(CPI->regs, CAM_INTR_VSYNC);
+        CPI_FrameQueueStop(CPI);
+    }
+
+    return ret;
+}
+
+/**
+  \fn        int32_t CPIx_GetFrame(CPI_RESOURCES *CPI, ARM_CPI_FRAME_INFO *frame)
+  \brief     Hand the oldest completed frame over to the application.
+  \param[in] CPI     Pointer to CPI resources structure
+  \param[out] frame  Pointer to completed frame information
+  \return    \ref execution_status
+*/
+static int32_t CPIx_GetFrame(CPI_RESOURCES *CPI, ARM_CPI_FRAME_INFO *frame)
+{
+    CPI_FRAME_QUEUE *queue = &CPI->frame_queue;
+    uint8_t idx;
+
+    if(frame == NULL)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    if(CPI->status.queue_configured == 0)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
+    NVIC_DisableIRQ(CPI->irq_num);
+
+    idx = CPI_FrameFifoPop(&queue->done);
+    if(idx != CPI_FRAME_QUEUE_INVALID_IDX)
+    {
+        queue->buf_state[idx] = CPI_FRAME_BUF_APP;
+        frame->buffer    = queue->buffers[idx];
+        frame->sequence  = queue->buf_seq[idx];
+        frame->timestamp = queue->buf_tstamp[idx];
+        frame->dropped   = queue->dropped;
+    }
+
+    NVIC_EnableIRQ(CPI->irq_num);
+
+    if(idx == CPI_FRAME_QUEUE_INVALID_IDX)
+    {
+        /* No completed frame yet */
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+  \fn        int32_t CPIx_ReleaseFrame(CPI_RESOURCES *CPI, void *framebuffer)
+  \brief     Return an application owned frame buffer to the free list.
+  \param[in] CPI           Pointer to CPI resources structure
+  \param[in] framebuffer   Frame buffer obtained from \ref CPIx_GetFrame
+  \return    \ref execution_status
+*/
+static int32_t CPIx_ReleaseFrame(CPI_RESOURCES *CPI, void *framebuffer)
+{
+    CPI_FRAME_QUEUE *queue = &CPI->frame_queue;
+    uint8_t idx;
+
+    if(CPI->status.queue_configured == 0)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
+    for(idx = 0U; idx < queue->num_buffers; idx++)
+    {
+        if(queue->buffers[idx] == framebuffer)
+        {
+            break;
+        }
+    }
+
+    if((idx == queue->num_buffers) || (queue->buf_state[idx] != CPI_FRAME_BUF_APP))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    NVIC_DisableIRQ(CPI->irq_num);
+    CPI_FrameQueueRelease(CPI, idx);
+    NVIC_EnableIRQ(CPI->irq_num);
+
+    return ARM_DRIVER_OK;
+}
+
 /**
   \fn        int32_t CPIx_Stop(CPI_RESOURCES *CPI, CAMERA_SENSOR_DEVICE *cam_sensor)
   \brief     Stop Camera Sensor and CPI.
@@ -491,6 +936,11 @@ static int32_t CPIx_Stop(CPI_RESOURCES *CPI, CAMERA_SENSOR_DEVICE *camera_sensor
         return ret;
     }
 
+    if(CPI->status.queue_running)
+    {
+        CPI_FrameQueueStop(CPI);
+    }
+
     return ARM_DRIVER_OK;
 }
 
@@ -584,6 +1034,28 @@ static int32_t CPIx_Control(CPI_RESOURCES *CPI, CAMERA_SENSOR_DEVICE *camera_sen
             break;
         }
 
+        case CPI_FRAME_QUEUE_CONFIGURE:
+        {
+            /* Donate frame buffers for video capture */
+            ret = CPI_FrameQueueConfigure(CPI, (const ARM_CPI_FRAME_QUEUE_CONFIG *) arg);
+            if(ret != ARM_DRIVER_OK)
+            {
+                return ret;
+            }
+            break;
+        }
+
+        case CPI_FRAME_QUEUE_DISPLAY_LINK:
+        {
+            /* Zero-copy camera to display preview */
+            ret = CPI_FrameQueueDisplayLink(CPI, arg);
+            if(ret != ARM_DRIVER_OK)
+            {
+                return ret;
+            }
+            break;
+        }
+
         case CPI_CAMERA_SENSOR_GAIN:
         {
             /* Camera Sensor gain */
@@ -668,6 +1140,12 @@ static void CPIx_IRQHandler(CPI_RESOURCES *CPI)
     {
         irqs |= CAM_INTR_VSYNC;
         event |= ARM_CPI_EVENT_CAMERA_FRAME_VSYNC_DETECTED;
+
+        /* rotate frame queue buffers */
+        if(CPI->status.queue_running)
+        {
+            event |= CPI_FrameQueueVsync(CPI);
+        }
     }
 
     /* received fifo over-run interrupt? */
@@ -782,6 +1260,21 @@ static int32_t CPI_Control(uint32_t control, uint32_t arg)
     return CPIx_Control(&CPI_CTRL, cpi_sensor, control, arg);
 }
 
+static int32_t CPI_CaptureVideoQueue(void)
+{
+    return CPIx_CaptureVideoQueue(&CPI_CTRL, cpi_sensor);
+}
+
+static int32_t CPI_GetFrame(ARM_CPI_FRAME_INFO *frame)
+{
+    return CPIx_GetFrame(&CPI_CTRL, frame);
+}
+
+static int32_t CPI_ReleaseFrame(void *framebuffer)
+{
+    return CPIx_ReleaseFrame(&CPI_CTRL, framebuffer);
+}
+
 void CAM_IRQHandler(void)
 {
     CPIx_IRQHandler(&CPI_CTRL);
@@ -799,6 +1292,9 @@ ARM_DRIVER_CPI Driver_CPI =
     CPI_CaptureVideo,
     CPI_Stop,
     CPI_Control,
+    CPI_CaptureVideoQueue,
+    CPI_GetFrame,
+    CPI_ReleaseFrame,
 };
 
 #endif /* End of RTE_CPI */
@@ -869,6 +1365,21 @@ static int32_t LPCPI_Control(uint32_t control, uint32_t arg)
     return CPIx_Control(&LPCPI_CTRL, lpcpi_sensor, control, arg);
 }
 
+static int32_t LPCPI_CaptureVideoQueue(void)
+{
+    return CPIx_CaptureVideoQueue(&LPCPI_CTRL, lpcpi_sensor);
+}
+
+static int32_t LPCPI_GetFrame(ARM_CPI_FRAME_INFO *frame)
+{
+    return CPIx_GetFrame(&LPCPI_CTRL, frame);
+}
+
+static int32_t LPCPI_ReleaseFrame(void *framebuffer)
+{
+    return CPIx_ReleaseFrame(&LPCPI_CTRL, framebuffer);
+}
+
 void LPCPI_IRQHandler(void)
 {
     CPIx_IRQHandler(&LPCPI_CTRL);
@@ -886,6 +1397,9 @@ ARM_DRIVER_CPI Driver_LPCPI =
     LPCPI_CaptureVideo,
     LPCPI_Stop,
     LPCPI_Control,
+    LPCPI_CaptureVideoQueue,
+    LPCPI_GetFrame,
+    LPCPI_ReleaseFrame,
 };
 
 #endif /* End of RTE_LPCPI */
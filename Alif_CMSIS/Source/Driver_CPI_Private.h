@@ -66,12 +66,57 @@ typedef struct _CPI_CONFIG {
     CPI_FIFO_CONFIG                      *fifo;           /**< FIFO Configuration                                 */
 }CPI_CONFIG;
 
+#define CPI_FRAME_QUEUE_MAX_BUFFERS     8U
+#define CPI_FRAME_QUEUE_INVALID_IDX     0xFFU
+
+/**
+ * enum CPI_FRAME_BUF_STATE.
+ * Ownership of a frame queue buffer.
+ */
+typedef enum _CPI_FRAME_BUF_STATE
+{
+    CPI_FRAME_BUF_FREE,                                   /**< Buffer free, may be programmed for capture         */
+    CPI_FRAME_BUF_CAPTURE,                                /**< Buffer programmed or being written by CPI          */
+    CPI_FRAME_BUF_DONE,                                   /**< Buffer holds a completed frame, not yet fetched    */
+    CPI_FRAME_BUF_APP,                                    /**< Buffer owned by the application                    */
+    CPI_FRAME_BUF_DISPLAY                                 /**< Buffer queued to or scanned out by CDC200          */
+} CPI_FRAME_BUF_STATE;
+
+/** \brief CPI Frame Queue Index FIFO */
+typedef struct _CPI_FRAME_FIFO {
+    uint8_t                              idx[CPI_FRAME_QUEUE_MAX_BUFFERS]; /**< Buffer indexes                    */
+    uint8_t                              head;            /**< Read position                                      */
+    uint8_t                              count;           /**< Number of entries                                  */
+} CPI_FRAME_FIFO;
+
+/** \brief CPI Frame Queue */
+typedef struct _CPI_FRAME_QUEUE {
+    void                                 *buffers[CPI_FRAME_QUEUE_MAX_BUFFERS];  /**< Donated frame buffers       */
+    CPI_FRAME_BUF_STATE                  buf_state[CPI_FRAME_QUEUE_MAX_BUFFERS]; /**< Frame buffer ownership      */
+    uint32_t                             buf_seq[CPI_FRAME_QUEUE_MAX_BUFFERS];   /**< Sequence of held frame      */
+    uint32_t                             buf_tstamp[CPI_FRAME_QUEUE_MAX_BUFFERS];/**< Timestamp of held frame     */
+    CPI_FRAME_FIFO                       free;            /**< Free buffers                                       */
+    CPI_FRAME_FIFO                       done;            /**< Completed frames, oldest first                     */
+    uint8_t                              num_buffers;     /**< Number of donated buffers                          */
+    uint8_t                              active;          /**< Buffer being written by CPI                        */
+    uint8_t                              next;            /**< Buffer programmed for the following frame          */
+    uint8_t                              disp_shown;      /**< Buffer scanned out by CDC200                       */
+    uint8_t                              disp_queued;     /**< Buffer handed to CDC200 for next vertical blanking */
+    ARM_CPI_FRAME_QUEUE_POLICY           policy;          /**< Backpressure policy                                */
+    uint32_t                             (*get_timestamp)(void); /**< Timestamp source                            */
+    uint32_t                             sequence;        /**< Captured frame counter                             */
+    uint32_t                             dropped;         /**< Dropped frame counter                              */
+} CPI_FRAME_QUEUE;
+
 /** \brief CPI Status */
 typedef struct CPI_DRIVER_STATE {
     uint32_t initialized       : 1;                       /**< Driver Initialized                                 */
     uint32_t powered           : 1;                       /**< Driver powered                                     */
     uint32_t sensor_configured : 1;                       /**< Camera sensor configured                           */
-    uint32_t reserved          : 29;                      /**< Reserved                                           */
+    uint32_t queue_configured  : 1;                       /**< Frame queue configured                             */
+    uint32_t queue_running     : 1;                       /**< Video capture running on frame queue               */
+    uint32_t display_link      : 1;                       /**< Frame queue linked to CDC200                       */
+    uint32_t reserved          : 26;                      /**< Reserved                                           */
 } CPI_DRIVER_STATE;
 
 /** \brief CPI Device Resource Structure */
@@ -85,6 +130,7 @@ typedef struct _CPI_RESOURCES {
     CPI_ROW_ROUNDUP                       row_roundup;    /**< CPI row roundup                                    */
     CPI_MODE_SELECT                       capture_mode;   /**< CPI capture mode                                   */
     CPI_CONFIG                            *cnfg;          /**< CPI Configurations                                 */
+    CPI_FRAME_QUEUE                       frame_queue;    /**< CPI video frame queue                              */
 } CPI_RESOURCES;
 
 #define DEFAULT_WRITE_WMARK     0x18
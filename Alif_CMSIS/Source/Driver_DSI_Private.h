@@ -36,6 +36,18 @@ extern "C"
 /*Helper macro*/
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
 
+/* Maximum DCS memory write payload per packet, bounded by the generic payload FIFO */
+#define DSI_MEMORY_WRITE_MAX_PAYLOAD        480U
+
+/* Command FIFO wait bound, in microseconds */
+#define DSI_CMD_FIFO_TIMEOUT_US             100000U
+
+/* Bus turn-around wait bound after a TE acknowledge request, in microseconds */
+#define DSI_TE_BTA_TIMEOUT_US               1000U
+
+/* TE trigger wait bound, more than a frame of the slowest panel, in microseconds */
+#define DSI_TE_TIMEOUT_US                   100000U
+
 /** \brief DSI DPHY high speed transition timings */
 typedef struct _DSI_DPHY_HS_TRANSITION_TIMINGS_RANGE {
     uint16_t bitrate_mbps;                             /**< DPHY data rate in mbps */
@@ -52,7 +64,9 @@ typedef volatile struct _DSI_DRIVER_STATE {
     uint32_t host_configured   : 1;                    /**< Driver host configured */
     uint32_t dpi_configured    : 1;                    /**< Driver DPI configured */
     uint32_t panel_initialized : 1;                    /**< Driver panel initialized */
-    uint32_t reserved          : 27;                   /**< Reserved */
+    uint32_t command_mode      : 1;                    /**< Driver in command mode */
+    uint32_t tear_effect       : 1;                    /**< Region updates synced to tearing effect */
+    uint32_t reserved          : 25;                   /**< Reserved */
 } DSI_DRIVER_STATE;
 
 /** \brief DSI DPI Info */
@@ -361,6 +361,438 @@ static int I3cMasterGetFreePos(I3C_RESOURCES *i3c)
   return ARM_DRIVER_ERROR;
 }
 
+/**
+  \fn           int32_t I3cSetBusy(I3C_RESOURCES *i3c)
+  \brief        Mark the driver busy, unless it already is. The i3c IRQ
+                issues IBI follow-up reads on its own, so the check and
+                the update are done with the IRQ disabled.
+  \param[in]    i3c     : Pointer to i3c resources structure
+  \return       \ref execution_status
+*/
+static int32_t I3cSetBusy(I3C_RESOURCES *i3c)
+{
+  int32_t ret = ARM_DRIVER_OK;
+
+  NVIC_DisableIRQ(i3c->irq);
+
+  if (i3c->status.busy)
+    ret = ARM_DRIVER_ERROR_BUSY;
+  else
+    i3c->status.busy = 1;
+
+  NVIC_EnableIRQ(i3c->irq);
+
+  return ret;
+}
+
+/**
+  \fn           void I3cMasterIbiUpdate(I3C_RESOURCES *i3c)
+  \brief        Program the SIR request rejection bits and the IBI
+                interrupt from the slaves with IBIs accepted.
+  \param[in]    i3c     : Pointer to i3c resources structure
+  \return       none
+*/
+static void I3cMasterIbiUpdate(I3C_RESOURCES *i3c)
+{
+  uint32_t accept = 0;
+  uint32_t pos;
+
+  for (pos = 0; pos < i3c->maxdevs; pos++)
+  {
+    if (i3c->ibi.cfg[pos].cb)
+      accept |= BIT(IBI_SIR_REQ_ID(i3c->addrs[pos]));
+  }
+
+  /* addresses sharing a bit with an accepted one are still
+   * rejected through their DAT entry. */
+  i3c_set_sir_reject(i3c->regs, ~accept);
+
+  if (accept)
+    i3c_ibi_intr_enable(i3c->regs);
+  else
+    i3c_ibi_intr_disable(i3c->regs);
+}
+
+/**
+  \fn           int32_t I3cMasterIbiClear(I3C_RESOURCES *i3c, uint32_t pos)
+  \brief        Reject IBIs of the slave at a DAT position again.
+  \param[in]    i3c     : Pointer to i3c resources structure
+  \param[in]    pos     : DAT position
+  \return       \ref execution_status
+*/
+static int32_t I3cMasterIbiClear(I3C_RESOURCES *i3c, uint32_t pos)
+{
+  NVIC_DisableIRQ(i3c->irq);
+
+  /* the follow-up read in progress still uses the config */
+  if (i3c->ibi.read_pos == (int32_t)pos)
+  {
+    NVIC_EnableIRQ(i3c->irq);
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  i3c->ibi.cfg[pos].cb       = NULL;
+  i3c->ibi.cfg[pos].read_len = 0;
+  i3c->ibi.read_pending     &= ~BIT(pos);
+
+  NVIC_EnableIRQ(i3c->irq);
+
+  i3c_dat_set_ibi(i3c->regs, pos, 0, 0);
+  I3cMasterIbiUpdate(i3c);
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn           int32_t I3cMasterIbiSetup(I3C_RESOURCES            *i3c,
+                                          const ARM_I3C_IBI_CONFIG *cfg)
+  \brief        Accept IBIs of an attached i3c slave.
+  \param[in]    i3c     : Pointer to i3c resources structure
+  \param[in]    cfg     : Pointer to IBI configuration
+  \return       \ref execution_status
+*/
+static int32_t I3cMasterIbiSetup(I3C_RESOURCES            *i3c,
+                                 const ARM_I3C_IBI_CONFIG *cfg)
+{
+  int32_t pos;
+
+  if (!cfg || !cfg->cb)
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  if (cfg->read_len && !cfg->read_buf)
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+#if I3C_DMA_ENABLE
+  /* follow-up reads are issued from the IRQ, not through DMA */
+  if (cfg->read_len)
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+  pos = I3cMasterGetAddrPos(i3c, cfg->addr);
+  if (pos < 0)
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  /* legacy i2c slaves have no IBIs */
+  if (i3c_read_dat(i3c->regs, pos) & DEV_ADDR_TABLE_LEGACY_I2C_DEV)
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  /* publish the handler with the IRQ off, it is read by the IRQ */
+  NVIC_DisableIRQ(i3c->irq);
+
+  /* the follow-up read in progress still uses the config */
+  if (i3c->ibi.read_pos == pos)
+  {
+    NVIC_EnableIRQ(i3c->irq);
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  i3c->ibi.cfg[pos]       = *cfg;
+  i3c->ibi.read_pending  &= ~BIT(pos);
+  NVIC_EnableIRQ(i3c->irq);
+
+  i3c_dat_set_ibi(i3c->regs, pos, 1, cfg->with_mdb);
+  I3cMasterIbiUpdate(i3c);
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn           void I3cMasterIbiDrain(I3C_RESOURCES *i3c)
+  \brief        Drain the IBI status queue, pass every slave interrupt
+                request to the handler of its slave and queue the
+                follow-up reads. Called from the i3c IRQ.
+  \param[in]    i3c     : Pointer to i3c resources structure
+  \return       none
+*/
+static void I3cMasterIbiDrain(I3C_RESOURCES *i3c)
+{
+  const ARM_I3C_IBI_CONFIG *cfg;
+  ARM_I3C_IBI               ibi;
+  uint32_t                  n, status, len;
+  int32_t                   pos;
+
+  for (n = i3c_get_ibi_count(i3c->regs); n; n--)
+  {
+    status = i3c_master_read_ibi(i3c->regs, i3c->ibi.payload,
+                                 ARM_I3C_IBI_PAYLOAD_MAX);
+
+    /* skip nacked requests, hot-join and mastership requests */
+    if ((status & IBI_QUEUE_STATUS_NACK) || !IBI_QUEUE_IBI_RNW(status))
+      continue;
+
+    ibi.addr = IBI_QUEUE_IBI_ADDR(status);
+
+    pos = I3cMasterGetAddrPos(i3c, ibi.addr);
+    if (pos < 0)
+      continue;
+
+    cfg = &i3c->ibi.cfg[pos];
+    if (!cfg->cb)
+      continue;
+
+    len = IBI_QUEUE_STATUS_DATA_LEN(status);
+    if (len > ARM_I3C_IBI_PAYLOAD_MAX)
+      len = ARM_I3C_IBI_PAYLOAD_MAX;
+
+    ibi.mdb  = 0;
+    ibi.data = i3c->ibi.payload;
+
+    if (cfg->with_mdb && len)
+    {
+      ibi.mdb = i3c->ibi.payload[0];
+      ibi.data++;
+      len--;
+    }
+    ibi.len = len;
+
+    cfg->cb(ARM_I3C_IBI_EVENT_SIR, &ibi);
+
+    if (cfg->read_len)
+      i3c->ibi.read_pending |= BIT(pos);
+  }
+}
+
+/**
+  \fn           void I3cMasterIbiReadNext(I3C_RESOURCES *i3c)
+  \brief        Issue the next queued IBI follow-up read.
+                Called from the i3c IRQ while the driver is not busy.
+  \param[in]    i3c     : Pointer to i3c resources structure
+  \return       none
+*/
+static void I3cMasterIbiReadNext(I3C_RESOURCES *i3c)
+{
+  const ARM_I3C_IBI_CONFIG *cfg;
+  uint32_t                  pos;
+
+  for (pos = 0; pos < i3c->maxdevs; pos++)
+  {
+    if (i3c->ibi.read_pending & BIT(pos))
+      break;
+  }
+
+  if (pos == i3c->maxdevs)
+    return;
+
+  i3c->ibi.read_pending &= ~BIT(pos);
+  i3c->ibi.read_pos      = pos;
+  i3c->status.busy       = 1;
+
+  cfg = &i3c->ibi.cfg[pos];
+
+  i3c->xfer.rx_buf = cfg->read_buf;
+  i3c->xfer.rx_len = cfg->read_len;
+  i3c->xfer.tx_buf = NULL;
+  i3c->xfer.tx_len = 0;
+
+  i3c_master_rx(i3c->regs, &(i3c->xfer), pos, cfg->read_len);
+}
+
+/**
+  \fn           void I3cMasterIbiReadDone(I3C_RESOURCES *i3c, uint32_t event)
+  \brief        Pass a finished IBI follow-up read to the handler
+                of its slave. Called from the i3c IRQ.
+  \param[in]    i3c     : Pointer to i3c resources structure
+  \param[in]    event   : Transfer event of the read
+  \return       none
+*/
+static void I3cMasterIbiReadDone(I3C_RESOURCES *i3c, uint32_t event)
+{
+  const ARM_I3C_IBI_CONFIG *cfg = &i3c->ibi.cfg[i3c->ibi.read_pos];
+  ARM_I3C_IBI               ibi;
+
+  i3c->ibi.read_pos = I3C_IBI_READ_NONE;
+
+  /* the slave may have been cleared meanwhile */
+  if (!cfg->cb)
+    return;
+
+  ibi.addr = cfg->addr;
+  ibi.mdb  = 0;
+  ibi.len  = i3c->xfer.rx_len;
+  ibi.data = cfg->read_buf;
+
+  if (event == ARM_I3C_EVENT_TRANSFER_DONE)
+    cfg->cb(ARM_I3C_IBI_EVENT_READ_DONE, &ibi);
+  else
+    cfg->cb(ARM_I3C_IBI_EVENT_READ_ERROR, &ibi);
+}
+
+/**
+  \fn           void I3cMasterXferListPush(I3C_RESOURCES *i3c)
+  \brief        Queue the next batch of a transfer list, as many
+                transfers as the command queue and the data buffers
+                hold. Called with the i3c IRQ disabled or from it.
+  \param[in]    i3c     : Pointer to i3c resources structure
+  \return       none
+*/
+static void I3cMasterXferListPush(I3C_RESOURCES *i3c)
+{
+  I3C_XFER_LIST_INFO *list = &i3c->list;
+  ARM_I3C_XFER_DESC  *desc;
+  uint32_t            cmd, tx, rx, words, cnt, i;
+
+  /* the buffers are empty between batches */
+  cmd = i3c_get_cmd_empty_loc(i3c->regs);
+  tx  = i3c_get_tx_empty_loc(i3c->regs);
+  rx  = i3c_get_rx_buf_size(i3c->regs);
+
+  /* every transfer takes two command queue locations */
+  for (cnt = 0; (list->next + cnt) < list->num; cnt++)
+  {
+    desc  = &list->xfers[list->next + cnt];
+    words = DIV_ROUND_UP(desc->len, 4);
+
+    if (cmd < 2)
+      break;
+
+    if (desc->rnw)
+    {
+      if (words > rx)
+        break;
+      rx -= words;
+    }
+    else
+    {
+      if (words > tx)
+        break;
+      tx -= words;
+    }
+    cmd -= 2;
+  }
+
+  /* one interrupt for the whole batch, or on an error */
+  i3c_set_resp_thld(i3c->regs, cnt);
+
+  for (i = 0; i < cnt; i++)
+  {
+    desc = &list->xfers[list->next + i];
+
+    i3c->xfer.tx_buf = desc->rnw ? NULL : desc->data;
+    i3c->xfer.tx_len = desc->rnw ? 0 : desc->len;
+
+    i3c_master_list_cmd(i3c->regs, &(i3c->xfer),
+                        I3cMasterGetAddrPos(i3c, desc->addr),
+                        desc->rnw, desc->len, (i == (cnt - 1)));
+  }
+
+  list->next += cnt;
+}
+
+/**
+  \fn           int32_t I3cMasterXferListStart(I3C_RESOURCES     *i3c,
+                                               ARM_I3C_XFER_LIST *xfer_list)
+  \brief        Start a list of private transfers.
+  \param[in]    i3c       : Pointer to i3c resources structure
+  \param[in]    xfer_list : Pointer to transfer list
+  \return       \ref execution_status
+*/
+static int32_t I3cMasterXferListStart(I3C_RESOURCES     *i3c,
+                                      ARM_I3C_XFER_LIST *xfer_list)
+{
+  ARM_I3C_XFER_DESC *desc;
+  uint32_t           i, words, max;
+
+#if I3C_DMA_ENABLE
+  /* the list data goes through the buffers from the IRQ */
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+
+  if (!xfer_list || !xfer_list->xfers || !xfer_list->num)
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  for (i = 0; i < xfer_list->num; i++)
+  {
+    desc = &xfer_list->xfers[i];
+
+    if (!desc->data || !desc->len)
+      return ARM_DRIVER_ERROR_PARAMETER;
+
+    if (I3cMasterGetAddrPos(i3c, desc->addr) < 0)
+      return ARM_DRIVER_ERROR_PARAMETER;
+
+    /* every transfer has to fit in the buffers on its own */
+    words = DIV_ROUND_UP(desc->len, 4);
+    max   = desc->rnw ? i3c_get_rx_buf_size(i3c->regs) :
+                        i3c_get_tx_buf_size(i3c->regs);
+    if (words > max)
+      return ARM_DRIVER_ERROR_PARAMETER;
+
+    desc->actual = 0;
+    desc->status = ARM_I3C_XFER_NOT_RUN;
+  }
+
+  if (I3cSetBusy(i3c))
+    return ARM_DRIVER_ERROR_BUSY;
+
+  /* the IRQ takes over once the first batch is queued */
+  NVIC_DisableIRQ(i3c->irq);
+
+  i3c->list.num   = xfer_list->num;
+  i3c->list.next  = 0;
+  i3c->list.done  = 0;
+  i3c->list.xfers = xfer_list->xfers;
+
+  I3cMasterXferListPush(i3c);
+
+  NVIC_EnableIRQ(i3c->irq);
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn           void I3cMasterXferListIrq(I3C_RESOURCES *i3c)
+  \brief        Take the responses of a transfer list and queue the next
+                batch; once the list is through or failed, set the
+                transfer status. Called from the i3c IRQ.
+  \param[in]    i3c     : Pointer to i3c resources structure
+  \return       none
+*/
+static void I3cMasterXferListIrq(I3C_RESOURCES *i3c)
+{
+  I3C_XFER_LIST_INFO *list = &i3c->list;
+  ARM_I3C_XFER_DESC  *desc;
+  uint32_t            n, resp;
+
+  for (n = i3c_get_resp_count(i3c->regs); n && (list->done < list->next); n--)
+  {
+    desc = &list->xfers[list->done++];
+
+    resp = i3c_master_read_resp(i3c->regs, desc->rnw ? desc->data : NULL,
+                                desc->len);
+
+    desc->status = RESPONSE_PORT_ERR_STATUS(resp);
+    desc->actual = desc->rnw ? RESPONSE_PORT_DATA_LEN(resp) : 0;
+
+    if (desc->status != ARM_I3C_XFER_OK)
+    {
+      /* drop the rest of the list, the controller is
+       * resumed by the transfer error handling. */
+      i3c_flush_xfer_queues(i3c->regs);
+
+      list->xfers       = NULL;
+      i3c->xfer.status  = I3C_XFER_STATUS_ERROR;
+      return;
+    }
+  }
+
+  /* batch not through yet? an IBI or an early interrupt may have
+   * taken part of it, wait for the responses still to come. */
+  if (list->done < list->next)
+  {
+    i3c_set_resp_thld(i3c->regs, list->next - list->done);
+    return;
+  }
+
+  if (list->next < list->num)
+  {
+    I3cMasterXferListPush(i3c);
+    return;
+  }
+
+  list->xfers      = NULL;
+  i3c->xfer.status = I3C_XFER_STATUS_DONE;
+}
+
 /**
   \fn           ARM_DRIVER_VERSION I3C_GetVersion(void)
   \brief        Get i3c driver version
@@ -399,9 +831,6 @@ static int I3Cx_MasterSendCommand(I3C_RESOURCES *i3c, I3C_CMD *ccc)
   if (i3c->state.powered == 0U)
     return ARM_DRIVER_ERROR;
 
-  if (i3c->status.busy)
-    return ARM_DRIVER_ERROR_BUSY;
-
   if (!ccc)
     return ARM_DRIVER_ERROR_PARAMETER;
 
@@ -412,7 +841,8 @@ static int I3Cx_MasterSendCommand(I3C_RESOURCES *i3c, I3C_CMD *ccc)
   if (index < 0)
     return ARM_DRIVER_ERROR;
 
-  i3c->status.busy = 1;
+  if (I3cSetBusy(i3c))
+    return ARM_DRIVER_ERROR_BUSY;
 
   if (ccc->rw) /* command read */
   {
@@ -489,14 +919,12 @@ static int I3Cx_MasterTransmit(I3C_RESOURCES *i3c,  uint8_t  addr,
   if (!data || !len)
     return ARM_DRIVER_ERROR_PARAMETER;
 
-  if (i3c->status.busy)
-    return ARM_DRIVER_ERROR_BUSY;
-
   index = I3cMasterGetAddrPos(i3c, addr);
   if (index < 0)
     return ARM_DRIVER_ERROR_PARAMETER;
 
-  i3c->status.busy = 1;
+  if (I3cSetBusy(i3c))
+    return ARM_DRIVER_ERROR_BUSY;
 
 #if (!I3C_DMA_ENABLE) /* update only if DMA disable */
   i3c->xfer.rx_buf = NULL;
@@ -547,14 +975,12 @@ static int I3Cx_MasterReceive(I3C_RESOURCES *i3c,  uint8_t  addr,
   if (!data || !len)
     return ARM_DRIVER_ERROR_PARAMETER;
 
-  if (i3c->status.busy)
-    return ARM_DRIVER_ERROR_BUSY;
-
   index = I3cMasterGetAddrPos(i3c, addr);
   if (index < 0)
     return ARM_DRIVER_ERROR_PARAMETER;
 
-  i3c->status.busy = 1;
+  if (I3cSetBusy(i3c))
+    return ARM_DRIVER_ERROR_BUSY;
 
 #if (!I3C_DMA_ENABLE) /* update only if DMA disable */
   i3c->xfer.rx_buf = data;
@@ -724,11 +1150,9 @@ static int I3Cx_MasterAssignDA(I3C_RESOURCES *i3c,
   if (i3c->state.powered == 0U)
     return ARM_DRIVER_ERROR;
 
-  if (i3c->status.busy)
+  if (I3cSetBusy(i3c))
     return ARM_DRIVER_ERROR_BUSY;
 
-  i3c->status.busy = 1;
-
   /* Find the first unused index in freepos, note that this also
    * corresponds to the first unused location in the DAT
    */
@@ -830,6 +1254,13 @@ static int I3Cx_Detachdev(I3C_RESOURCES *i3c, uint8_t addr)
     return ARM_DRIVER_ERROR;
   }
 
+  /* stop accepting IBIs of the slave */
+  if (i3c->ibi.cfg[pos].cb)
+  {
+    if (I3cMasterIbiClear(i3c, pos) != ARM_DRIVER_OK)
+      return ARM_DRIVER_ERROR_BUSY;
+  }
+
   /* free the index */
   i3c->freepos |= (BIT(pos));
   i3c->addrs[pos] = 0;
@@ -870,6 +1301,10 @@ static int32_t I3Cx_Control(I3C_RESOURCES *i3c,
 
     i3c_master_init(i3c->regs);
 
+    /* master init rejects all IBIs */
+    memset(&i3c->ibi, 0, sizeof(i3c->ibi));
+    i3c->ibi.read_pos = I3C_IBI_READ_NONE;
+
     /* set state as master enabled. */
     i3c->state.master_enabled = 1;
 
@@ -927,6 +1362,34 @@ static int32_t I3Cx_Control(I3C_RESOURCES *i3c,
       i3c->state.slave_enabled = 1;
       break;
 
+  case I3C_MASTER_SET_IBI:
+
+    if (i3c->state.master_enabled == 0U)
+      return ARM_DRIVER_ERROR;
+
+    return I3cMasterIbiSetup(i3c, (const ARM_I3C_IBI_CONFIG *)arg);
+
+  case I3C_MASTER_CLEAR_IBI:
+  {
+    int32_t pos;
+
+    if (i3c->state.master_enabled == 0U)
+      return ARM_DRIVER_ERROR;
+
+    pos = I3cMasterGetAddrPos(i3c, (uint8_t)arg);
+    if (!arg || (pos < 0))
+      return ARM_DRIVER_ERROR_PARAMETER;
+
+    return I3cMasterIbiClear(i3c, pos);
+  }
+
+  case I3C_MASTER_XFER_LIST:
+
+    if (i3c->state.master_enabled == 0U)
+      return ARM_DRIVER_ERROR;
+
+    return I3cMasterXferListStart(i3c, (ARM_I3C_XFER_LIST *)arg);
+
   default:
     return ARM_DRIVER_ERROR_UNSUPPORTED;
   }
@@ -1210,6 +1673,7 @@ static I3C_RESOURCES i3c =
   .regs         = (I3C_Type *)I3C_BASE,
   .cb_event     = NULL,
   .xfer         = {0},
+  .ibi          = {.read_pos = I3C_IBI_READ_NONE},
   .status       = {0},
   .state        = {0},
   .irq          = (IRQn_Type) I3C_IRQ_IRQn,
@@ -1241,7 +1705,15 @@ void I3C_IRQHandler(void)
   I3C_XFER *xfer = &(i3c.xfer);
   uint32_t event = 0;
 
-  i3c_irq_handler(i3c.regs, xfer);
+  /* in-band interrupts first, they are queued apart from responses */
+  if (i3c.state.master_enabled && i3c_get_ibi_count(i3c.regs))
+    I3cMasterIbiDrain(&i3c);
+
+  /* transfer list? its responses are taken apart */
+  if (i3c.list.xfers)
+    I3cMasterXferListIrq(&i3c);
+  else
+    i3c_irq_handler(i3c.regs, xfer);
 
   /* check status: Transfer Error? */
   if(xfer->status & I3C_XFER_STATUS_ERROR)
@@ -1317,10 +1789,18 @@ void I3C_IRQHandler(void)
     /* clear busy flag. */
     i3c.status.busy = 0;
 
+    /* IBI follow-up read? pass it to the handler of the slave */
+    if(i3c.ibi.read_pos != I3C_IBI_READ_NONE)
+      I3cMasterIbiReadDone(&i3c, event);
+
     /* call the user callback */
-    if(i3c.cb_event)
+    else if(i3c.cb_event)
       i3c.cb_event(event);
   }
+
+  /* issue queued IBI follow-up reads once the bus is free */
+  if(i3c.ibi.read_pending && !i3c.status.busy)
+    I3cMasterIbiReadNext(&i3c);
 }
 
 /* wrapper functions for I3C */
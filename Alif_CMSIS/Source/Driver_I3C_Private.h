@@ -46,6 +46,30 @@ typedef volatile struct _I3C_DRIVER_STATE
   uint32_t reserved       : 28;/* Reserved              */
 } I3C_DRIVER_STATE;
 
+#define I3C_IBI_READ_NONE  (-1)
+
+/**
+\brief I3C IBI handling, per DAT position
+*/
+typedef struct _I3C_IBI_INFO
+{
+  ARM_I3C_IBI_CONFIG  cfg[MAX_DEVS];                    /* IBI acceptance, cb NULL = rejected         */
+  volatile uint32_t   read_pending;                     /* DAT positions with a follow-up read queued */
+  volatile int32_t    read_pos;                         /* DAT position of the follow-up read in flight */
+  uint8_t             payload[ARM_I3C_IBI_PAYLOAD_MAX]; /* payload of the IBI being dispatched        */
+} I3C_IBI_INFO;
+
+/**
+\brief I3C transfer list in progress
+*/
+typedef struct _I3C_XFER_LIST_INFO
+{
+  ARM_I3C_XFER_DESC  *volatile xfers;  /* transfers, NULL = no list running        */
+  uint32_t                     num;    /* number of transfers                      */
+  uint32_t                     next;   /* next transfer to queue                   */
+  uint32_t                     done;   /* next transfer to get the response of     */
+} I3C_XFER_LIST_INFO;
+
 #if I3C_DMA_ENABLE
 typedef struct _I3C_DMA_HW_CONFIG
 {
@@ -72,6 +96,8 @@ typedef struct _I3C_RESOURCES
   uint8_t                addrs[MAX_DEVS];  /* Assigned dynamic(i3c) or static address(i2c slave) */
   uint32_t               freepos;          /* bitmask of used addresses                          */
   I3C_XFER               xfer;             /* i3c transfer structure                             */
+  I3C_IBI_INFO           ibi;              /* i3c in-band interrupt handling                     */
+  I3C_XFER_LIST_INFO     list;             /* i3c transfer list                                  */
   ARM_I3C_STATUS         status;           /* i3c driver status                                  */
   I3C_DRIVER_STATE       state;            /* I3C driver state                                   */
   IRQn_Type              irq;              /* i3c interrupt number                               */
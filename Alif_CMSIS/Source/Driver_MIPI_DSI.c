@@ -25,7 +25,7 @@
 #include "DPHY_init.h"
 #include "display.h"
 
-#define ARM_MIPI_DSI_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0) /*driver version*/
+#define ARM_MIPI_DSI_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 1) /*driver version*/
 
 #if !(RTE_MIPI_DSI)
 #error "MIPI DSI is not enabled in the RTE_Device.h"
@@ -77,6 +77,7 @@ static const ARM_MIPI_DSI_CAPABILITIES DriverCapabilities =
     0, /* Not supports reentrant_operation */
     1, /* DPI interface supported*/
     0, /* DBI interface not supported*/
+    1, /* Command mode partial update supported*/
     0  /* reserved (must be zero) */
 };
 
@@ -425,6 +426,144 @@ static int32_t DSI_ConfigureDPI (DISPLAY_PANEL_DEVICE *display_panel, DSI_RESOUR
     return ARM_DRIVER_OK;
 }
 
+/**
+  \fn          int32_t DSI_WaitCmdFifoEmpty (DSI_RESOURCES *dsi)
+  \brief       Wait for all the queued generic packets to be sent.
+  \param[in]   dsi Pointer to DSI resources.
+  \return      \ref execution_status.
+  */
+static int32_t DSI_WaitCmdFifoEmpty (DSI_RESOURCES *dsi)
+{
+    uint32_t timeout = DSI_CMD_FIFO_TIMEOUT_US;
+
+    while(!dsi_gen_cmd_fifo_empty(dsi->reg_base))
+    {
+        if(timeout-- == 0U)
+        {
+            return ARM_DRIVER_ERROR_TIMEOUT;
+        }
+        sys_busy_loop_us(1);
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t DSI_WaitPacketRoom (DSI_RESOURCES *dsi)
+  \brief       Wait for room for one long packet of up to DSI_MEMORY_WRITE_MAX_PAYLOAD
+               bytes, so that queueing it does not block.
+  \param[in]   dsi Pointer to DSI resources.
+  \return      \ref execution_status.
+  */
+static int32_t DSI_WaitPacketRoom (DSI_RESOURCES *dsi)
+{
+    uint32_t timeout = DSI_CMD_FIFO_TIMEOUT_US;
+
+    while(dsi_gen_cmd_fifo_full(dsi->reg_base) || !dsi_gen_pld_write_fifo_empty(dsi->reg_base))
+    {
+        if(timeout-- == 0U)
+        {
+            return ARM_DRIVER_ERROR_TIMEOUT;
+        }
+        sys_busy_loop_us(1);
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t DSI_WaitTearEffect (DSI_RESOURCES *dsi)
+  \brief       Wait for the TE trigger answering a queued TE acknowledge request.
+               The panel takes the bus at the turn-around following the request
+               and keeps it until V-Blank, then sends the trigger and hands the
+               bus back.
+  \param[in]   dsi Pointer to DSI resources.
+  \return      \ref execution_status.
+  */
+static int32_t DSI_WaitTearEffect (DSI_RESOURCES *dsi)
+{
+    uint32_t timeout;
+    int32_t ret;
+
+    ret = DSI_WaitCmdFifoEmpty(dsi);
+    if(ret != ARM_DRIVER_OK)
+    {
+        return ret;
+    }
+
+    /* Turn-around to the panel; not seen if the panel was already in
+     * V-Blank and gave the bus back between two polls. */
+    for(timeout = DSI_TE_BTA_TIMEOUT_US; timeout && !dsi_phy_direction_rx(dsi->reg_base); timeout--)
+    {
+        sys_busy_loop_us(1);
+    }
+
+    /* Bus back to the host, in stop state */
+    timeout = DSI_TE_TIMEOUT_US;
+
+    while(dsi_phy_direction_rx(dsi->reg_base) ||
+          (dsi_get_lane_stopstate_status(dsi->reg_base, DSI_LANE_0) == DSI_LANE_STOPSTATE_OFF))
+    {
+        if(timeout-- == 0U)
+        {
+            return ARM_DRIVER_ERROR_TIMEOUT;
+        }
+        sys_busy_loop_us(1);
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t DSI_ConfigureTearEffect (uint32_t enable, DISPLAY_PANEL_DEVICE *display_panel,
+                                                DSI_RESOURCES *dsi)
+  \brief       Enable or disable tearing effect synchronization of region updates.
+               The panel reports TE in-band, so bus turn-around is enabled along with it.
+  \param[in]   enable 1 to enable, 0 to disable.
+  \param[in]   display_panel Pointer to display panel resources.
+  \param[in]   dsi Pointer to DSI resources.
+  \return      \ref execution_status.
+  */
+static int32_t DSI_ConfigureTearEffect (uint32_t enable, DISPLAY_PANEL_DEVICE *display_panel,
+                                        DSI_RESOURCES *dsi)
+{
+    int32_t ret;
+
+    if(dsi->state.command_mode == 0)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
+    if(enable > 1)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    if(enable)
+    {
+        dsi_bta_enable(dsi->reg_base);
+
+        /* TE output on V-Blank only */
+        dsi_dcs_short_write(dsi->reg_base, DSI_DCS_SET_TEAR_ON, 0, display_panel->dsi_info->vc_id);
+    }
+    else
+    {
+        dsi_dcs_cmd_short_write(dsi->reg_base, DSI_DCS_SET_TEAR_OFF, display_panel->dsi_info->vc_id);
+
+        ret = DSI_WaitCmdFifoEmpty(dsi);
+        if(ret != ARM_DRIVER_OK)
+        {
+            return ret;
+        }
+
+        dsi_bta_disable(dsi->reg_base);
+    }
+
+    dsi->state.tear_effect = enable;
+
+    return ARM_DRIVER_OK;
+}
+
 /**
   \fn          int32_t DSI_Control (ARM_MIPI_DSI_CONTROL control, uint32_t arg,
                                     DISPLAY_PANEL_DEVICE *display_panel, DSI_RESOURCES *dsi)
@@ -438,7 +577,6 @@ static int32_t DSI_ConfigureDPI (DISPLAY_PANEL_DEVICE *display_panel, DSI_RESOUR
 static int32_t DSI_Control (ARM_MIPI_DSI_CONTROL control, uint32_t arg,
                             DISPLAY_PANEL_DEVICE *display_panel,DSI_RESOURCES *dsi)
 {
-    ARG_UNUSED(arg);
     int32_t ret = ARM_DRIVER_OK;
 
     switch(control)
@@ -463,6 +601,16 @@ static int32_t DSI_Control (ARM_MIPI_DSI_CONTROL control, uint32_t arg,
             break;
         }
 
+        case DSI_CONFIGURE_TEAR_EFFECT:
+        {
+            ret = DSI_ConfigureTearEffect(arg, display_panel, dsi);
+            if(ret != ARM_DRIVER_OK)
+            {
+                return ret;
+            }
+            break;
+        }
+
         default:
         {
             return ARM_DRIVER_ERROR_UNSUPPORTED;
@@ -564,6 +712,7 @@ static int32_t DSI_StartCommandMode (DISPLAY_PANEL_DEVICE *display_panel, DSI_RE
     }
 
     dsi->state.panel_initialized = 1;
+    dsi->state.command_mode = 1;
 
     return ret;
 }
@@ -584,6 +733,8 @@ static int32_t DSI_StartVideoMode (DISPLAY_PANEL_DEVICE *display_panel, DSI_RESO
         return ARM_DRIVER_ERROR;
     }
 
+    dsi->state.command_mode = 0;
+
     dsi_power_up_disable(dsi->reg_base);
 
     dsi_auto_clklane_disable(dsi->reg_base);
@@ -620,6 +771,9 @@ static int32_t DSI_Stop (DISPLAY_PANEL_DEVICE *display_panel, DSI_RESOURCES *dsi
         return ARM_DRIVER_ERROR;
     }
 
+    dsi->state.command_mode = 0;
+    dsi->state.tear_effect  = 0;
+
     dsi_power_up_disable(dsi->reg_base);
 
     /*Stop LCD Panel*/
@@ -632,6 +786,138 @@ static int32_t DSI_Stop (DISPLAY_PANEL_DEVICE *display_panel, DSI_RESOURCES *dsi
     return ret;
 }
 
+/**
+  \fn          int32_t  DSI_UpdateRegion (const ARM_MIPI_DSI_REGION *region,
+                                          DISPLAY_PANEL_DEVICE *display_panel, DSI_RESOURCES *dsi)
+  \brief       Transfer a rectangular framebuffer region to a command mode panel.
+               The panel address window is set to the region with DCS set_column_address
+               and set_page_address, then only the region lines are sent with
+               write_memory_start / write_memory_continue.
+  \param[in]   region Pointer to region information.
+  \param[in]   display_panel Pointer to display panel resources.
+  \param[in]   dsi  Pointer to DSI resources.
+  \return      \ref execution_status.
+*/
+static int32_t DSI_UpdateRegion (const ARM_MIPI_DSI_REGION *region,
+                                 DISPLAY_PANEL_DEVICE *display_panel, DSI_RESOURCES *dsi)
+{
+    uint8_t vc_id = display_panel->dsi_info->vc_id;
+    uint8_t addr[4];
+    uint8_t cmd = DSI_DCS_WRITE_MEMORY_START;
+    uint32_t bpp;
+    uint32_t line_bytes;
+    uint32_t max_chunk;
+    uint32_t x_end, y_end;
+    int32_t ret;
+
+    if(dsi->state.command_mode == 0)
+    {
+        return ARM_DRIVER_ERROR;
+    }
+
+    if((region == NULL) || (region->framebuffer == NULL) ||
+       (region->width == 0) || (region->height == 0))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    x_end = (uint32_t)region->x + region->width - 1;
+    y_end = (uint32_t)region->y + region->height - 1;
+
+    if((x_end >= display_panel->hactive_time) || (y_end >= display_panel->vactive_line))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    bpp = (display_panel->dsi_info->color_coding == DSI_COLOR_CODING_16_BIT) ? 2U : 3U;
+    line_bytes = region->width * bpp;
+
+    if(region->stride < (((uint32_t)region->x + region->width) * bpp))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    /* Split lines into whole pixel packets that fit in the payload FIFO */
+    max_chunk = (DSI_MEMORY_WRITE_MAX_PAYLOAD / bpp) * bpp;
+
+    /* Every packet below is queued only once the FIFOs have room for it,
+     * so that the low level writes never wait on the FIFOs unbounded. */
+    ret = DSI_WaitPacketRoom(dsi);
+    if(ret != ARM_DRIVER_OK)
+    {
+        return ret;
+    }
+
+    addr[0] = (uint8_t)(region->x >> 8);
+    addr[1] = (uint8_t)region->x;
+    addr[2] = (uint8_t)(x_end >> 8);
+    addr[3] = (uint8_t)x_end;
+    dsi_dcs_long_write_buffer(dsi->reg_base, DSI_DCS_SET_COLUMN_ADDRESS, addr, sizeof(addr), vc_id);
+
+    ret = DSI_WaitPacketRoom(dsi);
+    if(ret != ARM_DRIVER_OK)
+    {
+        return ret;
+    }
+
+    addr[0] = (uint8_t)(region->y >> 8);
+    addr[1] = (uint8_t)region->y;
+    addr[2] = (uint8_t)(y_end >> 8);
+    addr[3] = (uint8_t)y_end;
+    dsi_dcs_long_write_buffer(dsi->reg_base, DSI_DCS_SET_PAGE_ADDRESS, addr, sizeof(addr), vc_id);
+
+    if(dsi->state.tear_effect)
+    {
+        /* Request a TE acknowledge on a NOP and start the memory writes
+         * only once the TE trigger is back, at V-Blank. */
+        ret = DSI_WaitCmdFifoEmpty(dsi);
+        if(ret != ARM_DRIVER_OK)
+        {
+            return ret;
+        }
+
+        dsi_tear_effect_ack_enable(dsi->reg_base);
+
+        dsi_dcs_cmd_short_write(dsi->reg_base, DSI_DCS_NOP, vc_id);
+
+        ret = DSI_WaitTearEffect(dsi);
+
+        dsi_tear_effect_ack_disable(dsi->reg_base);
+
+        if(ret != ARM_DRIVER_OK)
+        {
+            return ret;
+        }
+    }
+
+    for(uint32_t line = 0; line < region->height; line++)
+    {
+        const uint8_t *src = (const uint8_t *)region->framebuffer +
+                             (((uint32_t)region->y + line) * region->stride) +
+                             ((uint32_t)region->x * bpp);
+        uint32_t remaining = line_bytes;
+
+        while(remaining)
+        {
+            uint32_t len = (remaining > max_chunk) ? max_chunk : remaining;
+
+            ret = DSI_WaitPacketRoom(dsi);
+            if(ret != ARM_DRIVER_OK)
+            {
+                return ret;
+            }
+
+            dsi_dcs_long_write_buffer(dsi->reg_base, cmd, src, len, vc_id);
+
+            cmd = DSI_DCS_WRITE_MEMORY_CONTINUE;
+            src += len;
+            remaining -= len;
+        }
+    }
+
+    return ARM_DRIVER_OK;
+}
+
 /**
   \fn          void MIPI_DSI_ISR (DSI_RESOURCES *dsi)
   \brief       MIPI DSI interrupt service routine
@@ -810,6 +1096,17 @@ static int32_t ARM_MIPI_DSI_Stop (void)
     return DSI_Stop (display_panel, &DSI_RES);
 }
 
+/**
+  \fn          int32_t  ARM_MIPI_DSI_UpdateRegion (const ARM_MIPI_DSI_REGION *region)
+  \brief       Transfer a rectangular framebuffer region to a command mode panel.
+  \param[in]   region Pointer to region information.
+  \return      \ref execution_status
+*/
+static int32_t ARM_MIPI_DSI_UpdateRegion (const ARM_MIPI_DSI_REGION *region)
+{
+    return DSI_UpdateRegion (region, display_panel, &DSI_RES);
+}
+
 /**
   \fn          void DSI_IRQHandler (void)
   \brief       DSi IRQ Handler.
@@ -834,5 +1131,6 @@ ARM_DRIVER_MIPI_DSI Driver_MIPI_DSI =
     ARM_MIPI_DSI_Control,
     ARM_MIPI_DSI_StartCommandMode,
     ARM_MIPI_DSI_StartVideoMode,
-    ARM_MIPI_DSI_Stop
+    ARM_MIPI_DSI_Stop,
+    ARM_MIPI_DSI_UpdateRegion
 };
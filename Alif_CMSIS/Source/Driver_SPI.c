@@ -621,6 +621,17 @@ static int32_t ARM_SPI_Send(SPI_RESOURCES *SPI, const void *data, uint32_t num)
         return ARM_DRIVER_ERROR_PARAMETER;
     }
 
+    /* If the Frame size is more than 16, check if it is aligned to 4 bytes */
+    if ((SPI->transfer.frame_size > 16) && ((uint32_t)data & 0x3U) != 0U)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    /* If the Frame size is more than 8 and less than 16, check if it is aligned to 2 bytes */
+    if ((SPI->transfer.frame_size > 8) && ((uint32_t)data & 0x1U) != 0U)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
     if (SPI->status.busy)
     {
         return ARM_DRIVER_ERROR_BUSY;
@@ -634,6 +645,9 @@ static int32_t ARM_SPI_Send(SPI_RESOURCES *SPI, const void *data, uint32_t num)
     SPI->transfer.status         = SPI_TRANSFER_STATUS_NONE;
     SPI->transfer.mode           = SPI_TMOD_TX;
 
+    /* Pick the Tx/Rx FIFO routines of the interrupt handler once */
+    spi_set_fifo_handlers(&SPI->transfer);
+
 #if SPI_MICROWIRE_FRF_ENABLE
     if (SPI->mw_enable)
     {
@@ -652,17 +666,6 @@ static int32_t ARM_SPI_Send(SPI_RESOURCES *SPI, const void *data, uint32_t num)
     }
 #endif
 
-    /* If the Frame size is more than 16, check if it is aligned to 4 bytes */
-    if ((SPI->transfer.frame_size > 16) && ((uint32_t)data & 0x3U) != 0U)
-    {
-        return ARM_DRIVER_ERROR_PARAMETER;
-    }
-    /* If the Frame size is more than 8 and less than 16, check if it is aligned to 2 bytes */
-    if ((SPI->transfer.frame_size > 8) && ((uint32_t)data & 0x1U) != 0U)
-    {
-        return ARM_DRIVER_ERROR_PARAMETER;
-    }
-
 #if SPI_DMA_ENABLE
     /* Check if DMA is enabled */
     if (SPI->dma_enable)
@@ -776,6 +779,17 @@ static int32_t ARM_SPI_Receive(SPI_RESOURCES *SPI, void *data, uint32_t num)
         return ARM_DRIVER_ERROR_PARAMETER;
     }
 
+    /* If the Frame size is more than 16, check if it is aligned to 4 bytes */
+    if ((SPI->transfer.frame_size > 16) && ((uint32_t)data & 0x3U) != 0U)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    /* If the Frame size is more than 8 and less than 16, check if it is aligned to 2 bytes */
+    if ((SPI->transfer.frame_size > 8) && ((uint32_t)data & 0x1U) != 0U)
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
 #if SPI_MICROWIRE_FRF_ENABLE
     if (SPI->mw_enable)
     {
@@ -799,6 +813,9 @@ static int32_t ARM_SPI_Receive(SPI_RESOURCES *SPI, void *data, uint32_t num)
     SPI->transfer.status          = SPI_TRANSFER_STATUS_NONE;
     SPI->transfer.mode            = SPI_TMOD_RX;
 
+    /* Pick the Tx/Rx FIFO routines of the interrupt handler once */
+    spi_set_fifo_handlers(&SPI->transfer);
+
     spi_set_rx_threshold(SPI->regs, SPI->rx_fifo_threshold);
 
 #if SPI_MICROWIRE_FRF_ENABLE
@@ -819,17 +836,6 @@ static int32_t ARM_SPI_Receive(SPI_RESOURCES *SPI, void *data, uint32_t num)
     }
 #endif
 
-    /* If the Frame size is more than 16, check if it is aligned to 4 bytes */
-    if ((SPI->transfer.frame_size > 16) && ((uint32_t)data & 0x3U) != 0U)
-    {
-        return ARM_DRIVER_ERROR_PARAMETER;
-    }
-    /* If the Frame size is more than 8 and less than 16, check if it is aligned to 2 bytes */
-    if ((SPI->transfer.frame_size > 8) && ((uint32_t)data & 0x1U) != 0U)
-    {
-        return ARM_DRIVER_ERROR_PARAMETER;
-    }
-
 #if SPI_DMA_ENABLE
     ARM_DMA_PARAMS rx_dma_params;
 
@@ -955,6 +961,17 @@ static int32_t ARM_SPI_Transfer(SPI_RESOURCES *SPI, const void *data_out, void *
         return ARM_DRIVER_ERROR_PARAMETER;
     }
 
+    /* If the Frame size is more than 16, check if both buffers are aligned to 4 bytes */
+    if ((SPI->transfer.frame_size > 16) && ((((uint32_t)data_in & 0x3U) != 0U) || (((uint32_t)data_out & 0x3U) != 0U)))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    /* If the Frame size is more than 8 and less than 16, check if both buffers are aligned to 2 bytes */
+    if ((SPI->transfer.frame_size > 8) && ((((uint32_t)data_in & 0x1U) != 0U) || (((uint32_t)data_out & 0x1U) != 0U)))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
     if (SPI->status.busy)
     {
         return ARM_DRIVER_ERROR_BUSY;
@@ -971,6 +988,9 @@ static int32_t ARM_SPI_Transfer(SPI_RESOURCES *SPI, const void *data_out, void *
     SPI->transfer.status         = SPI_TRANSFER_STATUS_NONE;
     SPI->transfer.mode           = SPI_TMOD_TX_AND_RX;
 
+    /* Pick the Tx/Rx FIFO routines of the interrupt handler once */
+    spi_set_fifo_handlers(&SPI->transfer);
+
     spi_set_rx_threshold(SPI->regs, SPI->rx_fifo_threshold);
 
 #if SPI_MICROWIRE_FRF_ENABLE
@@ -990,17 +1010,6 @@ static int32_t ARM_SPI_Transfer(SPI_RESOURCES *SPI, const void *data_out, void *
     }
 #endif
 
-    /* If the Frame size is more than 16, check if it is aligned to 4 bytes */
-    if ((SPI->transfer.frame_size > 16) && ((((uint32_t)data_in & 0x3U) != 0U) && (((uint32_t)data_out & 0x3U) != 0U)))
-    {
-        return ARM_DRIVER_ERROR_PARAMETER;
-    }
-    /* If the Frame size is more than 8 and less than 16, check if it is aligned to 2 bytes */
-    if ((SPI->transfer.frame_size > 8) && ((((uint32_t)data_in & 0x1U) != 0U) && (((uint32_t)data_out & 0x1U) != 0U)))
-    {
-        return ARM_DRIVER_ERROR_PARAMETER;
-    }
-
 #if SPI_DMA_ENABLE
     ARM_DMA_PARAMS tx_dma_params, rx_dma_params;
 
@@ -1164,6 +1173,216 @@ static uint32_t ARM_SPI_GetDataCount(SPI_RESOURCES *SPI)
     return count;
 }
 
+/**
+ * @fn      int32_t SPI_Queue_Check(SPI_RESOURCES *SPI, const ARM_SPI_TRANSFER_QUEUE *queue)
+ * @brief   Validate all entries of a transaction queue before it is started.
+ * @note    none.
+ * @param   SPI : Pointer to spi resources structure.
+ * @param   queue : Pointer to the transaction queue.
+ * @retval  \ref execution_status
+ */
+static int32_t SPI_Queue_Check(SPI_RESOURCES *SPI, const ARM_SPI_TRANSFER_QUEUE *queue)
+{
+    const ARM_SPI_TRANSFER_ENTRY *entry;
+    uint32_t frame_size = SPI->transfer.frame_size;
+    uint32_t align;
+    uint32_t i;
+
+    if ((queue == NULL) || (queue->entries == NULL) || (queue->num == 0))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    for (i = 0; i < queue->num; i++)
+    {
+        entry = &queue->entries[i];
+
+        if ((entry->num == 0) || ((entry->data_out == NULL) && (entry->data_in == NULL)))
+        {
+            return ARM_DRIVER_ERROR_PARAMETER;
+        }
+
+        if (entry->frame_format > ARM_SPI_CPOL1_CPHA1)
+        {
+            return ARM_SPI_ERROR_FRAME_FORMAT;
+        }
+
+        if (entry->data_bits != 0)
+        {
+            if ((entry->data_bits < 4) || (entry->data_bits > 32))
+            {
+                return ARM_SPI_ERROR_DATA_BITS;
+            }
+            frame_size = entry->data_bits;
+        }
+
+        if (entry->slave_select > 3)
+        {
+            return ARM_DRIVER_ERROR_PARAMETER;
+        }
+
+        /* Buffers must be aligned to the frame size, as in Send/Receive/Transfer */
+        align = (frame_size > 16) ? 0x3U : ((frame_size > 8) ? 0x1U : 0x0U);
+        if ((((uint32_t)entry->data_out & align) != 0U) || (((uint32_t)entry->data_in & align) != 0U))
+        {
+            return ARM_DRIVER_ERROR_PARAMETER;
+        }
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn      int32_t SPI_Queue_Start_Entry(SPI_RESOURCES *SPI)
+ * @brief   Program the settings of the current queue entry and start it.
+ * @note    Only the settings that differ from the previous entry are written,
+ *          as each of them takes the SPI through a disable/enable cycle.
+ * @param   SPI : Pointer to spi resources structure.
+ * @retval  \ref execution_status
+ */
+static int32_t SPI_Queue_Start_Entry(SPI_RESOURCES *SPI)
+{
+    const ARM_SPI_TRANSFER_ENTRY *entry = &SPI->queue.entries[SPI->queue.index];
+    SPI_MODE mode;
+
+    if (entry->frame_format != SPI->queue.frame_format)
+    {
+        mode = (SPI_MODE) (entry->frame_format >> ARM_SPI_FRAME_FORMAT_Pos);
+
+        if (SPI->drv_instance == LPSPI_INSTANCE)
+        {
+            lpspi_set_mode(SPI->regs, mode);
+        }
+        else
+        {
+            spi_set_mode(SPI->regs, mode);
+        }
+
+        /* Slave select toggle only applies with CPHA = 0 */
+        if ((mode == SPI_MODE_0) || (mode == SPI_MODE_2))
+        {
+            if (SPI->drv_instance == LPSPI_INSTANCE)
+            {
+                lpspi_set_sste(SPI->regs, SPI->sste_enable);
+            }
+            else
+            {
+                spi_set_sste(SPI->regs, SPI->sste_enable);
+            }
+        }
+        SPI->queue.frame_format = entry->frame_format;
+    }
+
+    if ((entry->data_bits != 0) && (entry->data_bits != SPI->transfer.frame_size))
+    {
+        SPI->transfer.frame_size = entry->data_bits;
+
+        if (SPI->drv_instance == LPSPI_INSTANCE)
+        {
+            lpspi_set_dfs(SPI->regs, SPI->transfer.frame_size);
+        }
+        else
+        {
+            spi_set_dfs(SPI->regs, SPI->transfer.frame_size);
+        }
+    }
+
+    if ((entry->bus_speed != 0) && (entry->bus_speed != SPI->queue.bus_speed))
+    {
+        spi_set_bus_speed(SPI->regs, entry->bus_speed, getSpiCoreClock(SPI->drv_instance));
+        SPI->queue.bus_speed = entry->bus_speed;
+    }
+
+    if ((SPI->master_ss_control == SPI_SS_HW_CONTROL) && (entry->slave_select != SPI->queue.slave_select))
+    {
+        spi_select_slave(SPI->regs, entry->slave_select);
+        SPI->queue.slave_select = entry->slave_select;
+    }
+
+    SPI->status.busy = 0;
+
+    if (entry->data_in == NULL)
+    {
+        return ARM_SPI_Send(SPI, entry->data_out, entry->num);
+    }
+    else if (entry->data_out == NULL)
+    {
+        return ARM_SPI_Receive(SPI, entry->data_in, entry->num);
+    }
+    else
+    {
+        return ARM_SPI_Transfer(SPI, entry->data_out, entry->data_in, entry->num);
+    }
+}
+
+/**
+ * @fn      int32_t SPI_Queue_Run(SPI_RESOURCES *SPI)
+ * @brief   Start the current queue entry. Entries that complete on the spot
+ *          (blocking mode) are followed by the next one right away.
+ * @note    The queue is ended once all entries are done or on error.
+ * @param   SPI : Pointer to spi resources structure.
+ * @retval  \ref execution_status
+ */
+static int32_t SPI_Queue_Run(SPI_RESOURCES *SPI)
+{
+    int32_t ret;
+
+    while (SPI->queue.index < SPI->queue.num)
+    {
+        ret = SPI_Queue_Start_Entry(SPI);
+        if (ret != ARM_DRIVER_OK)
+        {
+            SPI->queue.entries = NULL;
+            SPI->status.busy   = 0;
+            return ret;
+        }
+
+        /* Still running, the completion interrupt starts the next entry */
+        if (SPI->status.busy)
+        {
+            return ARM_DRIVER_OK;
+        }
+
+        SPI->queue.index++;
+    }
+
+    SPI->queue.entries = NULL;
+    return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn      uint32_t SPI_Queue_Next(SPI_RESOURCES *SPI)
+ * @brief   Called on transfer completion, starts the next queue entry if any.
+ * @note    none.
+ * @param   SPI : Pointer to spi resources structure.
+ * @retval  event to signal, 0 if the queue continues.
+ */
+static uint32_t SPI_Queue_Next(SPI_RESOURCES *SPI)
+{
+    if (SPI->queue.entries == NULL)
+    {
+        return ARM_SPI_EVENT_TRANSFER_COMPLETE;
+    }
+
+    SPI->queue.index++;
+
+    if (SPI->queue.index < SPI->queue.num)
+    {
+        if (SPI_Queue_Run(SPI) != ARM_DRIVER_OK)
+        {
+            return ARM_SPI_EVENT_DATA_LOST;
+        }
+
+        if (SPI->status.busy)
+        {
+            return 0;
+        }
+    }
+
+    SPI->queue.entries = NULL;
+    return ARM_SPI_EVENT_TRANSFER_COMPLETE;
+}
+
 /**
  * @fn      int32_t ARM_SPI_Control(SPI_RESOURCES *SPI, uint32_t control, uint32_t arg).
  * @brief   Used to configure spi.
@@ -1183,6 +1402,12 @@ static int32_t ARM_SPI_Control(SPI_RESOURCES *SPI, uint32_t control, uint32_t ar
         return ARM_DRIVER_ERROR;
     }
 
+    /* Queue progress can be read while the queue is running */
+    if ((control & ARM_SPI_CONTROL_Msk) == ARM_SPI_GET_QUEUE_COUNT)
+    {
+        return (int32_t) SPI->queue.index;
+    }
+
     if (SPI->status.busy)
     {
         return ARM_DRIVER_ERROR_BUSY;
@@ -1296,6 +1521,41 @@ static int32_t ARM_SPI_Control(SPI_RESOURCES *SPI, uint32_t control, uint32_t ar
             return ARM_DRIVER_OK;
         }
 
+        /* Start a transaction queue */
+        case ARM_SPI_QUEUE_TRANSFERS:
+        {
+            const ARM_SPI_TRANSFER_QUEUE *queue = (const ARM_SPI_TRANSFER_QUEUE *) arg;
+
+            if (!SPI->transfer.is_master)
+            {
+                return ARM_DRIVER_ERROR_UNSUPPORTED;
+            }
+
+#if SPI_MICROWIRE_FRF_ENABLE
+            if (SPI->mw_enable)
+            {
+                return ARM_DRIVER_ERROR_UNSUPPORTED;
+            }
+#endif
+
+            ret = SPI_Queue_Check(SPI, queue);
+            if (ret != ARM_DRIVER_OK)
+            {
+                return ret;
+            }
+
+            SPI->queue.entries      = queue->entries;
+            SPI->queue.num          = queue->num;
+            SPI->queue.index        = 0;
+
+            /* Program all settings for the first entry */
+            SPI->queue.frame_format = ~0U;
+            SPI->queue.bus_speed    = 0;
+            SPI->queue.slave_select = 0xFF;
+
+            return SPI_Queue_Run(SPI);
+        }
+
         /* Abort the current data transfer */
         case ARM_SPI_ABORT_TRANSFER:
         {
@@ -1354,6 +1614,7 @@ static int32_t ARM_SPI_Control(SPI_RESOURCES *SPI, uint32_t control, uint32_t ar
             SPI->transfer.rx_total_cnt       = 0;
             SPI->transfer.tx_current_cnt     = 0;
             SPI->transfer.rx_current_cnt     = 0;
+            SPI->queue.entries               = NULL;
             SPI->status.busy                 = 0;
 
             spi_disable(SPI->regs);
@@ -1583,6 +1844,8 @@ static int32_t ARM_SPI_Control(SPI_RESOURCES *SPI, uint32_t control, uint32_t ar
  */
 static void SPI_IRQ_Handler(SPI_RESOURCES *SPI)
 {
+    uint32_t event;
+
 #if SPI_MICROWIRE_FRF_ENABLE
     if (SPI->mw_enable)
     {
@@ -1598,12 +1861,19 @@ static void SPI_IRQ_Handler(SPI_RESOURCES *SPI)
     {
         SPI->transfer.status = SPI_TRANSFER_STATUS_NONE;
         SPI->status.busy = 0;
-        SPI->cb_event(ARM_SPI_EVENT_TRANSFER_COMPLETE);
+
+        /* Chain the next entry of a transaction queue, if any */
+        event = SPI_Queue_Next(SPI);
+        if (event != 0)
+        {
+            SPI->cb_event(event);
+        }
     }
 
     if (SPI->transfer.status == SPI_TRANSFER_STATUS_OVERFLOW)
     {
         SPI->transfer.status = SPI_TRANSFER_STATUS_NONE;
+        SPI->queue.entries = NULL;
         SPI->status.data_lost = 1;
         SPI->status.busy = 0;
         SPI->cb_event(ARM_SPI_EVENT_DATA_LOST);
@@ -1622,6 +1892,8 @@ static void SPI_IRQ_Handler(SPI_RESOURCES *SPI)
  */
 static void SPI_DMACallback(SPI_RESOURCES *SPI, uint32_t event, int8_t peri_num)
 {
+    uint32_t spi_event;
+
     if (!SPI->cb_event)
     {
         return;
@@ -1639,10 +1911,23 @@ static void SPI_DMACallback(SPI_RESOURCES *SPI, uint32_t event, int8_t peri_num)
 #if defined (M55_HE)
             case LPSPI_DMA_TX_PERIPH_REQ:
 #endif
-                if (SPI->transfer.mode == SPI_TMOD_TX)
+                if ((SPI->transfer.mode == SPI_TMOD_TX) && (SPI->queue.entries != NULL))
+                {
+                    /* The last frames may still be shifting out, and the next
+                     * entry must not reprogram the bus or slave select under
+                     * them: the Tx FIFO empty interrupt ends the entry once
+                     * the SPI is idle, as for an interrupt driven send. */
+                    SPI->transfer.tx_current_cnt = SPI->transfer.tx_total_cnt;
+                    spi_unmask_tx_empty_interrupt(SPI->regs);
+                }
+                else if (SPI->transfer.mode == SPI_TMOD_TX)
                 {
                     SPI->status.busy = 0;
-                    SPI->cb_event(ARM_SPI_EVENT_TRANSFER_COMPLETE);
+                    spi_event = SPI_Queue_Next(SPI);
+                    if (spi_event != 0)
+                    {
+                        SPI->cb_event(spi_event);
+                    }
                 }
                 break;
             case SPI0_DMA_RX_PERIPH_REQ:
@@ -1653,7 +1938,11 @@ static void SPI_DMACallback(SPI_RESOURCES *SPI, uint32_t event, int8_t peri_num)
             case LPSPI_DMA_RX_PERIPH_REQ:
 #endif
                 SPI->status.busy = 0;
-                SPI->cb_event(ARM_SPI_EVENT_TRANSFER_COMPLETE);
+                spi_event = SPI_Queue_Next(SPI);
+                if (spi_event != 0)
+                {
+                    SPI->cb_event(spi_event);
+                }
                 break;
             default:
                 break;
@@ -1663,6 +1952,7 @@ static void SPI_DMACallback(SPI_RESOURCES *SPI, uint32_t event, int8_t peri_num)
     /* Abort Occurred */
     if (event & ARM_DMA_EVENT_ABORT)
     {
+        SPI->queue.entries = NULL;
         SPI->status.busy = 0;
         SPI->cb_event(ARM_SPI_EVENT_DATA_LOST);
     }
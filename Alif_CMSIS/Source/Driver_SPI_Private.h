@@ -32,6 +32,7 @@ extern "C"
 #include CMSIS_device_header
 
 #include "Driver_SPI.h"
+#include "Driver_SPI_EX.h"
 #include "sys_ctrl_spi.h"
 #include "spi.h"
 
@@ -118,6 +119,16 @@ typedef struct _SPI_MICROWIRE_CONFIG {
 } SPI_MICROWIRE_CONFIG;
 #endif
 
+/** \brief SPI transaction queue state. */
+typedef struct _SPI_QUEUE {
+    const ARM_SPI_TRANSFER_ENTRY *entries;      /**< Queue entries, NULL when no queue is running     */
+    uint32_t                    num;            /**< Number of entries                                */
+    volatile uint32_t           index;          /**< Current entry, number of entries completed       */
+    uint32_t                    frame_format;   /**< Frame format programmed for the previous entry   */
+    uint32_t                    bus_speed;      /**< Bus speed programmed for the previous entry      */
+    uint8_t                     slave_select;   /**< Slave selected for the previous entry            */
+} SPI_QUEUE;
+
 /** \brief Resources for a SPI instance. */
 typedef struct _SPI_RESOURCES
 {
@@ -126,6 +137,7 @@ typedef struct _SPI_RESOURCES
     ARM_SPI_STATUS              status;             /**< SPI driver status                                */
     SPI_DRIVER_STATE            state;              /**< SPI driver state                                 */
     spi_transfer_t              transfer;           /**< Transfer structure for the SPI instance          */
+    SPI_QUEUE                   queue;              /**< Transaction queue state                          */
     SPI_SS_CONTROL              master_ss_control;  /**< operate Slave select control pin                 */
     uint8_t                     irq_priority;       /**< Interrupt priority                               */
     uint8_t                     slave_select;       /**< chip selection pin from 0-3                      */
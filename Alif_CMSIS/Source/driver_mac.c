@@ -29,14 +29,19 @@ static MAC_DEV MAC0 = {
     .frame_end = NULL,
     .irq = (IRQn_Type) ETH_SBD_IRQ_IRQn,
     .irq_priority = RTE_ETH_MAC_IRQ_PRIORITY,
+    .rx_coalesce_frames = RTE_ETH_MAC_RX_COALESCE_FRAMES,
+    .rx_coalesce_timeout = RTE_ETH_MAC_RX_COALESCE_TIMEOUT,
 };
 
 /* area for descriptors */
-static DMA_DESC dma_descs[RX_DESC_COUNT + TX_DESC_COUNT]__attribute__((section("eth_buf"))) __attribute__((aligned(16)));
-static uint32_t rx_buffers[RX_DESC_COUNT][ETH_BUF_SIZE >> 2]__attribute__((section("eth_buf")));
-static uint32_t tx_buffers[TX_DESC_COUNT][ETH_BUF_SIZE >> 2]__attribute__((section("eth_buf")));
+/* Buffers are cache line aligned and each descriptor is padded to a full
+ * cache line, so that the cache maintenance on one of them never touches
+ * its neighbours */
+static DMA_DESC dma_descs[RX_DESC_COUNT + TX_DESC_COUNT]__attribute__((section("eth_buf"))) __attribute__((aligned(32)));
+static uint32_t rx_buffers[RX_DESC_COUNT][ETH_BUF_SIZE >> 2]__attribute__((section("eth_buf"))) __attribute__((aligned(32)));
+static uint32_t tx_buffers[TX_DESC_COUNT][ETH_BUF_SIZE >> 2]__attribute__((section("eth_buf"))) __attribute__((aligned(32)));
 
-#define ARM_ETH_MAC_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0) /* driver version */
+#define ARM_ETH_MAC_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 1) /* driver version */
 
 /* Driver Version */
 static const ARM_DRIVER_VERSION DriverVersion = {
@@ -45,6 +50,8 @@ static const ARM_DRIVER_VERSION DriverVersion = {
 };
 
 /* Driver Capabilities */
+/* The IPv4/UDP/TCP/ICMP checksum offload bits are set by GetCapabilities
+ * from the COE engines reported in MAC_HW_FEATURE_0 */
 static const ARM_ETH_MAC_CAPABILITIES DriverCapabilities = {
     0,        /* IPv4 header checksum verified on receive */
     0,        /* IPv6 checksum verification supported on receive */
@@ -78,9 +85,12 @@ static void setup_rxdesc(MAC_DEV *dev, uint32_t desc_id)
 
     SCB_InvalidateDCache_by_Addr((uint32_t *)desc, sizeof(DMA_DESC));
 
-    desc->des0 = (uint32_t) LocalToGlobal(&rx_buffers[desc_id][0]);
-    desc->des3 = RDES3_OWN | RDES3_INT_ON_COMPLETION_EN |
-                    RDES3_BUFFER1_VALID_ADDR;
+    desc->des0 = (uint32_t) LocalToGlobal(dev->rx_bufs[desc_id]);
+    desc->des3 = RDES3_OWN | RDES3_BUFFER1_VALID_ADDR;
+
+    /* With coalescing the Rx watchdog signals the frames in between */
+    if (((desc_id + 1) % dev->rx_coalesce_frames) == 0)
+        desc->des3 |= RDES3_INT_ON_COMPLETION_EN;
 
     SCB_CleanDCache_by_Addr((uint32_t *) desc, sizeof(DMA_DESC));
 }
@@ -117,7 +127,7 @@ static void init_tx_descs(MAC_DEV *dev)
     uint32_t i;
 
     for (i = 0; i < TX_DESC_COUNT; i++)
-        dev->tx_descs[i] = (DMA_DESC) {0, 0, 0, 0};
+        dev->tx_descs[i] = (DMA_DESC) {0};
 
     dev->regs->DMA_CH0_TX_BASE_ADDR = (uint32_t) LocalToGlobal(dev->tx_descs);
     dev->regs->DMA_CHO_TX_RING_LEN = TX_DESC_COUNT - 1;
@@ -134,14 +144,599 @@ static void init_tx_descs(MAC_DEV *dev)
 */
 static void init_descriptors(MAC_DEV *dev)
 {
+    uint32_t i;
+
     dev->descs = dma_descs;
     dev->tx_descs = (DMA_DESC *) dev->descs;
     dev->rx_descs = (dev->tx_descs + TX_DESC_COUNT);
 
+    /* In zero-copy mode the pool buffers stay attached */
+    if (!dev->pool) {
+        for (i = 0; i < RX_DESC_COUNT; i++)
+            dev->rx_bufs[i] = (uint8_t *) &rx_buffers[i][0];
+    }
+
     init_rx_descs(dev);
     init_tx_descs(dev);
 }
 
+/**
+  \fn          bool txdescs_free(MAC_DEV *dev, uint32_t count)
+  \brief       Check that the next Tx DMA descriptors are free, plus one
+                that stays unused: a tail pointer equal to the current
+                descriptor of the DMA reads as an empty ring.
+  \param[in]   dev        Pointer to the MAC device instance
+  \param[in]   count      Number of descriptors needed
+  \return      true if all of them can be used.
+*/
+static bool txdescs_free(MAC_DEV *dev, uint32_t count)
+{
+    uint32_t idx = dev->tx_desc_id;
+    DMA_DESC *desc;
+
+    count++;
+    while (count--) {
+        desc = &dev->tx_descs[idx];
+
+        SCB_InvalidateDCache_by_Addr(desc, sizeof(DMA_DESC));
+
+        if ((desc->des3 & TDES3_OWN) || dev->tx_bufs[idx])
+            return false;
+
+        idx++;
+        idx %= TX_DESC_COUNT;
+    }
+
+    return true;
+}
+
+/**
+  \fn          void fill_txdescs(MAC_DEV *dev, const ARM_ETH_MAC_FRAME_BUFFER *frags,
+                                  uint32_t num_frags, const uint8_t *zc_buf)
+  \brief       Map the fragments of a frame onto consecutive Tx DMA
+                descriptors, two buffers per descriptor. The Tx DMA is not
+                kicked. Called with the ETH interrupt masked.
+  \param[in]   dev        Pointer to the MAC device instance
+  \param[in]   frags      Frame fragments
+  \param[in]   num_frags  Number of fragments
+  \param[in]   zc_buf     Buffer to pass back to the pool once sent, or NULL
+  \return      none.
+*/
+static void fill_txdescs(MAC_DEV *dev, const ARM_ETH_MAC_FRAME_BUFFER *frags,
+    uint32_t num_frags, const uint8_t *zc_buf)
+{
+    uint32_t first_idx = dev->tx_desc_id, cur_idx = first_idx;
+    uint32_t i, len = 0, des3;
+    DMA_DESC *desc;
+
+    for (i = 0; i < num_frags; i++)
+        len += frags[i].len;
+
+    for (i = 0; i < num_frags; i += 2) {
+        cur_idx = dev->tx_desc_id;
+        desc = &dev->tx_descs[cur_idx];
+
+        desc->des0 = (uint32_t) LocalToGlobal(frags[i].data);
+        desc->des1 = 0;
+        desc->des2 = frags[i].len;
+
+        if ((i + 1) < num_frags) {
+            desc->des1 = (uint32_t) LocalToGlobal(frags[i + 1].data);
+            desc->des2 |= frags[i + 1].len << TDES2_BUFFER2_SIZE_MASK_SHIFT;
+        }
+
+        des3 = len;
+
+        if (i == 0) {
+            des3 |= TDES3_FIRST_DESCRIPTOR;
+
+            /* IP header and payload checksums, including the pseudo-header */
+            if (dev->flags & ETH_CSUM_TX)
+                des3 |= TDES3_CHECKSUM_INSERTION_FULL;
+        } else {
+            des3 |= TDES3_OWN;
+        }
+
+        if ((i + 2) >= num_frags) {
+            des3 |= TDES3_LAST_DESCRIPTOR;
+            desc->des2 |= TDES2_INTERRUPT_ON_COMPLETION;
+        }
+
+        desc->des3 = des3;
+
+        SCB_CleanDCache_by_Addr((uint32_t *) desc, sizeof(DMA_DESC));
+
+        dev->tx_desc_id++;
+        dev->tx_desc_id %= TX_DESC_COUNT;
+    }
+
+    /* The DMA must not see the first descriptor before the rest */
+    desc = &dev->tx_descs[first_idx];
+    desc->des3 |= TDES3_OWN;
+
+    SCB_CleanDCache_by_Addr((uint32_t *) desc, sizeof(DMA_DESC));
+
+    /* Completion of the last descriptor completes the frame */
+    dev->tx_bufs[cur_idx] = zc_buf;
+    dev->stats.tx_frames++;
+}
+
+/**
+  \fn          void submit_txdesc(MAC_DEV *dev, const uint8_t *buf, uint32_t len,
+                                   const uint8_t *zc_buf)
+  \brief       Hand a single buffer frame to the Tx DMA.
+  \param[in]   dev        Pointer to the MAC device instance
+  \param[in]   buf        Frame buffer
+  \param[in]   len        Frame length in bytes
+  \param[in]   zc_buf     Buffer to pass back to the pool once sent, or NULL
+  \return      none.
+*/
+static void submit_txdesc(MAC_DEV *dev, const uint8_t *buf, uint32_t len,
+    const uint8_t *zc_buf)
+{
+    ARM_ETH_MAC_FRAME_BUFFER frag = { (uint8_t *) buf, len, 0 };
+
+    /* The IRQ handler inspects the Tx descriptors in zero-copy mode */
+    NVIC_DisableIRQ(dev->irq);
+
+    fill_txdescs(dev, &frag, 1, zc_buf);
+
+    dev->regs->DMA_CH0_TX_END_ADDR = (uint32_t) LocalToGlobal(&(dev->tx_descs[dev->tx_desc_id]));
+
+    NVIC_EnableIRQ(dev->irq);
+}
+
+/**
+  \fn          void reclaim_tx_bufs(MAC_DEV *dev, bool force)
+  \brief       Pass the zero-copy Tx buffers the DMA is done with back to the pool.
+  \param[in]   dev        Pointer to the MAC device instance
+  \param[in]   force      Release the buffers even if still owned by the DMA
+  \return      none.
+*/
+static void reclaim_tx_bufs(MAC_DEV *dev, bool force)
+{
+    const uint8_t *buf;
+    DMA_DESC *desc;
+    uint32_t i;
+
+    for (i = 0; i < TX_DESC_COUNT; i++) {
+        buf = dev->tx_bufs[i];
+        if (!buf)
+            continue;
+
+        desc = &dev->tx_descs[i];
+
+        SCB_InvalidateDCache_by_Addr(desc, sizeof(DMA_DESC));
+
+        if ((desc->des3 & TDES3_OWN) && !force)
+            continue;
+
+        dev->tx_bufs[i] = NULL;
+        dev->pool->tx_done(dev->pool->context, buf);
+    }
+}
+
+/**
+  \fn          uint32_t rx_frame_status(const DMA_DESC *desc)
+  \brief       Decode the checksum status of a received frame.
+  \param[in]   desc       Written back Rx DMA descriptor of the frame
+  \return      ARM_ETH_MAC_RX_... flags
+*/
+static uint32_t rx_frame_status(const DMA_DESC *desc)
+{
+    uint32_t status = 0;
+
+    /* RDES1 only holds the checksum status with MAC_CONFIG_IPC set */
+    if (!(desc->des3 & RDES3_RDES1_VALID))
+        return 0;
+
+    if (desc->des1 & RDES1_IP_HDR_ERROR)
+        status |= ARM_ETH_MAC_RX_IP_HEADER_ERROR;
+
+    if (desc->des1 & RDES1_IP_CSUM_ERROR)
+        status |= ARM_ETH_MAC_RX_PAYLOAD_ERROR;
+
+    if (!status && (desc->des1 & RDES1_IPV4_HEADER) &&
+        !(desc->des1 & RDES1_IP_CSUM_BYPASSED) &&
+        (desc->des1 & RDES1_IP_PAYLOAD_TYPE_MASK))
+        status |= ARM_ETH_MAC_RX_CHECKSUM_VERIFIED;
+
+    return status;
+}
+
+/**
+  \fn          void copy_rx_data(uint8_t *dst, const uint8_t *src, uint32_t len)
+  \brief       Copy received data out of an Rx DMA buffer.
+  \param[in]   dst        Destination buffer
+  \param[in]   src        Rx DMA buffer
+  \param[in]   len        Number of bytes to copy
+  \return      none.
+*/
+static void copy_rx_data(uint8_t *dst, const uint8_t *src, uint32_t len)
+{
+    /* Only the bytes being read need to be fetched again */
+    SCB_InvalidateDCache_by_Addr((void *) src, len < ETH_BUF_SIZE ? len : ETH_BUF_SIZE);
+
+    /* copy data to the buffer */
+    for ( ; len > 7; dst += 8, src += 8, len -= 8) {
+        ((uint32_t *) dst)[0] = ((const uint32_t *) src)[0];
+        ((uint32_t *) dst)[1] = ((const uint32_t *) src)[1];
+    }
+
+    /* copy remaining 7 bytes */
+    for ( ; len > 1; dst += 2, src += 2, len -= 2)
+        ((uint16_t *) dst)[0] = ((const uint16_t *) src)[0];
+
+    if (len > 0)
+        dst[0] = src[0];
+}
+
+/**
+  \fn          void update_rx_drop_stats(MAC_DEV *dev)
+  \brief       Fold the Rx drop counters of the hardware into dev->stats.
+                Called from the ETH interrupt or with it masked.
+  \param[in]   dev        Pointer to the MAC device instance
+  \return      none.
+*/
+static void update_rx_drop_stats(MAC_DEV *dev)
+{
+    uint32_t mtl, dma;
+
+    /* Both counters are 11 bits wide and clear on read */
+    mtl = dev->regs->MTL_RXQ0_MISSED_PKT_OVF_CNT;
+    dma = dev->regs->DMA_CH0_MISS_FRAME_CNT;
+
+    dev->stats.rx_overflow += mtl & MTL_RXQ0_OVF_CNT_OVFPKTCNT_MASK;
+    dev->stats.rx_dropped += (mtl & MTL_RXQ0_OVF_CNT_MISPKTCNT_MASK) >>
+                                MTL_RXQ0_OVF_CNT_MISPKTCNT_SHIFT;
+    dev->stats.rx_dropped += dma & DMA_CH0_MISS_FRAME_CNT_MFC_MASK;
+}
+
+/**
+  \fn          int32_t set_rx_coalesce(MAC_DEV *dev, uint32_t arg)
+  \brief       Configure Rx interrupt coalescing.
+  \param[in]   dev        Pointer to the MAC device instance
+  \param[in]   arg        ARM_ETH_MAC_RX_COALESCE_FRAMES/TIMEOUT
+  \return      \ref execution_status
+*/
+static int32_t set_rx_coalesce(MAC_DEV *dev, uint32_t arg)
+{
+    uint32_t frames, timeout;
+
+    frames = (arg & ARM_ETH_MAC_RX_COALESCE_FRAMES_Msk) >>
+                ARM_ETH_MAC_RX_COALESCE_FRAMES_Pos;
+    timeout = (arg & ARM_ETH_MAC_RX_COALESCE_TIMEOUT_Msk) >>
+                ARM_ETH_MAC_RX_COALESCE_TIMEOUT_Pos;
+
+    if (!frames || (frames > RX_DESC_COUNT))
+        return ARM_DRIVER_ERROR_PARAMETER;
+
+    if (timeout)
+        dev->rx_coalesce_timeout = timeout;
+
+    /* Without the watchdog the last frames of a burst are never signalled */
+    if ((frames > 1) && !dev->rx_coalesce_timeout)
+        return ARM_DRIVER_ERROR_PARAMETER;
+
+    /* The watchdog is left running, as descriptors armed with the previous
+     * frame count may still be owned by the DMA */
+    dev->regs->DMA_CH0_RX_INTR_WDT = dev->rx_coalesce_timeout;
+
+    /* Takes effect as the Rx descriptors are refilled */
+    dev->rx_coalesce_frames = frames;
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t rx_frames_read(MAC_DEV *dev, ARM_ETH_MAC_FRAME_BATCH *batch)
+  \brief       Read the pending frames from the Rx ring, up to batch->num,
+                and hand the refilled descriptors back to the DMA at once.
+  \param[in]   dev        Pointer to the MAC device instance
+  \param[in]   batch      Frame entries, updated with the frames read
+  \return      \ref execution_status
+*/
+static int32_t rx_frames_read(MAC_DEV *dev, ARM_ETH_MAC_FRAME_BATCH *batch)
+{
+    ARM_ETH_MAC_FRAME_BUFFER *frame;
+    DMA_DESC *desc;
+    uint32_t cur_idx, len, n;
+    uint8_t *buf;
+
+    if (!batch || (batch->num && !batch->frames))
+        return ARM_DRIVER_ERROR_PARAMETER;
+
+    if (!dev->pool) {
+        for (n = 0; n < batch->num; n++) {
+            if (!batch->frames[n].data || !batch->frames[n].len)
+                return ARM_DRIVER_ERROR_PARAMETER;
+        }
+    }
+
+    for (n = 0; n < batch->num; n++) {
+        cur_idx = dev->rx_desc_id;
+        desc = &dev->rx_descs[cur_idx];
+        frame = &batch->frames[n];
+
+        SCB_InvalidateDCache_by_Addr(desc, sizeof(DMA_DESC));
+
+        if (desc->des3 & RDES3_OWN)
+            break;
+
+        len = (desc->des3 & 0x7fff) - 4;
+
+        if (dev->pool) {
+            /* Without a replacement the frame stays queued */
+            buf = dev->pool->rx_alloc(dev->pool->context);
+            if (!buf)
+                break;
+
+            SCB_InvalidateDCache_by_Addr(buf, ETH_BUF_SIZE);
+
+            frame->data = dev->rx_bufs[cur_idx];
+            SCB_InvalidateDCache_by_Addr(frame->data, len);
+
+            dev->rx_bufs[cur_idx] = buf;
+        } else {
+            if (len > frame->len)
+                len = frame->len;
+
+            copy_rx_data(frame->data, dev->rx_bufs[cur_idx], len);
+        }
+
+        frame->len = len;
+        frame->status = rx_frame_status(desc);
+
+        setup_rxdesc(dev, cur_idx);
+
+        dev->rx_desc_id++;
+        dev->rx_desc_id %= RX_DESC_COUNT;
+    }
+
+    /* One tail pointer update for all the refilled descriptors */
+    if (n) {
+        cur_idx = (dev->rx_desc_id + RX_DESC_COUNT - 1) % RX_DESC_COUNT;
+        dev->regs->DMA_CH0_RX_END_ADDR = (uint32_t) LocalToGlobal(&(dev->rx_descs[cur_idx]));
+        dev->stats.rx_frames += n;
+    }
+
+    batch->num = n;
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t set_buffer_pool(MAC_DEV *dev, const ARM_ETH_MAC_BUFFER_POOL *pool)
+  \brief       Switch between copy and zero-copy mode.
+  \param[in]   dev        Pointer to the MAC device instance
+  \param[in]   pool       Buffer pool for zero-copy mode, NULL for copy mode
+  \return      \ref execution_status
+*/
+static int32_t set_buffer_pool(MAC_DEV *dev, const ARM_ETH_MAC_BUFFER_POOL *pool)
+{
+    uint8_t *bufs[RX_DESC_COUNT];
+    uint32_t i, rx_ctrl;
+
+    if (pool && (!pool->rx_alloc || !pool->rx_free || !pool->tx_done))
+        return ARM_DRIVER_ERROR_PARAMETER;
+
+    /* Zero-copy Tx buffers still in flight belong to the current pool */
+    for (i = 0; i < TX_DESC_COUNT; i++) {
+        if (dev->tx_bufs[i])
+            return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    if (pool) {
+        for (i = 0; i < RX_DESC_COUNT; i++) {
+            bufs[i] = pool->rx_alloc(pool->context);
+            if (!bufs[i]) {
+                while (i--)
+                    pool->rx_free(pool->context, bufs[i]);
+                return ARM_DRIVER_ERROR;
+            }
+            /* Drop any line the application left in the cache */
+            SCB_InvalidateDCache_by_Addr(bufs[i], ETH_BUF_SIZE);
+        }
+    } else {
+        for (i = 0; i < RX_DESC_COUNT; i++)
+            bufs[i] = (uint8_t *) &rx_buffers[i][0];
+    }
+
+    rx_ctrl = dev->regs->DMA_CH0_RX_CTRL;
+    dev->regs->DMA_CH0_RX_CTRL = rx_ctrl & ~DMA_CONTROL_SR;
+
+    for (i = 0; i < RX_DESC_COUNT; i++) {
+        if (dev->pool)
+            dev->pool->rx_free(dev->pool->context, dev->rx_bufs[i]);
+        dev->rx_bufs[i] = bufs[i];
+    }
+
+    dev->pool = pool;
+    dev->rx_desc_id = 0;
+    init_rx_descs(dev);
+
+    dev->regs->DMA_CH0_RX_CTRL = rx_ctrl;
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t rx_frame_take(MAC_DEV *dev, ARM_ETH_MAC_FRAME_BUFFER *frame)
+  \brief       Hand the received frame buffer over to the caller (zero-copy).
+  \param[in]   dev        Pointer to the MAC device instance
+  \param[out]  frame      Received frame buffer and length
+  \return      \ref execution_status
+*/
+static int32_t rx_frame_take(MAC_DEV *dev, ARM_ETH_MAC_FRAME_BUFFER *frame)
+{
+    uint32_t cur_idx = dev->rx_desc_id;
+    DMA_DESC *desc = &dev->rx_descs[cur_idx];
+    uint8_t *buf;
+    uint32_t len;
+
+    if (!frame)
+        return ARM_DRIVER_ERROR_PARAMETER;
+
+    if (!dev->pool)
+        return ARM_DRIVER_ERROR;
+
+    SCB_InvalidateDCache_by_Addr(desc, sizeof(DMA_DESC));
+
+    if (desc->des3 & RDES3_OWN)
+        return ARM_DRIVER_ERROR_BUSY;
+
+    len = (desc->des3 & 0x7fff) - 4;
+
+    /* Without a replacement the frame stays queued for ReadFrame */
+    buf = dev->pool->rx_alloc(dev->pool->context);
+    if (!buf)
+        return ARM_DRIVER_ERROR;
+
+    SCB_InvalidateDCache_by_Addr(buf, ETH_BUF_SIZE);
+
+    frame->data = dev->rx_bufs[cur_idx];
+    frame->len = len;
+    frame->status = rx_frame_status(desc);
+
+    /* Only the received bytes need to be fetched again */
+    SCB_InvalidateDCache_by_Addr(frame->data, len);
+
+    dev->rx_bufs[cur_idx] = buf;
+    setup_rxdesc(dev, cur_idx);
+
+    dev->regs->DMA_CH0_RX_END_ADDR = (uint32_t) LocalToGlobal(&(dev->rx_descs[cur_idx]));
+
+    dev->rx_desc_id++;
+    dev->rx_desc_id %= RX_DESC_COUNT;
+    dev->stats.rx_frames++;
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t tx_frame_send(MAC_DEV *dev, const ARM_ETH_MAC_FRAME_BUFFER *frame)
+  \brief       Send a frame straight from the caller buffer (zero-copy).
+  \param[in]   dev        Pointer to the MAC device instance
+  \param[in]   frame      Frame buffer and length
+  \return      \ref execution_status
+*/
+static int32_t tx_frame_send(MAC_DEV *dev, const ARM_ETH_MAC_FRAME_BUFFER *frame)
+{
+    uint32_t cur_idx = dev->tx_desc_id;
+    DMA_DESC *desc = &dev->tx_descs[cur_idx];
+
+    if (!frame || !frame->data || !frame->len ||
+        (frame->len > TDES2_BUFFER1_SIZE_MASK))
+        return ARM_DRIVER_ERROR_PARAMETER;
+
+    if (!dev->pool)
+        return ARM_DRIVER_ERROR;
+
+    /* A fragmented frame is being assembled by SendFrame */
+    if (dev->frame_end)
+        return ARM_DRIVER_ERROR_BUSY;
+
+    SCB_InvalidateDCache_by_Addr(desc, sizeof(DMA_DESC));
+
+    if ((desc->des3 & TDES3_OWN) || dev->tx_bufs[cur_idx]) {
+        dev->stats.tx_ring_full++;
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    SCB_CleanDCache_by_Addr(frame->data, frame->len);
+
+    submit_txdesc(dev, frame->data, frame->len, frame->data);
+
+    return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          uint32_t tx_frame_descs(const ARM_ETH_MAC_TX_FRAME *frame)
+  \brief       Validate a gather list frame.
+  \param[in]   frame      Frame fragments
+  \return      number of Tx DMA descriptors needed, 0 if the frame is invalid.
+*/
+static uint32_t tx_frame_descs(const ARM_ETH_MAC_TX_FRAME *frame)
+{
+    uint32_t i, len = 0, count;
+
+    if (!frame->frags || !frame->num_frags)
+        return 0;
+
+    /* one descriptor of the ring always stays unused */
+    count = (frame->num_frags + 1) / 2;
+    if (count > (TX_DESC_COUNT - 1))
+        return 0;
+
+    for (i = 0; i < frame->num_frags; i++) {
+        if (!frame->frags[i].data || !frame->frags[i].len ||
+            (frame->frags[i].len > TDES2_BUFFER1_SIZE_MASK))
+            return 0;
+        len += frame->frags[i].len;
+    }
+
+    if (len > TDES3_PACKET_SIZE_MASK)
+        return 0;
+
+    return count;
+}
+
+/**
+  \fn          int32_t tx_frames_send(MAC_DEV *dev, ARM_ETH_MAC_TX_BATCH *batch)
+  \brief       Send frames straight from their fragments (zero-copy gather),
+                kicking the Tx DMA once for the whole batch.
+  \param[in]   dev        Pointer to the MAC device instance
+  \param[in]   batch      Frames to send, updated with the number queued
+  \return      \ref execution_status
+*/
+static int32_t tx_frames_send(MAC_DEV *dev, ARM_ETH_MAC_TX_BATCH *batch)
+{
+    const ARM_ETH_MAC_TX_FRAME *frame;
+    uint32_t i, n, count;
+
+    if (!batch || !batch->frames || !batch->num)
+        return ARM_DRIVER_ERROR_PARAMETER;
+
+    for (n = 0; n < batch->num; n++) {
+        if (!tx_frame_descs(&batch->frames[n]))
+            return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    if (!dev->pool)
+        return ARM_DRIVER_ERROR;
+
+    /* A fragmented frame is being assembled by SendFrame */
+    if (dev->frame_end)
+        return ARM_DRIVER_ERROR_BUSY;
+
+    for (n = 0; n < batch->num; n++) {
+        frame = &batch->frames[n];
+        count = tx_frame_descs(frame);
+
+        if (!txdescs_free(dev, count)) {
+            dev->stats.tx_ring_full++;
+            break;
+        }
+
+        for (i = 0; i < frame->num_frags; i++)
+            SCB_CleanDCache_by_Addr(frame->frags[i].data, frame->frags[i].len);
+
+        /* The IRQ handler inspects the Tx descriptors in zero-copy mode */
+        NVIC_DisableIRQ(dev->irq);
+        fill_txdescs(dev, frame->frags, frame->num_frags, frame->frags[0].data);
+        NVIC_EnableIRQ(dev->irq);
+    }
+
+    batch->num = n;
+
+    if (!n)
+        return ARM_DRIVER_ERROR_BUSY;
+
+    dev->regs->DMA_CH0_TX_END_ADDR = (uint32_t) LocalToGlobal(&(dev->tx_descs[dev->tx_desc_id]));
+
+    return ARM_DRIVER_OK;
+}
+
 /**
   \fn          static int32_t mac_hw_init(MAC_DEV *dev)
   \brief       Initialize the MAC hardware.
@@ -228,10 +823,15 @@ static int32_t mac_hw_init(MAC_DEV *dev)
     dev->regs->MAC_PACKET_FILTER |= MAC_PACKET_FILTER_PM;
 
     /* Configure the DMA block */
+    /* Skip the descriptor padding, in units of the bus width */
+    val = dev->regs->DMA_CH0_CTRL & ~DMA_CHAN_CONTROL_DSL_MASK;
+    val |= ((DMA_DESC_PAD_WORDS * 4U) / DMA_BUS_WIDTH) << DMA_CHAN_CONTROL_DSL_SHIFT;
+    dev->regs->DMA_CH0_CTRL = val;
+
     dev->regs->DMA_CH0_TX_CTRL |= (16 << DMA_CH0_TX_CONTROL_TXPBL_SHIFT);
 
     dev->regs->DMA_CH0_RX_CTRL |= ((16 << DMA_CH0_RX_CONTROL_RXPBL_SHIFT) |
-                                   (2048 << DMA_CH0_RX_CONTROL_RBSZ_SHIFT));
+                                   (ETH_BUF_SIZE << DMA_CH0_RX_CONTROL_RBSZ_SHIFT));
 
     val = dev->regs->DMA_SYS_BUS_MODE;
     val |= DMA_SYSBUS_MODE_BLEN4 | DMA_SYSBUS_MODE_BLEN8 |
@@ -241,12 +841,27 @@ static int32_t mac_hw_init(MAC_DEV *dev)
     val |= DMA_SYSBUS_MODE_ONEKBBE;
     dev->regs->DMA_SYS_BUS_MODE = val;
 
+    /* The rings restart from the first descriptor, so zero-copy Tx
+     * buffers still attached will never complete */
+    if (dev->pool)
+        reclaim_tx_bufs(dev, true);
+
+    dev->rx_desc_id = 0;
+    dev->tx_desc_id = 0;
+    dev->frame_end = NULL;
+
     init_descriptors(dev);
 
-    /* Enable DMA Channel 0 interrupts, rx and tx */
+    dev->stats = (ARM_ETH_MAC_STATS) {0};
+
+    dev->regs->DMA_CH0_RX_INTR_WDT = dev->rx_coalesce_timeout;
+
+    /* Enable DMA Channel 0 interrupts, rx and tx, and rx ring full */
     dev->regs->DMA_CH0_INT_ENABLE |= (DMA_CHAN_INTR_ENA_RIE |
                                       DMA_CHAN_INTR_ENA_NIE |
-                                      DMA_CHAN_INTR_ENA_TIE);
+                                      DMA_CHAN_INTR_ENA_TIE |
+                                      DMA_CHAN_INTR_ENA_RBUE |
+                                      DMA_CHAN_INTR_ENA_AIE);
 
     dev->regs->DMA_CH0_TX_CTRL |= DMA_CH0_TX_CONTROL_ST;
     dev->regs->DMA_CH0_RX_CTRL |= DMA_CH0_RX_CONTROL_SR;
@@ -315,7 +930,33 @@ static ARM_DRIVER_VERSION ETH_MAC_GetVersion(void)
 */
 static ARM_ETH_MAC_CAPABILITIES ETH_MAC_GetCapabilities(void)
 {
-    return DriverCapabilities;
+    ARM_ETH_MAC_CAPABILITIES capabilities = DriverCapabilities;
+    uint32_t feature;
+
+    /* The MAC registers are only readable with the peripheral clock on */
+    if (MAC0.flags & ETH_POWER) {
+        feature = MAC0.regs->MAC_HW_FEATURE_0;
+    } else {
+        enable_eth_periph_clk();
+        feature = MAC0.regs->MAC_HW_FEATURE_0;
+        disable_eth_periph_clk();
+    }
+
+    if (feature & MAC_HW_FEATURE0_RXCOESEL) {
+        capabilities.checksum_offload_rx_ip4 = 1;
+        capabilities.checksum_offload_rx_udp = 1;
+        capabilities.checksum_offload_rx_tcp = 1;
+        capabilities.checksum_offload_rx_icmp = 1;
+    }
+
+    if (feature & MAC_HW_FEATURE0_TXCOESEL) {
+        capabilities.checksum_offload_tx_ip4 = 1;
+        capabilities.checksum_offload_tx_udp = 1;
+        capabilities.checksum_offload_tx_tcp = 1;
+        capabilities.checksum_offload_tx_icmp = 1;
+    }
+
+    return capabilities;
 }
 
 /**
@@ -515,8 +1156,7 @@ static int32_t SendFrame(const uint8_t *frame, uint32_t len, uint32_t flags,
     MAC_DEV *dev)
 {
     uint32_t cur_idx;
-    uint8_t *dst;
-    uint32_t buffer_len = len;
+    uint8_t *dst, *start, *fragment;
     DMA_DESC *desc;
 
     if (!frame || !len)
@@ -527,23 +1167,26 @@ static int32_t SendFrame(const uint8_t *frame, uint32_t len, uint32_t flags,
 
     cur_idx = dev->tx_desc_id;
     desc = &dev->tx_descs[cur_idx];
-
-    SCB_InvalidateDCache_by_Addr(desc, sizeof(DMA_DESC));
+    start = (uint8_t *) &tx_buffers[cur_idx][0];
 
     dst = dev->frame_end;
 
     if (dst == NULL) {
         /* new frame */
-        if (desc->des3 & TDES3_OWN) {
+        SCB_InvalidateDCache_by_Addr(desc, sizeof(DMA_DESC));
+
+        if ((desc->des3 & TDES3_OWN) || dev->tx_bufs[cur_idx]) {
+            dev->stats.tx_ring_full++;
             return ARM_DRIVER_ERROR_BUSY;
         }
-        dst = (uint8_t *) &tx_buffers[cur_idx][0];
-        desc->des2 = TDES2_INTERRUPT_ON_COMPLETION | buffer_len;
-    } else {
-        /* frame fragment */
-        desc->des2 += len;
+        dst = start;
     }
 
+    if (len > (uint32_t) (start + ETH_BUF_SIZE - dst))
+        return ARM_DRIVER_ERROR_PARAMETER;
+
+    fragment = dst;
+
     /* Copy the frame to the buffer */
     for ( ; len > 7; dst += 8, frame += 8, len -= 8) {
         ((uint32_t *) dst)[0] = ((uint32_t *) frame)[0];
@@ -556,7 +1199,8 @@ static int32_t SendFrame(const uint8_t *frame, uint32_t len, uint32_t flags,
     if (len > 0)
         dst++[0] = frame++[0];
 
-    SCB_CleanDCache_by_Addr((uint32_t *) &tx_buffers[cur_idx][0], ETH_BUF_SIZE);
+    /* Only the bytes just copied need to reach memory */
+    SCB_CleanDCache_by_Addr(fragment, dst - fragment);
 
     if (flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) {
         /* More data to come, remember current write position */
@@ -564,18 +1208,9 @@ static int32_t SendFrame(const uint8_t *frame, uint32_t len, uint32_t flags,
         return ARM_DRIVER_OK;
     }
 
-    dev->tx_desc_id++;
-    dev->tx_desc_id %= TX_DESC_COUNT;
-    desc->des0 = (uint32_t)LocalToGlobal(&tx_buffers[cur_idx][0]);
-
     dev->frame_end = NULL;
 
-    desc->des3 = TDES3_OWN | TDES3_LAST_DESCRIPTOR | TDES3_FIRST_DESCRIPTOR |
-                    buffer_len;
-
-    SCB_CleanDCache_by_Addr((uint32_t *) desc, sizeof(DMA_DESC));
-
-    dev->regs->DMA_CH0_TX_END_ADDR = (uint32_t) LocalToGlobal(&(dev->tx_descs[dev->tx_desc_id]));
+    submit_txdesc(dev, start, dst - start, NULL);
 
     return ARM_DRIVER_OK;
 }
@@ -603,22 +1238,9 @@ static int32_t ReadFrame(uint8_t *frame, uint32_t len, MAC_DEV *dev)
         return ARM_DRIVER_ERROR;
 
     cur_idx = dev->rx_desc_id;
-    src = (uint8_t *) &rx_buffers[cur_idx][0];
-
-    SCB_InvalidateDCache_by_Addr(src, ETH_BUF_SIZE);
-
-    /* copy data to the buffer */
-    for ( ; len > 7; frame += 8, src += 8, len -= 8) {
-        ((uint32_t *) frame)[0] = ((uint32_t *) src)[0];
-        ((uint32_t *) frame)[1] = ((uint32_t *) src)[1];
-    }
+    src = dev->rx_bufs[cur_idx];
 
-    /* copy remaining 7 bytes */
-    for ( ; len > 1; frame += 2, src += 2, len -= 2)
-        ((uint16_t *) frame)[0] = ((uint16_t *)src)[0];
-
-    if (len > 0)
-        frame[0] = src[0];
+    copy_rx_data(frame, src, len);
 
     /* refresh the descriptor */
     setup_rxdesc(dev, cur_idx);
@@ -627,6 +1249,7 @@ static int32_t ReadFrame(uint8_t *frame, uint32_t len, MAC_DEV *dev)
 
     dev->rx_desc_id++;
     dev->rx_desc_id %= RX_DESC_COUNT;
+    dev->stats.rx_frames++;
 
     return buffer_len;
 }
@@ -755,6 +1378,7 @@ static int32_t GetTxFrameTime(ARM_ETH_MAC_TIME *time, MAC_DEV *dev)
 static int32_t Control(uint32_t control, uint32_t arg, MAC_DEV *dev)
 {
     uint32_t val, reg;
+    DMA_DESC *desc;
 
     if (!(dev->flags & ETH_POWER))
         return ARM_DRIVER_ERROR;
@@ -786,10 +1410,32 @@ static int32_t Control(uint32_t control, uint32_t arg, MAC_DEV *dev)
         if (arg & ARM_ETH_MAC_LOOPBACK)
             val |= MAC_CONFIG_LM;
 
-        if ((arg & ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX) ||
-                    (arg & ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX))
+        val &= ~MAC_CONFIG_IPC;
+        reg = dev->regs->MAC_HW_FEATURE_0;
+
+        if (arg & ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX) {
+            if (!(reg & MAC_HW_FEATURE0_RXCOESEL))
+                return ARM_DRIVER_ERROR_UNSUPPORTED;
+            val |= MAC_CONFIG_IPC;
+        }
+
+        /* With FEP set the MTL would forward the frames that failed the
+         * Rx checksum check, cleared it drops them in store and forward mode */
+        if (arg & ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX)
+            dev->regs->MTL_RXQ0_OP_MODE &= ~(MTL_OP_MODE_FEP | MTL_OP_MODE_DIS_TCP_EF);
+        else
+            dev->regs->MTL_RXQ0_OP_MODE |= MTL_OP_MODE_FEP;
+
+        /* Tx insertion needs the Tx store and forward mode (TSF) */
+        if ((arg & ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX) &&
+                    !(reg & MAC_HW_FEATURE0_TXCOESEL))
             return ARM_DRIVER_ERROR_UNSUPPORTED;
 
+        if (arg & ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX)
+            dev->flags |= ETH_CSUM_TX;
+        else
+            dev->flags &= ~ETH_CSUM_TX;
+
         dev->regs->MAC_CONFIG = val;
 
         val = (dev->regs->MAC_PACKET_FILTER) & ~(MAC_PACKET_FILTER_PR |
@@ -849,6 +1495,7 @@ static int32_t Control(uint32_t control, uint32_t arg, MAC_DEV *dev)
             reg = val;
             val &= ~DMA_CONTROL_SR;
             dev->regs->DMA_CH0_RX_CTRL = val;
+            dev->rx_desc_id = 0;
             init_rx_descs(dev);
             dev->regs->DMA_CH0_RX_CTRL = reg;
         }
@@ -857,6 +1504,13 @@ static int32_t Control(uint32_t control, uint32_t arg, MAC_DEV *dev)
             reg = val;
             val &= ~DMA_CONTROL_ST;
             dev->regs->DMA_CH0_TX_CTRL = val;
+            if (dev->pool) {
+                NVIC_DisableIRQ(dev->irq);
+                reclaim_tx_bufs(dev, true);
+                NVIC_EnableIRQ(dev->irq);
+            }
+            dev->frame_end = NULL;
+            dev->tx_desc_id = 0;
             init_tx_descs(dev);
             dev->regs->DMA_CH0_TX_CTRL = reg;
         }
@@ -874,6 +1528,49 @@ static int32_t Control(uint32_t control, uint32_t arg, MAC_DEV *dev)
             dev->regs->MAC_PMT_CTRL_STS = 0x0;
         }
         break;
+
+    case ARM_ETH_MAC_SET_BUFFER_POOL:
+        return set_buffer_pool(dev, (const ARM_ETH_MAC_BUFFER_POOL *) arg);
+
+    case ARM_ETH_MAC_RX_FRAME_TAKE:
+        return rx_frame_take(dev, (ARM_ETH_MAC_FRAME_BUFFER *) arg);
+
+    case ARM_ETH_MAC_TX_FRAME_SEND:
+        return tx_frame_send(dev, (const ARM_ETH_MAC_FRAME_BUFFER *) arg);
+
+    case ARM_ETH_MAC_RX_FRAME_STATUS:
+        if (!arg)
+            return ARM_DRIVER_ERROR_PARAMETER;
+
+        desc = &dev->rx_descs[dev->rx_desc_id];
+
+        SCB_InvalidateDCache_by_Addr(desc, sizeof(DMA_DESC));
+
+        if (desc->des3 & RDES3_OWN)
+            return ARM_DRIVER_ERROR_BUSY;
+
+        *(uint32_t *) arg = rx_frame_status(desc);
+        break;
+
+    case ARM_ETH_MAC_SET_RX_COALESCE:
+        return set_rx_coalesce(dev, arg);
+
+    case ARM_ETH_MAC_RX_FRAMES_READ:
+        return rx_frames_read(dev, (ARM_ETH_MAC_FRAME_BATCH *) arg);
+
+    case ARM_ETH_MAC_TX_FRAMES_SEND:
+        return tx_frames_send(dev, (ARM_ETH_MAC_TX_BATCH *) arg);
+
+    case ARM_ETH_MAC_GET_STATS:
+        if (!arg)
+            return ARM_DRIVER_ERROR_PARAMETER;
+
+        NVIC_DisableIRQ(dev->irq);
+        update_rx_drop_stats(dev);
+        *(ARM_ETH_MAC_STATS *) arg = dev->stats;
+        NVIC_EnableIRQ(dev->irq);
+        break;
+
   default:
         return ARM_DRIVER_ERROR_UNSUPPORTED;
   }
@@ -990,13 +1687,24 @@ static void ETH_IRQHandler(MAC_DEV *dev)
         ch0_stat = dev->regs->DMA_CH0_STATUS;
 
         dev->regs->DMA_CH0_STATUS =
-		ch0_stat & (DMA_CHAN_STATUS_NIS | DMA_CHAN_STATUS_RI | DMA_CHAN_STATUS_TI);
+		ch0_stat & (DMA_CHAN_STATUS_NIS | DMA_CHAN_STATUS_RI | DMA_CHAN_STATUS_TI |
+                    DMA_CHAN_STATUS_AIS | DMA_CHAN_STATUS_RBU);
 
         if (ch0_stat & DMA_CHAN_STATUS_RI)
             event |= ARM_ETH_MAC_EVENT_RX_FRAME;
 
-        if (ch0_stat & DMA_CHAN_STATUS_TI)
+        /* The Rx ring is full: frames now pile up in the Rx FIFO */
+        if (ch0_stat & DMA_CHAN_STATUS_RBU) {
+            dev->stats.rx_ring_full++;
+            update_rx_drop_stats(dev);
+            event |= ARM_ETH_MAC_EVENT_RX_FRAME;
+        }
+
+        if (ch0_stat & DMA_CHAN_STATUS_TI) {
+            if (dev->pool)
+                reclaim_tx_bufs(dev, false);
             event |= ARM_ETH_MAC_EVENT_TX_FRAME;
+        }
 
         if (event && dev->cb_event)
             dev->cb_event(event);
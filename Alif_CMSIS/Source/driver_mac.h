@@ -22,7 +22,10 @@
 #ifndef _DRIVER_MAC_H_
 #define _DRIVER_MAC_H_
 
+#include <stdbool.h>
+
 #include <Driver_ETH_MAC.h>
+#include "Driver_ETH_MAC_EX.h"
 
 #include "RTE_Device.h"
 #include "RTE_Components.h"
@@ -38,13 +41,52 @@
 
 #include "system_utils.h"
 
-#define RX_DESC_COUNT   8 /**< Rx DMA descriptor count */
-#define TX_DESC_COUNT   8 /**< Tx DMA descriptor count */
+#ifdef RTE_ETH_MAC_RX_DESC_COUNT
+#define RX_DESC_COUNT   RTE_ETH_MAC_RX_DESC_COUNT /**< Rx DMA descriptor count */
+#else
+#define RX_DESC_COUNT   8
+#endif
+
+#ifdef RTE_ETH_MAC_TX_DESC_COUNT
+#define TX_DESC_COUNT   RTE_ETH_MAC_TX_DESC_COUNT /**< Tx DMA descriptor count */
+#else
+#define TX_DESC_COUNT   8
+#endif
+
+/* The ring length registers hold 10 bits */
+#if (RX_DESC_COUNT < 4) || (RX_DESC_COUNT > 1024)
+#error "RTE_ETH_MAC_RX_DESC_COUNT must be in the range 4 - 1024"
+#endif
+
+#if (TX_DESC_COUNT < 4) || (TX_DESC_COUNT > 1024)
+#error "RTE_ETH_MAC_TX_DESC_COUNT must be in the range 4 - 1024"
+#endif
 
-/* Each descriptor is 16 bytes */
-#define DESCS_AREA_SIZE   ((RX_DESC_COUNT + TX_DESC_COUNT) * 16) /**< Total memory area needed for descs */
+#ifndef RTE_ETH_MAC_RX_COALESCE_FRAMES
+#define RTE_ETH_MAC_RX_COALESCE_FRAMES    1
+#endif
 
-#define ETH_BUF_SIZE    1536 /**< Ethernet buffer size */
+#ifndef RTE_ETH_MAC_RX_COALESCE_TIMEOUT
+#define RTE_ETH_MAC_RX_COALESCE_TIMEOUT   0
+#endif
+
+/* An Rx interrupt is armed on one descriptor out of the frame count */
+#if (RTE_ETH_MAC_RX_COALESCE_FRAMES < 1) || (RTE_ETH_MAC_RX_COALESCE_FRAMES > RX_DESC_COUNT)
+#error "RTE_ETH_MAC_RX_COALESCE_FRAMES must be in the range 1 - RTE_ETH_MAC_RX_DESC_COUNT"
+#endif
+
+/* Without the watchdog the last frames of a burst would never be signalled */
+#if (RTE_ETH_MAC_RX_COALESCE_FRAMES > 1) && (RTE_ETH_MAC_RX_COALESCE_TIMEOUT == 0)
+#error "RTE_ETH_MAC_RX_COALESCE_FRAMES above 1 needs RTE_ETH_MAC_RX_COALESCE_TIMEOUT"
+#endif
+
+/* Each descriptor is padded to a 32 byte cache line, the DMA skips the padding */
+#define DESCS_AREA_SIZE   ((RX_DESC_COUNT + TX_DESC_COUNT) * sizeof(DMA_DESC)) /**< Total memory area needed for descs */
+
+#define DMA_DESC_PAD_WORDS  4U   /**< Words after des3 the DMA skips (DMA_CH0_CTRL.DSL) */
+#define DMA_BUS_WIDTH       8U   /**< Data width of the ETH DMA AXI master, in bytes */
+
+#define ETH_BUF_SIZE    ARM_ETH_MAC_BUFFER_SIZE /**< Ethernet buffer size */
 
 /** \brief Rx/Tx Dma Descriptor. */
 typedef struct {
@@ -52,6 +94,7 @@ typedef struct {
   uint32_t des1;
   uint32_t des2;
   uint32_t des3;
+  uint32_t pad[DMA_DESC_PAD_WORDS];   /**< Keeps each descriptor in its own cache line */
 } DMA_DESC;
 
 /** \brief MAC register map. */
@@ -101,7 +144,8 @@ typedef struct {
     uint32_t MTL_TXQ0_OP_MODE;
     uint32_t RESERVED_10[11];
     uint32_t MTL_RXQ0_OP_MODE;
-    uint32_t RESERVED_11[179];
+    uint32_t MTL_RXQ0_MISSED_PKT_OVF_CNT;
+    uint32_t RESERVED_11[178];
     uint32_t DMA_BUS_MODE;
     uint32_t DMA_SYS_BUS_MODE;
     uint32_t DMA_STATUS;
@@ -120,8 +164,10 @@ typedef struct {
     uint32_t DMA_CHO_TX_RING_LEN;
     uint32_t DMA_CH0_RX_RING_LEN;
     uint32_t DMA_CH0_INT_ENABLE;
-    uint32_t RESERVED_15[10];
+    uint32_t DMA_CH0_RX_INTR_WDT;
+    uint32_t RESERVED_15[9];
     uint32_t DMA_CH0_STATUS;
+    uint32_t DMA_CH0_MISS_FRAME_CNT;
 } MAC_REGS;
 
 /** \brief Representation of MAC device. */
@@ -136,12 +182,19 @@ typedef struct {
   IRQn_Type irq;                     /**< IRQ number of the Ethernet MAC instance */
   uint8_t irq_priority;              /**< priority of the ETH MAC IRQ */
   uint8_t flags;                     /**< MAC driver flags */
+  uint16_t rx_coalesce_frames;       /**< Rx frames per Rx interrupt */
+  uint8_t rx_coalesce_timeout;       /**< Rx interrupt watchdog, in units of 256 clock cycles */
   uint8_t *frame_end;                /**< Current frame address, to support fragments */
+  const ARM_ETH_MAC_BUFFER_POOL *pool;  /**< Zero-copy buffer pool, NULL in copy mode */
+  uint8_t *rx_bufs[RX_DESC_COUNT];      /**< Buffer attached to each Rx DMA descriptor */
+  const uint8_t *tx_bufs[TX_DESC_COUNT];/**< Zero-copy buffer in flight on each Tx DMA descriptor */
+  ARM_ETH_MAC_STATS stats;           /**< Frame and drop counters */
 } MAC_DEV;
 
 /** \brief Driver state flags */
 #define ETH_INIT			                    0x01 /**< Driver initialized */
 #define ETH_POWER			                    0x02 /**< Driver power on */
+#define ETH_CSUM_TX			                    0x04 /**< Tx checksum insertion enabled */
 
 /*  MAC register fields */
 
@@ -184,6 +237,12 @@ typedef struct {
 #define DMA_CH0_RX_CONTROL_RBSZ_MASK            0x3fff
 #define DMA_CH0_RX_CONTROL_SR                   BIT(0)
 
+#define DMA_CH0_RX_INTR_WDT_RWT_MASK            0xff
+#define DMA_CH0_RX_INTR_WDT_RWTU_SHIFT          16  /* 0: units of 256 clock cycles */
+
+#define DMA_CH0_MISS_FRAME_CNT_MFC_MASK         MASK(10, 0)
+#define DMA_CH0_MISS_FRAME_CNT_MFCO             BIT(15)
+
 #define DMA_SYSBUS_MODE_RD_OSR_LMT_SHIFT        16
 #define DMA_SYSBUS_MODE_RD_OSR_LMT_MASK         0xf
 #define DMA_SYSBUS_MODE_WR_OSR_LMT_SHIFT        24
@@ -266,6 +325,9 @@ typedef struct {
 #define MAC_INT_EN_TSIE                         BIT(12)
 #define MAC_INT_EN_PMTIE                        BIT(4)
 
+#define MAC_HW_FEATURE0_RXCOESEL                BIT(16)
+#define MAC_HW_FEATURE0_TXCOESEL                BIT(14)
+
 #define MAC_HW_FEATURE1_TXFIFOSIZE_SHIFT        6
 #define MAC_HW_FEATURE1_TXFIFOSIZE_MASK         0x1f
 #define MAC_HW_FEATURE1_RXFIFOSIZE_SHIFT        0
@@ -282,6 +344,7 @@ typedef struct {
 #define MTL_OPERATION_RAA_SP                    (0x0 << 2)
 #define MTL_OPERATION_RAA_WSP                   (0x1 << 2)
 
+#define MTL_OP_MODE_DIS_TCP_EF                  BIT(6)
 #define MTL_OP_MODE_RSF                         BIT(5)
 #define MTL_OP_MODE_FEP			                BIT(4)
 #define MTL_OP_MODE_FUP						    BIT(3)
@@ -297,6 +360,12 @@ typedef struct {
 #define MTL_RXQ0_OPERATION_MODE_RQS_SHIFT       20
 #define MTL_RXQ0_OPERATION_MODE_RQS_MASK        0x3ff
 
+#define MTL_RXQ0_OVF_CNT_OVFPKTCNT_MASK         MASK(10, 0)
+#define MTL_RXQ0_OVF_CNT_OVFCNTOVF              BIT(11)
+#define MTL_RXQ0_OVF_CNT_MISPKTCNT_MASK         MASK(26, 16)
+#define MTL_RXQ0_OVF_CNT_MISPKTCNT_SHIFT        16
+#define MTL_RXQ0_OVF_CNT_MISCNTOVF              BIT(27)
+
 
 /* DMA Bus Mode bitmap */
 #define DMA_BUS_MODE_SFT_RESET		            BIT(0)
@@ -327,6 +396,8 @@ typedef struct {
 #define DMA_CONTROL_MSS_MASK                    MASK(13, 0)
 
 #define DMA_CHAN_CONTROL_PBLX8		            BIT(16)
+#define DMA_CHAN_CONTROL_DSL_SHIFT              18
+#define DMA_CHAN_CONTROL_DSL_MASK               MASK(20, 18)
 
 /* DMA Tx Channel X Control register defines */
 #define DMA_CONTROL_EDSE                        BIT(28)
@@ -394,6 +465,7 @@ typedef struct {
 #define TDES3_VLTV			                    BIT(16)
 #define TDES3_CHECKSUM_INSERTION_MASK	        MASK(17, 16)
 #define TDES3_CHECKSUM_INSERTION_SHIFT	        16
+#define TDES3_CHECKSUM_INSERTION_FULL	        (3 << TDES3_CHECKSUM_INSERTION_SHIFT)
 #define TDES3_TCP_PKT_PAYLOAD_MASK	            MASK(17, 0)
 #define TDES3_TCP_SEGMENTATION_ENABLE	        BIT(18)
 #define TDES3_HDR_LEN_SHIFT		                19
@@ -65,9 +65,11 @@ static uint8_t lcd_image2[DIMAGE_Y][DIMAGE_X][PIXEL_BYTES] __attribute__((sectio
 extern ARM_DRIVER_CDC200 Driver_CDC200;
 static ARM_DRIVER_CDC200 *CDCdrv = &Driver_CDC200;
 
-volatile uint8_t line_irq_status = 0;
 volatile uint8_t dsi_err = 0;
 
+/* Display driver waiting for the flushed buffer to be shown */
+static lv_disp_drv_t *volatile flush_disp_drv = NULL;
+
 /**
   \fn          void hw_disp_cb(uint32_t event)
   \brief       Display callback
@@ -76,10 +78,14 @@ volatile uint8_t dsi_err = 0;
   */
 void hw_disp_cb(uint32_t event)
 {
-    if(event & ARM_CDC_SCANLINE0_EVENT)
+    if(event & ARM_CDC_LAYER1_FLIP_EVENT)
     {
-        /* Received scan line event. */
-        line_irq_status = 1;
+        /* Flushed buffer is on screen, the previous one can be rendered again. */
+        if(flush_disp_drv != NULL)
+        {
+            lv_disp_flush_ready(flush_disp_drv);
+            flush_disp_drv = NULL;
+        }
     }
 
     if(event & ARM_CDC_DSI_ERROR_EVENT)
@@ -182,14 +188,6 @@ static void hw_disp_init(void)
         goto error_CDC200_poweroff;
     }
 
-    /* Configure CDC200 controller */
-    ret = CDCdrv->Control(CDC200_SCANLINE0_EVENT, ENABLE);
-    if(ret != ARM_DRIVER_OK)
-    {
-        /* Error in CDC200 control configuration */
-        printf("\r\n Error: CDC200 control configuration failed.\r\n");
-    }
-
     /* Start CDC200 controller */
     ret = CDCdrv->Start();
     if(ret != ARM_DRIVER_OK)
@@ -378,39 +376,28 @@ error_GT911_uninitialize:
 static void lv_disp_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
 {
     int ret = 0 ;
-    int lp_count = 0;
-
-    while(dsi_err == 0 && line_irq_status == 0)
-    {
-        if(lp_count++ < 1000000)
-        {
-            sys_busy_loop_us(1);
-        }
-        else
-        {
-            printf("Error: Scan line event did not occurred.\r\n");
-            return;
-        }
-    }
+    ARM_CDC200_PAGE_FLIP_INFO flip = {0};
 
     if(dsi_err == 1)
     {
         printf("Error: DSI error occurred.\r\n");
+        lv_disp_flush_ready(disp_drv);
         return;
     }
 
-    line_irq_status = 0;
+    /* Show the rendered buffer from the next vertical blanking on,
+     * flushing is reported done from the display callback. */
+    flush_disp_drv = disp_drv;
+    flip.fb_addr[ARM_CDC200_LAYER_1] = (uint32_t) color_p;
 
-    /* Configure CDC200 controller */
-    ret = CDCdrv->Control(CDC200_FRAMEBUF_UPDATE, (uint32_t) color_p);
+    ret = CDCdrv->Control(CDC200_PAGE_FLIP, (uint32_t) &flip);
     if(ret != ARM_DRIVER_OK)
     {
-        /* Error in CDC200 control configuration */
-        printf("\r\n Error: CDC200 control configuration failed.\r\n");
+        /* Error in CDC200 page flip */
+        printf("\r\n Error: CDC200 page flip failed.\r\n");
+        flush_disp_drv = NULL;
+        lv_disp_flush_ready(disp_drv);
     }
-
-    /* Indicating flushing is done to display */
-    lv_disp_flush_ready(disp_drv);
 }
 
 /**
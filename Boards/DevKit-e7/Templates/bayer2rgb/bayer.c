@@ -36,6 +36,17 @@
  *             - Selected Bayer Method:
  *               - dc1394 Bayer HQLinear Method
  *             - Commented out all other unused Bayer methods.
+ *             - Helium (MVE) inner loops for the Simple, Bilinear and
+ *               HQLinear methods (8-bit and 16-bit), bit-exact with the
+ *               scalar loops which remain as reference and line tail.
+ *             - Streaming 8-bit decoding from a caller-provided line
+ *               buffer arena (dc1394_bayer_stream_*).
+ *             - Fused 8-bit decoding into RGB565 / planar int8 with 2x/4x
+ *               downscale (dc1394_bayer_decoding_8bit_output).
+ *             - Row band tiled 8-bit decoding over a pluggable worker
+ *               interface (dc1394_bayer_decoding_8bit_tiled).
+ *             - Host test harness (host/bayer_test.c) checking all of the
+ *               above bit-exactly against the scalar reference.
  ******************************************************************************/
 
 #include <limits.h>
@@ -45,29 +56,54 @@
 //#include "conversions.h"
 #include "bayer.h"
 
-/* At the time of writing, GCC produces incorrect assembly */
+/* At the time of writing, GCC produces incorrect assembly.
+ * Define ENABLE_MVE_BAYER2RGB to 0 to run only the scalar reference loops.
+ */
+#ifndef ENABLE_MVE_BAYER2RGB
 #define ENABLE_MVE_BAYER2RGB (__ARMCC_VERSION >= 6180002 && (__ARM_FEATURE_MVE & 1))
+#endif
 
-#if __ARM_FEATURE_MVE & 1
+#if ENABLE_MVE_BAYER2RGB
 #include <arm_mve.h>
 #endif
 
+#ifndef ENABLE_8_BIT_VERSION
 #define ENABLE_8_BIT_VERSION      1   /* Enable 8-bit Version. */
+#endif
+#ifndef ENABLE_16_BIT_VERSION
 #define ENABLE_16_BIT_VERSION     0   /* Enable 16-bit Version.(Not Tested.) */
+#endif
 
 #if ENABLE_8_BIT_VERSION
 /* Only enabled dc1394 Bayer HQLinear Method for Bayer to RGB Conversion.
  * remaining all methods are disable to fix memory issues.
+ * Each method can be enabled from the command line (e.g. host tests).
  */
+#ifndef ENABLE_DC1394_BAYER_METHOD_HQLINEAR
 #define ENABLE_DC1394_BAYER_METHOD_HQLINEAR        1
+#endif
+#ifndef ENABLE_DC1394_BAYER_METHOD_NEAREST
 #define ENABLE_DC1394_BAYER_METHOD_NEAREST         0
+#endif
+#ifndef ENABLE_DC1394_BAYER_METHOD_BILINEAR
 #define ENABLE_DC1394_BAYER_METHOD_BILINEAR        0
+#endif
+#ifndef ENABLE_DC1394_BAYER_METHOD_EDGESENSE
 #define ENABLE_DC1394_BAYER_METHOD_EDGESENSE       0
+#endif
+#ifndef ENABLE_DC1394_BAYER_METHOD_DOWNSAMPLE
 #define ENABLE_DC1394_BAYER_METHOD_DOWNSAMPLE      0
+#endif
+#ifndef ENABLE_DC1394_BAYER_METHOD_SIMPLE
 #define ENABLE_DC1394_BAYER_METHOD_SIMPLE          0
+#endif
+#ifndef ENABLE_DC1394_BAYER_METHOD_VNG
 #define ENABLE_DC1394_BAYER_METHOD_VNG             0
+#endif
+#ifndef ENABLE_DC1394_BAYER_METHOD_AHD
 #define ENABLE_DC1394_BAYER_METHOD_AHD             0
 #endif
+#endif
 
 #define CLIP(in, out)\
    in = in < 0 ? 0 : in;\
@@ -129,6 +165,47 @@ ClearBorders_uint16(uint16_t * rgb, int sx, int sy, int w)
 
 }
 
+#if ENABLE_MVE_BAYER2RGB
+/* Helium helpers.
+ * Pixel pairs are de-interleaved with vld2q so that lane k holds pair k.
+ * Arithmetic that needs more headroom than the input width is done on the
+ * even (bottom) and odd (top) lanes separately and narrowed back in place.
+ * All helpers round exactly like the scalar code.
+ */
+#define BAYER_WIDEN_U8(v, top)      vreinterpretq_s16_u16((top) ? vmovltq_u8(v) : vmovlbq_u8(v))
+#define BAYER_WIDEN_U16(v, top)     vreinterpretq_s32_u32((top) ? vmovltq_u16(v) : vmovlbq_u16(v))
+
+/* (a + b + c + d + 2) >> 2 */
+static inline uint8x16_t
+bayer_avg4_u8(uint8x16_t a, uint8x16_t b, uint8x16_t c, uint8x16_t d)
+{
+    uint16x8_t lo = vaddq_u16(vaddq_u16(vmovlbq_u8(a), vmovlbq_u8(b)),
+                              vaddq_u16(vmovlbq_u8(c), vmovlbq_u8(d)));
+    uint16x8_t hi = vaddq_u16(vaddq_u16(vmovltq_u8(a), vmovltq_u8(b)),
+                              vaddq_u16(vmovltq_u8(c), vmovltq_u8(d)));
+    uint8x16_t res = vdupq_n_u8(0);
+
+    res = vmovnbq_u16(res, vrshrq_n_u16(lo, 2));
+    res = vmovntq_u16(res, vrshrq_n_u16(hi, 2));
+    return res;
+}
+
+/* (a + b + c + d + 2) >> 2 */
+static inline uint16x8_t
+bayer_avg4_u16(uint16x8_t a, uint16x8_t b, uint16x8_t c, uint16x8_t d)
+{
+    uint32x4_t lo = vaddq_u32(vaddq_u32(vmovlbq_u16(a), vmovlbq_u16(b)),
+                              vaddq_u32(vmovlbq_u16(c), vmovlbq_u16(d)));
+    uint32x4_t hi = vaddq_u32(vaddq_u32(vmovltq_u16(a), vmovltq_u16(b)),
+                              vaddq_u32(vmovltq_u16(c), vmovltq_u16(d)));
+    uint16x8_t res = vdupq_n_u16(0);
+
+    res = vmovnbq_u32(res, vrshrq_n_u32(lo, 2));
+    res = vmovntq_u32(res, vrshrq_n_u32(hi, 2));
+    return res;
+}
+#endif /* ENABLE_MVE_BAYER2RGB */
+
 /**************************************************************
  *     Color conversion functions for cameras that can        *
  * output raw-Bayer pattern images, such as some Basler and   *
@@ -231,13 +308,17 @@ dc1394_bayer_NearestNeighbor(const uint8_t *restrict bayer, uint8_t *restrict rg
 
 /* OpenCV's Bayer decoding */
 #if ENABLE_DC1394_BAYER_METHOD_BILINEAR
-dc1394error_t
-dc1394_bayer_Bilinear(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx, int sy, int tile)
+/* Interpolates `rows` output lines of width sx, excluding the 1 pixel
+ * left/right border. bayer points at the line above the first output line,
+ * rgb at the first output line, row is the frame row of bayer[0].
+ */
+static void
+dc1394_bayer_Bilinear_rows(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx, int rows, int tile, int row)
 {
     const int bayerStep = sx;
     const int rgbStep = 3 * sx;
     int width = sx;
-    int height = sy;
+    int height = rows;
     /*
        the two letters  of the OpenCV name are respectively
        the 4th and 3rd letters from the blinky name,
@@ -255,14 +336,19 @@ dc1394_bayer_Bilinear(const uint8_t *restrict bayer, uint8_t *restrict rgb, int
     int start_with_green = tile == DC1394_COLOR_FILTER_GBRG
         || tile == DC1394_COLOR_FILTER_GRBG;
 
-    if ((tile>DC1394_COLOR_FILTER_MAX)||(tile<DC1394_COLOR_FILTER_MIN))
-        return DC1394_INVALID_COLOR_FILTER;
+    if (row & 1) {
+        blue = -blue;
+        start_with_green = !start_with_green;
+    }
 
-    ClearBorders(rgb, sx, sy, 1);
-    rgb += rgbStep + 3 + 1;
-    height -= 2;
+    rgb += 3 + 1;
     width -= 2;
 
+#if ENABLE_MVE_BAYER2RGB
+    /* Index table into 16 RGB pairs for scatter stores: { 0, 6, 12, .. } */
+    const uint8x16_t inc6 = vmulq_n_u8(vidupq_n_u8(0, 1), 6);
+#endif
+
     for (; height--; bayer += bayerStep, rgb += rgbStep) {
         int t0, t1;
         const uint8_t *bayerEnd = bayer + width;
@@ -279,6 +365,30 @@ dc1394_bayer_Bilinear(const uint8_t *restrict bayer, uint8_t *restrict rgb, int
             rgb += 3;
         }
 
+#if ENABLE_MVE_BAYER2RGB
+        /* 16 pixel pairs per iteration, the scalar loops below finish the line.
+         * Loads stay within the pixels the scalar loop would read.
+         */
+        for (; bayer <= bayerEnd - 32; bayer += 32, rgb += 96) {
+            uint8x16x2_t r0a = vld2q_u8(bayer);                     /* [0]     [1]     */
+            uint8x16x2_t r0b = vld2q_u8(bayer + 1);                 /* [1]     [2]     */
+            uint8x16x2_t r1a = vld2q_u8(bayer + bayerStep);         /* [s]     [s+1]   */
+            uint8x16x2_t r1b = vld2q_u8(bayer + bayerStep + 2);     /* [s+2]   [s+3]   */
+            uint8x16x2_t r2a = vld2q_u8(bayer + bayerStep * 2);     /* [2s]    [2s+1]  */
+            uint8x16x2_t r2b = vld2q_u8(bayer + bayerStep * 2 + 1); /* [2s+1]  [2s+2]  */
+
+            vstrbq_scatter_offset_u8(rgb - blue, inc6,
+                bayer_avg4_u8(r0a.val[0], r0b.val[1], r2a.val[0], r2b.val[1]));
+            vstrbq_scatter_offset_u8(rgb, inc6,
+                bayer_avg4_u8(r0a.val[1], r1a.val[0], r1b.val[0], r2a.val[1]));
+            vstrbq_scatter_offset_u8(rgb + blue, inc6, r1a.val[1]);
+
+            vstrbq_scatter_offset_u8(rgb + 3 - blue, inc6, vrhaddq_u8(r0b.val[1], r2b.val[1]));
+            vstrbq_scatter_offset_u8(rgb + 3, inc6, r1b.val[0]);
+            vstrbq_scatter_offset_u8(rgb + 3 + blue, inc6, vrhaddq_u8(r1a.val[1], r1b.val[1]));
+        }
+#endif
+
         if (blue > 0) {
             for (; bayer <= bayerEnd - 2; bayer += 2, rgb += 6) {
                 t0 = (bayer[0] + bayer[2] + bayer[bayerStep * 2] +
@@ -336,6 +446,17 @@ dc1394_bayer_Bilinear(const uint8_t *restrict bayer, uint8_t *restrict rgb, int
         blue = -blue;
         start_with_green = !start_with_green;
     }
+}
+
+dc1394error_t
+dc1394_bayer_Bilinear(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx, int sy, int tile)
+{
+    if ((tile>DC1394_COLOR_FILTER_MAX)||(tile<DC1394_COLOR_FILTER_MIN))
+        return DC1394_INVALID_COLOR_FILTER;
+
+    ClearBorders(rgb, sx, sy, 1);
+    dc1394_bayer_Bilinear_rows(bayer, rgb + 3 * sx, sx, sy - 2, tile, 0);
+
     return DC1394_SUCCESS;
 }
 #endif /* end of ENABLE_DC1394_BAYER_METHOD_BILINEAR */
@@ -344,29 +465,38 @@ dc1394_bayer_Bilinear(const uint8_t *restrict bayer, uint8_t *restrict rgb, int
    Bayer-Patterned Color Images, by Henrique S. Malvar, Li-wei He, and
    Ross Cutler, in ICASSP'04 */
 #if ENABLE_DC1394_BAYER_METHOD_HQLINEAR
-dc1394error_t
-dc1394_bayer_HQLinear(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx, int sy, int tile)
+/* Interpolates `rows` output lines of width sx, excluding the 2 pixel
+ * left/right border. bayer points two lines above the first output line,
+ * rgb at the first output line, row is the frame row of bayer[0].
+ */
+static void
+dc1394_bayer_HQLinear_rows(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx, int rows, int tile, int row)
 {
     const int bayerStep = sx;
     const int rgbStep = 3 * sx;
     int width = sx;
-    int height = sy;
+    int height = rows;
     int blue = tile == DC1394_COLOR_FILTER_BGGR
         || tile == DC1394_COLOR_FILTER_GBRG ? -1 : 1;
     int start_with_green = tile == DC1394_COLOR_FILTER_GBRG
         || tile == DC1394_COLOR_FILTER_GRBG;
 
-    if ((tile>DC1394_COLOR_FILTER_MAX)||(tile<DC1394_COLOR_FILTER_MIN))
-      return DC1394_INVALID_COLOR_FILTER;
+    if (row & 1) {
+        blue = -blue;
+        start_with_green = !start_with_green;
+    }
 
-    ClearBorders(rgb, sx, sy, 2);
-    rgb += 2 * rgbStep + 6 + 1;
-    height -= 4;
+    rgb += 6 + 1;
     width -= 4;
 
     /* We begin with a (+1 line,+1 column) offset with respect to bilinear decoding, so start_with_green is the same, but blue is opposite */
     blue = -blue;
 
+#if ENABLE_MVE_BAYER2RGB
+    /* Index table into 16 RGB pairs for scatter stores: { 0, 6, 12, .. } */
+    const uint8x16_t inc6 = vmulq_n_u8(vidupq_n_u8(0, 1), 6);
+#endif
+
     for (; height--; bayer += bayerStep, rgb += rgbStep) {
         int t0, t1;
         const uint8_t *bayerEnd = bayer + width;
@@ -403,6 +533,84 @@ dc1394_bayer_HQLinear(const uint8_t *restrict bayer, uint8_t *restrict rgb, int
             rgb += 3;
         }
 
+#if ENABLE_MVE_BAYER2RGB
+        /* 16 pixel pairs per iteration, the scalar loops below finish the line.
+         * Loads stay within the pixels the scalar loop would read.
+         */
+        for (; bayer <= bayerEnd - 32; bayer += 32, rgb += 96) {
+            uint8x16x2_t r0  = vld2q_u8(bayer + 2);                 /* [2]      [3]      */
+            uint8x16x2_t r1a = vld2q_u8(bayer + bayerStep + 1);     /* [s+1]    [s+2]    */
+            uint8x16x2_t r1b = vld2q_u8(bayer + bayerStep + 3);     /* [s+3]    [s+4]    */
+            uint8x16x2_t r2a = vld2q_u8(bayer + bayerStep2);        /* [2s]     [2s+1]   */
+            uint8x16x2_t r2b = vld2q_u8(bayer + bayerStep2 + 2);    /* [2s+2]   [2s+3]   */
+            uint8x16x2_t r2c = vld2q_u8(bayer + bayerStep2 + 4);    /* [2s+4]   [2s+5]   */
+            uint8x16x2_t r3a = vld2q_u8(bayer + bayerStep3 + 1);    /* [3s+1]   [3s+2]   */
+            uint8x16x2_t r3b = vld2q_u8(bayer + bayerStep3 + 3);    /* [3s+3]   [3s+4]   */
+            uint8x16x2_t r4  = vld2q_u8(bayer + bayerStep4 + 2);    /* [4s+2]   [4s+3]   */
+            /* rounded halves fit in 8 bits */
+            uint8x16_t h_row = vrhaddq_u8(r2a.val[1], r2c.val[1]);
+            uint8x16_t h_col = vrhaddq_u8(r0.val[1], r4.val[1]);
+            uint8x16_t o0 = vdupq_n_u8(0), o1 = o0, o2 = o0, o3 = o0;
+
+            for (int top = 0; top < 2; top++) {
+                int16x8_t c = BAYER_WIDEN_U8(r2b.val[0], top);
+                int16x8_t g = BAYER_WIDEN_U8(r2b.val[1], top);
+                int16x8_t far = vaddq_s16(vaddq_s16(BAYER_WIDEN_U8(r0.val[0], top),
+                                                    BAYER_WIDEN_U8(r2a.val[0], top)),
+                                          vaddq_s16(BAYER_WIDEN_U8(r2c.val[0], top),
+                                                    BAYER_WIDEN_U8(r4.val[0], top)));
+                int16x8_t diag = vaddq_s16(vaddq_s16(BAYER_WIDEN_U8(r1a.val[0], top),
+                                                     BAYER_WIDEN_U8(r1b.val[0], top)),
+                                           vaddq_s16(BAYER_WIDEN_U8(r3a.val[0], top),
+                                                     BAYER_WIDEN_U8(r3b.val[0], top)));
+                int16x8_t cross = vaddq_s16(vaddq_s16(BAYER_WIDEN_U8(r1a.val[1], top),
+                                                      BAYER_WIDEN_U8(r2a.val[1], top)),
+                                            vaddq_s16(BAYER_WIDEN_U8(r2b.val[1], top),
+                                                      BAYER_WIDEN_U8(r3a.val[1], top)));
+                int16x8_t ring = vaddq_s16(vaddq_s16(BAYER_WIDEN_U8(r1a.val[1], top),
+                                                     BAYER_WIDEN_U8(r1b.val[1], top)),
+                                           vaddq_s16(BAYER_WIDEN_U8(r3a.val[1], top),
+                                                     BAYER_WIDEN_U8(r3b.val[1], top)));
+                int16x8_t g5 = vmulq_n_s16(g, 5);
+                int16x8_t t;
+
+                /* R at B (B at R) */
+                t = vsubq_s16(vshlq_n_s16(diag, 1),
+                              vshrq_n_s16(vaddq_n_s16(vmulq_n_s16(far, 3), 1), 1));
+                t = vrshrq_n_s16(vaddq_s16(t, vmulq_n_s16(c, 6)), 3);
+                o0 = top ? vqmovuntq_s16(o0, t) : vqmovunbq_s16(o0, t);
+
+                /* G at B (G at R) */
+                t = vsubq_s16(vshlq_n_s16(cross, 1), far);
+                t = vrshrq_n_s16(vaddq_s16(t, vshlq_n_s16(c, 2)), 3);
+                o1 = top ? vqmovuntq_s16(o1, t) : vqmovunbq_s16(o1, t);
+
+                /* at green pixel, vertical neighbours */
+                t = vaddq_s16(g5, vshlq_n_s16(vaddq_s16(BAYER_WIDEN_U8(r1b.val[0], top),
+                                                        BAYER_WIDEN_U8(r3b.val[0], top)), 2));
+                t = vsubq_s16(t, vaddq_s16(ring, vaddq_s16(BAYER_WIDEN_U8(r0.val[1], top),
+                                                           BAYER_WIDEN_U8(r4.val[1], top))));
+                t = vrshrq_n_s16(vaddq_s16(t, BAYER_WIDEN_U8(h_row, top)), 3);
+                o2 = top ? vqmovuntq_s16(o2, t) : vqmovunbq_s16(o2, t);
+
+                /* at green pixel, horizontal neighbours */
+                t = vaddq_s16(g5, vshlq_n_s16(vaddq_s16(BAYER_WIDEN_U8(r2b.val[0], top),
+                                                        BAYER_WIDEN_U8(r2c.val[0], top)), 2));
+                t = vsubq_s16(t, vaddq_s16(ring, vaddq_s16(BAYER_WIDEN_U8(r2a.val[1], top),
+                                                           BAYER_WIDEN_U8(r2c.val[1], top))));
+                t = vrshrq_n_s16(vaddq_s16(t, BAYER_WIDEN_U8(h_col, top)), 3);
+                o3 = top ? vqmovuntq_s16(o3, t) : vqmovunbq_s16(o3, t);
+            }
+
+            vstrbq_scatter_offset_u8(rgb + blue, inc6, r2b.val[0]);
+            vstrbq_scatter_offset_u8(rgb - blue, inc6, o0);
+            vstrbq_scatter_offset_u8(rgb, inc6, o1);
+            vstrbq_scatter_offset_u8(rgb + 3, inc6, r2b.val[1]);
+            vstrbq_scatter_offset_u8(rgb + 3 - blue, inc6, o2);
+            vstrbq_scatter_offset_u8(rgb + 3 + blue, inc6, o3);
+        }
+#endif
+
         if (blue > 0) {
             for (; bayer <= bayerEnd - 2; bayer += 2, rgb += 6) {
                 /* B at B */
@@ -537,6 +745,17 @@ dc1394_bayer_HQLinear(const uint8_t *restrict bayer, uint8_t *restrict rgb, int
         start_with_green = !start_with_green;
     }
 
+}
+
+dc1394error_t
+dc1394_bayer_HQLinear(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx, int sy, int tile)
+{
+    if ((tile>DC1394_COLOR_FILTER_MAX)||(tile<DC1394_COLOR_FILTER_MIN))
+      return DC1394_INVALID_COLOR_FILTER;
+
+    ClearBorders(rgb, sx, sy, 2);
+    dc1394_bayer_HQLinear_rows(bayer, rgb + 2 * 3 * sx, sx, sy - 4, tile, 0);
+
     return DC1394_SUCCESS;
 
 }
@@ -618,41 +837,33 @@ dc1394_bayer_Downsample(const uint8_t *restrict bayer, uint8_t *restrict rgb, in
 
 /* this is the method used inside AVT cameras. See AVT docs. */
 #if ENABLE_DC1394_BAYER_METHOD_SIMPLE
-dc1394error_t
-dc1394_bayer_Simple(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx, int sy, int tile)
+/* Interpolates `rows` output lines of width sx, excluding the last column.
+ * bayer points at the first output line, rgb at the first output line,
+ * row is the frame row of bayer[0].
+ */
+static void
+dc1394_bayer_Simple_rows(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx, int rows, int tile, int row)
 {
     const int bayerStep = sx;
     const int rgbStep = 3 * sx;
     int width = sx;
-    int height = sy;
+    int height = rows;
     int blue = tile == DC1394_COLOR_FILTER_BGGR
         || tile == DC1394_COLOR_FILTER_GBRG ? -1 : 1;
     int start_with_green = tile == DC1394_COLOR_FILTER_GBRG
         || tile == DC1394_COLOR_FILTER_GRBG;
-    int i, imax, iinc;
-
-    if ((tile>DC1394_COLOR_FILTER_MAX)||(tile<DC1394_COLOR_FILTER_MIN))
-      return DC1394_INVALID_COLOR_FILTER;
 
-    /* add black border */
-    imax = sx * sy * 3;
-    for (i = sx * (sy - 1) * 3; i < imax; i++) {
-        rgb[i] = 0;
-    }
-    iinc = (sx - 1) * 3;
-    for (i = (sx - 1) * 3; i < imax; i += iinc) {
-        rgb[i++] = 0;
-        rgb[i++] = 0;
-        rgb[i++] = 0;
+    if (row & 1) {
+        blue = -blue;
+        start_with_green = !start_with_green;
     }
 
     rgb += 1;
     width -= 1;
-    height -= 1;
 
-#if (__ARM_FEATURE_MVE & 1) //ENABLE_MVE_BAYER2RGB 1
-	// Index table into 16 RGB pairs for scatter stores: { 0, 6, 12, .. }
-	const uint8x16_t inc6 = vmulq(vidupq_n_u8(0, 1), 6);
+#if ENABLE_MVE_BAYER2RGB
+    /* Index table into 16 RGB pairs for scatter stores: { 0, 6, 12, .. } */
+    const uint8x16_t inc6 = vmulq_n_u8(vidupq_n_u8(0, 1), 6);
 #endif
 
     for (; height--; bayer += bayerStep, rgb += rgbStep) {
@@ -666,37 +877,26 @@ dc1394_bayer_Simple(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx
             rgb += 3;
         }
 
-#if (__ARM_FEATURE_MVE & 1)
-    // Helium lets us process 16 at a time (8 per beat on Cortex-M55)
-    int pairs_to_go = (bayerEnd - bayer) / 2;
-    while (pairs_to_go > 0) {
-        mve_pred16_t p = vctp8q(pairs_to_go);
-        uint8x16x2_t rg = vld2q(bayer);
-        uint8x16x2_t gb = vld2q(bayer + bayerStep);
-        __builtin_prefetch(bayer + bayerStep + 16 * 2 * 2);
-        uint8x16_t r0 = rg.val[0];
-        uint8x16_t g0 = vrhaddq_x(rg.val[1], gb.val[0], p);
-        uint8x16_t b0 = gb.val[1];
-        vstrbq_scatter_offset_p(rgb - blue, inc6, r0, p);
-        vstrbq_scatter_offset_p(rgb, inc6, g0, p);
-        vstrbq_scatter_offset_p(rgb + blue, inc6, b0, p);
-
-        uint8x16x2_t gr = vld2q(bayer + 1);
-        uint8x16x2_t bg = vld2q(bayer + bayerStep + 1);
-        uint8x16_t r1 = gr.val[1];
-        uint8x16_t g1 = vrhaddq_x(gr.val[0], bg.val[1], p);
-        uint8x16_t b1 = bg.val[0];
-        vstrbq_scatter_offset_p(rgb + 3 - blue, inc6, r1, p);
-        vstrbq_scatter_offset_p(rgb + 3, inc6, g1, p);
-        vstrbq_scatter_offset_p(rgb + 3 + blue, inc6, b1, p);
-        bayer += 16 * 2;
-        rgb += 16 * 6;
-        pairs_to_go -= 16;
-    }
+#if ENABLE_MVE_BAYER2RGB
+        /* 16 pixel pairs per iteration, the scalar loops below finish the line.
+         * Loads stay within the pixels the scalar loop would read.
+         */
+        for (; bayer <= bayerEnd - 32; bayer += 32, rgb += 96) {
+            uint8x16x2_t rg = vld2q_u8(bayer);                  /* [0]     [1]     */
+            uint8x16x2_t gb = vld2q_u8(bayer + bayerStep);      /* [s]     [s+1]   */
+            uint8x16x2_t gr = vld2q_u8(bayer + 1);              /* [1]     [2]     */
+            uint8x16x2_t bg = vld2q_u8(bayer + bayerStep + 1);  /* [s+1]   [s+2]   */
+
+            vstrbq_scatter_offset_u8(rgb - blue, inc6, rg.val[0]);
+            vstrbq_scatter_offset_u8(rgb, inc6, vrhaddq_u8(rg.val[1], gb.val[0]));
+            vstrbq_scatter_offset_u8(rgb + blue, inc6, gb.val[1]);
+
+            vstrbq_scatter_offset_u8(rgb + 3 - blue, inc6, gr.val[1]);
+            vstrbq_scatter_offset_u8(rgb + 3, inc6, vrhaddq_u8(gr.val[0], bg.val[1]));
+            vstrbq_scatter_offset_u8(rgb + 3 + blue, inc6, bg.val[0]);
+        }
+#endif
 
-    bayer += pairs_to_go * 2;
-    rgb += pairs_to_go * 6;
-#else
         if (blue > 0) {
             for (; bayer <= bayerEnd - 2; bayer += 2, rgb += 6) {
                 rgb[-1] = bayer[0];
@@ -718,7 +918,7 @@ dc1394_bayer_Simple(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx
                 rgb[2] = bayer[bayerStep + 1];
             }
         }
-#endif
+
         if (bayer < bayerEnd) {
             rgb[-blue] = bayer[0];
             rgb[0] = (bayer[1] + bayer[bayerStep] + 1) >> 1;
@@ -734,6 +934,30 @@ dc1394_bayer_Simple(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx
         start_with_green = !start_with_green;
     }
 
+}
+
+dc1394error_t
+dc1394_bayer_Simple(const uint8_t *restrict bayer, uint8_t *restrict rgb, int sx, int sy, int tile)
+{
+    int i, imax, iinc;
+
+    if ((tile>DC1394_COLOR_FILTER_MAX)||(tile<DC1394_COLOR_FILTER_MIN))
+      return DC1394_INVALID_COLOR_FILTER;
+
+    /* add black border */
+    imax = sx * sy * 3;
+    for (i = sx * (sy - 1) * 3; i < imax; i++) {
+        rgb[i] = 0;
+    }
+    iinc = (sx - 1) * 3;
+    for (i = (sx - 1) * 3; i < imax; i += iinc) {
+        rgb[i++] = 0;
+        rgb[i++] = 0;
+        rgb[i++] = 0;
+    }
+
+    dc1394_bayer_Simple_rows(bayer, rgb, sx, sy - 1, tile, 0);
+
     return DC1394_SUCCESS;
 
 }
@@ -849,6 +1073,11 @@ dc1394_bayer_Bilinear_uint16(const uint16_t *restrict bayer, uint16_t *restrict
     height -= 2;
     width -= 2;
 
+#if ENABLE_MVE_BAYER2RGB
+    /* Index table into 8 RGB pairs for scatter stores: { 0, 6, 12, .. } */
+    const uint16x8_t inc6 = vmulq_n_u16(vidupq_n_u16(0, 1), 6);
+#endif
+
     for (; height--; bayer += bayerStep, rgb += rgbStep) {
         int t0, t1;
         const uint16_t *bayerEnd = bayer + width;
@@ -865,6 +1094,30 @@ dc1394_bayer_Bilinear_uint16(const uint16_t *restrict bayer, uint16_t *restrict
             rgb += 3;
         }
 
+#if ENABLE_MVE_BAYER2RGB
+        /* 8 pixel pairs per iteration, the scalar loops below finish the line.
+         * Loads stay within the pixels the scalar loop would read.
+         */
+        for (; bayer <= bayerEnd - 16; bayer += 16, rgb += 48) {
+            uint16x8x2_t r0a = vld2q_u16(bayer);                     /* [0]     [1]     */
+            uint16x8x2_t r0b = vld2q_u16(bayer + 1);                 /* [1]     [2]     */
+            uint16x8x2_t r1a = vld2q_u16(bayer + bayerStep);         /* [s]     [s+1]   */
+            uint16x8x2_t r1b = vld2q_u16(bayer + bayerStep + 2);     /* [s+2]   [s+3]   */
+            uint16x8x2_t r2a = vld2q_u16(bayer + bayerStep * 2);     /* [2s]    [2s+1]  */
+            uint16x8x2_t r2b = vld2q_u16(bayer + bayerStep * 2 + 1); /* [2s+1]  [2s+2]  */
+
+            vstrhq_scatter_shifted_offset_u16(rgb - blue, inc6,
+                bayer_avg4_u16(r0a.val[0], r0b.val[1], r2a.val[0], r2b.val[1]));
+            vstrhq_scatter_shifted_offset_u16(rgb, inc6,
+                bayer_avg4_u16(r0a.val[1], r1a.val[0], r1b.val[0], r2a.val[1]));
+            vstrhq_scatter_shifted_offset_u16(rgb + blue, inc6, r1a.val[1]);
+
+            vstrhq_scatter_shifted_offset_u16(rgb + 3 - blue, inc6, vrhaddq_u16(r0b.val[1], r2b.val[1]));
+            vstrhq_scatter_shifted_offset_u16(rgb + 3, inc6, r1b.val[0]);
+            vstrhq_scatter_shifted_offset_u16(rgb + 3 + blue, inc6, vrhaddq_u16(r1a.val[1], r1b.val[1]));
+        }
+#endif
+
         if (blue > 0) {
             for (; bayer <= bayerEnd - 2; bayer += 2, rgb += 6) {
                 t0 = (bayer[0] + bayer[2] + bayer[bayerStep * 2] +
@@ -965,6 +1218,12 @@ dc1394_bayer_HQLinear_uint16(const uint16_t *restrict bayer, uint16_t *restrict
     /* We begin with a (+1 line,+1 column) offset with respect to bilinear decoding, so start_with_green is the same, but blue is opposite */
     blue = -blue;
 
+#if ENABLE_MVE_BAYER2RGB
+    /* Index table into 8 RGB pairs for scatter stores: { 0, 6, 12, .. } */
+    const uint16x8_t inc6 = vmulq_n_u16(vidupq_n_u16(0, 1), 6);
+    const int32x4_t max_val = vdupq_n_s32((1 << bits) - 1);
+#endif
+
     for (; height--; bayer += bayerStep, rgb += rgbStep) {
         int t0, t1;
         const uint16_t *bayerEnd = bayer + width;
@@ -1001,6 +1260,84 @@ dc1394_bayer_HQLinear_uint16(const uint16_t *restrict bayer, uint16_t *restrict
             rgb += 3;
         }
 
+#if ENABLE_MVE_BAYER2RGB
+        /* 8 pixel pairs per iteration, the scalar loops below finish the line.
+         * Loads stay within the pixels the scalar loop would read.
+         */
+        for (; bayer <= bayerEnd - 16; bayer += 16, rgb += 48) {
+            uint16x8x2_t r0  = vld2q_u16(bayer + 2);                 /* [2]      [3]      */
+            uint16x8x2_t r1a = vld2q_u16(bayer + bayerStep + 1);     /* [s+1]    [s+2]    */
+            uint16x8x2_t r1b = vld2q_u16(bayer + bayerStep + 3);     /* [s+3]    [s+4]    */
+            uint16x8x2_t r2a = vld2q_u16(bayer + bayerStep2);        /* [2s]     [2s+1]   */
+            uint16x8x2_t r2b = vld2q_u16(bayer + bayerStep2 + 2);    /* [2s+2]   [2s+3]   */
+            uint16x8x2_t r2c = vld2q_u16(bayer + bayerStep2 + 4);    /* [2s+4]   [2s+5]   */
+            uint16x8x2_t r3a = vld2q_u16(bayer + bayerStep3 + 1);    /* [3s+1]   [3s+2]   */
+            uint16x8x2_t r3b = vld2q_u16(bayer + bayerStep3 + 3);    /* [3s+3]   [3s+4]   */
+            uint16x8x2_t r4  = vld2q_u16(bayer + bayerStep4 + 2);    /* [4s+2]   [4s+3]   */
+            /* rounded halves fit in 16 bits */
+            uint16x8_t h_row = vrhaddq_u16(r2a.val[1], r2c.val[1]);
+            uint16x8_t h_col = vrhaddq_u16(r0.val[1], r4.val[1]);
+            uint16x8_t o0 = vdupq_n_u16(0), o1 = o0, o2 = o0, o3 = o0;
+
+            for (int top = 0; top < 2; top++) {
+                int32x4_t c = BAYER_WIDEN_U16(r2b.val[0], top);
+                int32x4_t g = BAYER_WIDEN_U16(r2b.val[1], top);
+                int32x4_t far = vaddq_s32(vaddq_s32(BAYER_WIDEN_U16(r0.val[0], top),
+                                                    BAYER_WIDEN_U16(r2a.val[0], top)),
+                                          vaddq_s32(BAYER_WIDEN_U16(r2c.val[0], top),
+                                                    BAYER_WIDEN_U16(r4.val[0], top)));
+                int32x4_t diag = vaddq_s32(vaddq_s32(BAYER_WIDEN_U16(r1a.val[0], top),
+                                                     BAYER_WIDEN_U16(r1b.val[0], top)),
+                                           vaddq_s32(BAYER_WIDEN_U16(r3a.val[0], top),
+                                                     BAYER_WIDEN_U16(r3b.val[0], top)));
+                int32x4_t cross = vaddq_s32(vaddq_s32(BAYER_WIDEN_U16(r1a.val[1], top),
+                                                      BAYER_WIDEN_U16(r2a.val[1], top)),
+                                            vaddq_s32(BAYER_WIDEN_U16(r2b.val[1], top),
+                                                      BAYER_WIDEN_U16(r3a.val[1], top)));
+                int32x4_t ring = vaddq_s32(vaddq_s32(BAYER_WIDEN_U16(r1a.val[1], top),
+                                                     BAYER_WIDEN_U16(r1b.val[1], top)),
+                                           vaddq_s32(BAYER_WIDEN_U16(r3a.val[1], top),
+                                                     BAYER_WIDEN_U16(r3b.val[1], top)));
+                int32x4_t g5 = vmulq_n_s32(g, 5);
+                int32x4_t t;
+
+                /* R at B (B at R) */
+                t = vsubq_s32(vshlq_n_s32(diag, 1),
+                              vshrq_n_s32(vaddq_n_s32(vmulq_n_s32(far, 3), 1), 1));
+                t = vminq_s32(vrshrq_n_s32(vaddq_s32(t, vmulq_n_s32(c, 6)), 3), max_val);
+                o0 = top ? vqmovuntq_s32(o0, t) : vqmovunbq_s32(o0, t);
+
+                /* G at B (G at R) */
+                t = vsubq_s32(vshlq_n_s32(cross, 1), far);
+                t = vminq_s32(vrshrq_n_s32(vaddq_s32(t, vshlq_n_s32(c, 2)), 3), max_val);
+                o1 = top ? vqmovuntq_s32(o1, t) : vqmovunbq_s32(o1, t);
+
+                /* at green pixel, vertical neighbours */
+                t = vaddq_s32(g5, vshlq_n_s32(vaddq_s32(BAYER_WIDEN_U16(r1b.val[0], top),
+                                                        BAYER_WIDEN_U16(r3b.val[0], top)), 2));
+                t = vsubq_s32(t, vaddq_s32(ring, vaddq_s32(BAYER_WIDEN_U16(r0.val[1], top),
+                                                           BAYER_WIDEN_U16(r4.val[1], top))));
+                t = vminq_s32(vrshrq_n_s32(vaddq_s32(t, BAYER_WIDEN_U16(h_row, top)), 3), max_val);
+                o2 = top ? vqmovuntq_s32(o2, t) : vqmovunbq_s32(o2, t);
+
+                /* at green pixel, horizontal neighbours */
+                t = vaddq_s32(g5, vshlq_n_s32(vaddq_s32(BAYER_WIDEN_U16(r2b.val[0], top),
+                                                        BAYER_WIDEN_U16(r2c.val[0], top)), 2));
+                t = vsubq_s32(t, vaddq_s32(ring, vaddq_s32(BAYER_WIDEN_U16(r2a.val[1], top),
+                                                           BAYER_WIDEN_U16(r2c.val[1], top))));
+                t = vminq_s32(vrshrq_n_s32(vaddq_s32(t, BAYER_WIDEN_U16(h_col, top)), 3), max_val);
+                o3 = top ? vqmovuntq_s32(o3, t) : vqmovunbq_s32(o3, t);
+            }
+
+            vstrhq_scatter_shifted_offset_u16(rgb + blue, inc6, r2b.val[0]);
+            vstrhq_scatter_shifted_offset_u16(rgb - blue, inc6, o0);
+            vstrhq_scatter_shifted_offset_u16(rgb, inc6, o1);
+            vstrhq_scatter_shifted_offset_u16(rgb + 3, inc6, r2b.val[1]);
+            vstrhq_scatter_shifted_offset_u16(rgb + 3 - blue, inc6, o2);
+            vstrhq_scatter_shifted_offset_u16(rgb + 3 + blue, inc6, o3);
+        }
+#endif
+
         if (blue > 0) {
             for (; bayer <= bayerEnd - 2; bayer += 2, rgb += 6) {
                 /* B at B */
@@ -1208,12 +1545,54 @@ dc1394_bayer_Downsample_uint16(const uint16_t *restrict bayer, uint16_t *restric
 }
 
 /* coriander's Bayer decoding */
+
+/* One line of Simple_uint16: n pixels spaced by two, output spaced by two RGB triplets.
+ * G is the truncated mean of g0 and g1, R and B are copied.
+ */
+static void
+bayer_Simple_uint16_pairs(const uint16_t *restrict g0, const uint16_t *restrict g1,
+                          const uint16_t *restrict r, const uint16_t *restrict b,
+                          uint16_t *restrict outG, uint16_t *restrict outR, uint16_t *restrict outB,
+                          int n, int bits)
+{
+    int k = 0;
+    int tmp;
+
+#if ENABLE_MVE_BAYER2RGB
+    /* Index table into 8 RGB pairs for scatter stores: { 0, 6, 12, .. } */
+    const uint16x8_t inc6 = vmulq_n_u16(vidupq_n_u16(0, 1), 6);
+    const uint16x8_t max_val = vdupq_n_u16((1 << bits) - 1);
+
+    /* The de-interleaving loads read one pixel past the last pair of a block,
+     * so the scalar loop always gets at least one pair.
+     */
+    for (; k + 8 < n; k += 8) {
+        uint16x8_t vg = vhaddq_u16(vld2q_u16(g0 + 2 * k).val[0], vld2q_u16(g1 + 2 * k).val[0]);
+        uint16x8_t vr = vld2q_u16(r + 2 * k).val[0];
+        uint16x8_t vb = vld2q_u16(b + 2 * k).val[0];
+
+        vstrhq_scatter_shifted_offset_u16(outG + 6 * k, inc6, vminq_u16(vg, max_val));
+        vstrhq_scatter_shifted_offset_u16(outR + 6 * k, inc6, vminq_u16(vr, max_val));
+        vstrhq_scatter_shifted_offset_u16(outB + 6 * k, inc6, vminq_u16(vb, max_val));
+    }
+#endif
+
+    for (; k < n; k++) {
+        tmp = ((g0[2 * k] + g1[2 * k]) >> 1);
+        CLIP16(tmp, outG[6 * k], bits);
+        tmp = r[2 * k];
+        CLIP16(tmp, outR[6 * k], bits);
+        tmp = b[2 * k];
+        CLIP16(tmp, outB[6 * k], bits);
+    }
+}
+
 dc1394error_t
 dc1394_bayer_Simple_uint16(const uint16_t *restrict bayer, uint16_t *restrict rgb, int sx, int sy, int tile, int bits)
 {
     uint16_t *outR, *outG, *outB;
-    register int i, j;
-    int tmp, base;
+    register int i;
+    int base;
 
     // sx and sy should be even
     switch (tile) {
@@ -1257,95 +1636,63 @@ dc1394_bayer_Simple_uint16(const uint16_t *restrict bayer, uint16_t *restrict rg
     case DC1394_COLOR_FILTER_GRBG:        //---------------------------------------------------------
     case DC1394_COLOR_FILTER_GBRG:
         for (i = 0; i < sy - 1; i += 2) {
-            for (j = 0; j < sx - 1; j += 2) {
-                base = i * sx + j;
-                tmp = ((bayer[base] + bayer[base + sx + 1]) >> 1);
-                CLIP16(tmp, outG[base * 3], bits);
-                tmp = bayer[base + 1];
-                CLIP16(tmp, outR[base * 3], bits);
-                tmp = bayer[base + sx];
-                CLIP16(tmp, outB[base * 3], bits);
-            }
+            base = i * sx;
+            bayer_Simple_uint16_pairs(&bayer[base], &bayer[base + sx + 1],
+                                      &bayer[base + 1], &bayer[base + sx],
+                                      &outG[base * 3], &outR[base * 3], &outB[base * 3],
+                                      sx / 2, bits);
         }
         for (i = 0; i < sy - 1; i += 2) {
-            for (j = 1; j < sx - 1; j += 2) {
-                base = i * sx + j;
-                tmp = ((bayer[base + 1] + bayer[base + sx]) >> 1);
-                CLIP16(tmp, outG[(base) * 3], bits);
-                tmp = bayer[base];
-                CLIP16(tmp, outR[(base) * 3], bits);
-                tmp = bayer[base + 1 + sx];
-                CLIP16(tmp, outB[(base) * 3], bits);
-            }
+            base = i * sx + 1;
+            bayer_Simple_uint16_pairs(&bayer[base + 1], &bayer[base + sx],
+                                      &bayer[base], &bayer[base + 1 + sx],
+                                      &outG[base * 3], &outR[base * 3], &outB[base * 3],
+                                      (sx - 1) / 2, bits);
         }
         for (i = 1; i < sy - 1; i += 2) {
-            for (j = 0; j < sx - 1; j += 2) {
-                base = i * sx + j;
-                tmp = ((bayer[base + sx] + bayer[base + 1]) >> 1);
-                CLIP16(tmp, outG[base * 3], bits);
-                tmp = bayer[base + sx + 1];
-                CLIP16(tmp, outR[base * 3], bits);
-                tmp = bayer[base];
-                CLIP16(tmp, outB[base * 3], bits);
-            }
+            base = i * sx;
+            bayer_Simple_uint16_pairs(&bayer[base + sx], &bayer[base + 1],
+                                      &bayer[base + sx + 1], &bayer[base],
+                                      &outG[base * 3], &outR[base * 3], &outB[base * 3],
+                                      sx / 2, bits);
         }
         for (i = 1; i < sy - 1; i += 2) {
-            for (j = 1; j < sx - 1; j += 2) {
-                base = i * sx + j;
-                tmp = ((bayer[base] + bayer[base + 1 + sx]) >> 1);
-                CLIP16(tmp, outG[(base) * 3], bits);
-                tmp = bayer[base + sx];
-                CLIP16(tmp, outR[(base) * 3], bits);
-                tmp = bayer[base + 1];
-                CLIP16(tmp, outB[(base) * 3], bits);
-            }
+            base = i * sx + 1;
+            bayer_Simple_uint16_pairs(&bayer[base], &bayer[base + 1 + sx],
+                                      &bayer[base + sx], &bayer[base + 1],
+                                      &outG[base * 3], &outR[base * 3], &outB[base * 3],
+                                      (sx - 1) / 2, bits);
         }
         break;
     case DC1394_COLOR_FILTER_BGGR:        //---------------------------------------------------------
     case DC1394_COLOR_FILTER_RGGB:
         for (i = 0; i < sy - 1; i += 2) {
-            for (j = 0; j < sx - 1; j += 2) {
-                base = i * sx + j;
-                tmp = ((bayer[base + sx] + bayer[base + 1]) >> 1);
-                CLIP16(tmp, outG[base * 3], bits);
-                tmp = bayer[base + sx + 1];
-                CLIP16(tmp, outR[base * 3], bits);
-                tmp = bayer[base];
-                CLIP16(tmp, outB[base * 3], bits);
-            }
+            base = i * sx;
+            bayer_Simple_uint16_pairs(&bayer[base + sx], &bayer[base + 1],
+                                      &bayer[base + sx + 1], &bayer[base],
+                                      &outG[base * 3], &outR[base * 3], &outB[base * 3],
+                                      sx / 2, bits);
         }
         for (i = 1; i < sy - 1; i += 2) {
-            for (j = 0; j < sx - 1; j += 2) {
-                base = i * sx + j;
-                tmp = ((bayer[base] + bayer[base + 1 + sx]) >> 1);
-                CLIP16(tmp, outG[(base) * 3], bits);
-                tmp = bayer[base + 1];
-                CLIP16(tmp, outR[(base) * 3], bits);
-                tmp = bayer[base + sx];
-                CLIP16(tmp, outB[(base) * 3], bits);
-            }
+            base = i * sx;
+            bayer_Simple_uint16_pairs(&bayer[base], &bayer[base + 1 + sx],
+                                      &bayer[base + 1], &bayer[base + sx],
+                                      &outG[base * 3], &outR[base * 3], &outB[base * 3],
+                                      sx / 2, bits);
         }
         for (i = 0; i < sy - 1; i += 2) {
-            for (j = 1; j < sx - 1; j += 2) {
-                base = i * sx + j;
-                tmp = ((bayer[base] + bayer[base + sx + 1]) >> 1);
-                CLIP16(tmp, outG[base * 3], bits);
-                tmp = bayer[base + sx];
-                CLIP16(tmp, outR[base * 3], bits);
-                tmp = bayer[base + 1];
-                CLIP16(tmp, outB[base * 3], bits);
-            }
+            base = i * sx + 1;
+            bayer_Simple_uint16_pairs(&bayer[base], &bayer[base + sx + 1],
+                                      &bayer[base + sx], &bayer[base + 1],
+                                      &outG[base * 3], &outR[base * 3], &outB[base * 3],
+                                      (sx - 1) / 2, bits);
         }
         for (i = 1; i < sy - 1; i += 2) {
-            for (j = 1; j < sx - 1; j += 2) {
-                base = i * sx + j;
-                tmp = ((bayer[base + 1] + bayer[base + sx]) >> 1);
-                CLIP16(tmp, outG[(base) * 3], bits);
-                tmp = bayer[base];
-                CLIP16(tmp, outR[(base) * 3], bits);
-                tmp = bayer[base + 1 + sx];
-                CLIP16(tmp, outB[(base) * 3], bits);
-            }
+            base = i * sx + 1;
+            bayer_Simple_uint16_pairs(&bayer[base + 1], &bayer[base + sx],
+                                      &bayer[base], &bayer[base + 1 + sx],
+                                      &outG[base * 3], &outR[base * 3], &outB[base * 3],
+                                      (sx - 1) / 2, bits);
         }
         break;
     }
@@ -2127,6 +2474,387 @@ dc1394_bayer_decoding_8bit(const uint8_t *restrict bayer, uint8_t *restrict rgb,
   }
 
 }
+
+/* Lines (and columns) left black before and after the image by a method */
+static dc1394error_t
+dc1394_bayer_borders(dc1394bayer_method_t method, uint32_t *top, uint32_t *bottom)
+{
+    switch (method) {
+#if ENABLE_DC1394_BAYER_METHOD_SIMPLE
+    case DC1394_BAYER_METHOD_SIMPLE:
+        *top    = 0;
+        *bottom = 1;
+        return DC1394_SUCCESS;
+#endif
+
+#if ENABLE_DC1394_BAYER_METHOD_BILINEAR
+    case DC1394_BAYER_METHOD_BILINEAR:
+        *top    = 1;
+        *bottom = 1;
+        return DC1394_SUCCESS;
+#endif
+
+#if ENABLE_DC1394_BAYER_METHOD_HQLINEAR
+    case DC1394_BAYER_METHOD_HQLINEAR:
+        *top    = 2;
+        *bottom = 2;
+        return DC1394_SUCCESS;
+#endif
+
+    default:
+        return DC1394_INVALID_BAYER_METHOD;
+    }
+}
+
+/* Interpolates `rows` lines with their black border columns.
+ * bayer points at the first line of the window, row is its frame row.
+ */
+static void
+dc1394_bayer_rows(const uint8_t *restrict bayer, uint8_t *restrict rgb, uint32_t sx, uint32_t rows, dc1394color_filter_t tile, dc1394bayer_method_t method, int row, uint32_t top, uint32_t bottom)
+{
+    const uint32_t rgbStep = 3 * sx;
+    uint32_t i;
+
+    switch (method) {
+#if ENABLE_DC1394_BAYER_METHOD_SIMPLE
+    case DC1394_BAYER_METHOD_SIMPLE:
+        dc1394_bayer_Simple_rows(bayer, rgb, sx, rows, tile, row);
+        break;
+#endif
+
+#if ENABLE_DC1394_BAYER_METHOD_BILINEAR
+    case DC1394_BAYER_METHOD_BILINEAR:
+        dc1394_bayer_Bilinear_rows(bayer, rgb, sx, rows, tile, row);
+        break;
+#endif
+
+#if ENABLE_DC1394_BAYER_METHOD_HQLINEAR
+    case DC1394_BAYER_METHOD_HQLINEAR:
+        dc1394_bayer_HQLinear_rows(bayer, rgb, sx, rows, tile, row);
+        break;
+#endif
+
+    default:
+        break;
+    }
+
+    /* black border columns */
+    for (i = 0; i < rows; i++, rgb += rgbStep) {
+        memset(rgb, 0, 3 * top);
+        memset(rgb + rgbStep - 3 * bottom, 0, 3 * bottom);
+    }
+}
+
+/* Streaming decoding.
+ * The arena holds a sliding window of raw lines. When it is full, the lines
+ * still needed by the interpolation window are moved back to its start, so
+ * the held lines are always contiguous and the row kernels above run on them
+ * unchanged. Output is identical to dc1394_bayer_decoding_8bit.
+ */
+dc1394error_t
+dc1394_bayer_stream_init(dc1394bayer_stream_t *stream, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method, void *arena, uint32_t arena_size)
+{
+    uint32_t window;
+
+    if ((stream == NULL) || (arena == NULL))
+        return DC1394_INVALID_ARGUMENT_VALUE;
+
+    if ((tile>DC1394_COLOR_FILTER_MAX)||(tile<DC1394_COLOR_FILTER_MIN))
+        return DC1394_INVALID_COLOR_FILTER;
+
+    if (dc1394_bayer_borders(method, &stream->top, &stream->bottom) != DC1394_SUCCESS)
+        return DC1394_INVALID_BAYER_METHOD;
+
+    window = stream->top + stream->bottom + 1;
+
+    if ((sx < window) || (sy < window))
+        return DC1394_INVALID_ARGUMENT_VALUE;
+
+    if ((arena_size / sx) < window)
+        return DC1394_MEMORY_ALLOCATION_FAILURE;
+
+    stream->lines     = arena;
+    stream->max_lines = arena_size / sx;
+    stream->sx        = sx;
+    stream->sy        = sy;
+    stream->tile      = tile;
+    stream->method    = method;
+
+    dc1394_bayer_stream_start_frame(stream);
+
+    return DC1394_SUCCESS;
+}
+
+void
+dc1394_bayer_stream_start_frame(dc1394bayer_stream_t *stream)
+{
+    stream->num_lines = 0;
+    stream->first_row = 0;
+    stream->in_rows   = 0;
+    stream->out_rows  = 0;
+}
+
+dc1394error_t
+dc1394_bayer_stream_push(dc1394bayer_stream_t *restrict stream, const uint8_t *restrict bayer, uint32_t lines, uint8_t *restrict rgb, uint32_t *rgb_lines)
+{
+    const uint32_t sx = stream->sx;
+    const uint32_t rgbStep = 3 * sx;
+    const uint32_t keep = stream->top + stream->bottom;
+    uint32_t n, end, rows;
+
+    *rgb_lines = 0;
+
+    if (lines > (stream->sy - stream->in_rows))
+        return DC1394_INVALID_ARGUMENT_VALUE;
+
+    while (lines) {
+        if (stream->num_lines == stream->max_lines) {
+            memmove(stream->lines, stream->lines + (stream->num_lines - keep) * sx, keep * sx);
+            stream->first_row += stream->num_lines - keep;
+            stream->num_lines  = keep;
+        }
+
+        n = stream->max_lines - stream->num_lines;
+        if (n > lines)
+            n = lines;
+
+        memcpy(stream->lines + stream->num_lines * sx, bayer, n * sx);
+        stream->num_lines += n;
+        stream->in_rows   += n;
+        bayer += n * sx;
+        lines -= n;
+
+        /* Rows whose window is complete; the bottom border once the frame is */
+        if (stream->in_rows == stream->sy)
+            end = stream->sy;
+        else
+            end = stream->in_rows > stream->bottom ? stream->in_rows - stream->bottom : 0;
+
+        for (; (stream->out_rows < end) && (stream->out_rows < stream->top); stream->out_rows++) {
+            memset(rgb, 0, rgbStep);
+            rgb += rgbStep;
+            (*rgb_lines)++;
+        }
+
+        rows = end < (stream->sy - stream->bottom) ? end : (stream->sy - stream->bottom);
+        if (stream->out_rows < rows) {
+            rows -= stream->out_rows;
+            dc1394_bayer_rows(stream->lines + (stream->out_rows - stream->top - stream->first_row) * sx,
+                              rgb, sx, rows, stream->tile, stream->method,
+                              stream->out_rows - stream->top, stream->top, stream->bottom);
+            stream->out_rows += rows;
+            rgb += rows * rgbStep;
+            *rgb_lines += rows;
+        }
+
+        for (; stream->out_rows < end; stream->out_rows++) {
+            memset(rgb, 0, rgbStep);
+            rgb += rgbStep;
+            (*rgb_lines)++;
+        }
+    }
+
+    return DC1394_SUCCESS;
+}
+
+/* Fused decoding.
+ * The frame is interpolated a strip of lines at a time into rgb_lines, and
+ * each strip is converted and downscaled into out before the next one, so
+ * the raw frame is read once and the RGB888 lines stay in the line buffer.
+ */
+static void
+dc1394_bayer_frame_rows(const uint8_t *restrict bayer, uint8_t *restrict rgb, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method, uint32_t row, uint32_t rows, uint32_t top, uint32_t bottom)
+{
+    const uint32_t rgbStep = 3 * sx;
+    uint32_t n;
+
+    for (; rows && (row < top); row++, rows--) {
+        memset(rgb, 0, rgbStep);
+        rgb += rgbStep;
+    }
+
+    /* interior lines, up to the bottom border */
+    n = (row + rows) < (sy - bottom) ? (row + rows) : (sy - bottom);
+    n = n > row ? n - row : 0;
+    if (n) {
+        dc1394_bayer_rows(bayer + (row - top) * sx, rgb, sx, n, tile, method, row - top, top, bottom);
+        rgb  += n * rgbStep;
+        row  += n;
+        rows -= n;
+    }
+
+    if (rows)
+        memset(rgb, 0, rows * rgbStep);
+}
+
+static inline int8_t
+dc1394_bayer_quantize(uint32_t v, int32_t scale, int32_t offset)
+{
+    int32_t q = ((int32_t)v * scale + (1 << 15)) >> 16;
+
+    q += offset;
+    return (int8_t)(q < -128 ? -128 : (q > 127 ? 127 : q));
+}
+
+static void
+dc1394_bayer_output_rows(const dc1394bayer_output_t *output, const uint8_t *restrict rgb, uint32_t sx, uint32_t ow, uint32_t oh, uint32_t oy, uint32_t orows, void *restrict out)
+{
+    const uint32_t rgbStep = 3 * sx;
+    const uint32_t f = output->downscale;
+    /* A block centre falls between its two middle lines/columns */
+    const uint32_t first = (output->filter == DC1394_BAYER_DOWNSCALE_BILINEAR) ? (f - 1) / 2 : 0;
+    const uint32_t taps  = (output->filter == DC1394_BAYER_DOWNSCALE_BILINEAR) && (f > 1) ? 2 : f;
+    const uint32_t shift = (taps == 4) ? 4 : ((taps == 2) ? 2 : 0);
+    const uint32_t round = (1U << shift) >> 1;
+    uint32_t x, y, i, j, r, g, b;
+
+    for (y = 0; y < orows; y++) {
+        const uint8_t *line = rgb + (y * f + first) * rgbStep + first * 3;
+        uint32_t idx = (oy + y) * ow;
+
+        for (x = 0; x < ow; x++, idx++, line += 3 * f) {
+            r = g = b = 0;
+            for (i = 0; i < taps; i++) {
+                const uint8_t *p = line + i * rgbStep;
+
+                for (j = 0; j < taps; j++, p += 3) {
+                    r += p[0];
+                    g += p[1];
+                    b += p[2];
+                }
+            }
+            r = (r + round) >> shift;
+            g = (g + round) >> shift;
+            b = (b + round) >> shift;
+
+            switch (output->format) {
+            case DC1394_BAYER_OUTPUT_RGB888:
+                ((uint8_t *)out)[3 * idx]     = r;
+                ((uint8_t *)out)[3 * idx + 1] = g;
+                ((uint8_t *)out)[3 * idx + 2] = b;
+                break;
+
+            case DC1394_BAYER_OUTPUT_RGB565:
+                ((uint16_t *)out)[idx] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+                break;
+
+            case DC1394_BAYER_OUTPUT_INT8_PLANAR:
+                ((int8_t *)out)[idx]               = dc1394_bayer_quantize(r, output->scale[0], output->offset[0]);
+                ((int8_t *)out)[idx + ow * oh]     = dc1394_bayer_quantize(g, output->scale[1], output->offset[1]);
+                ((int8_t *)out)[idx + 2 * ow * oh] = dc1394_bayer_quantize(b, output->scale[2], output->offset[2]);
+                break;
+            }
+        }
+    }
+}
+
+dc1394error_t
+dc1394_bayer_decoding_8bit_output(const uint8_t *restrict bayer, void *restrict out, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method, const dc1394bayer_output_t *output, uint8_t *restrict rgb_lines, uint32_t rgb_lines_size)
+{
+    uint32_t top, bottom, f, strip, height, y, n;
+
+    if ((bayer == NULL) || (out == NULL) || (output == NULL) || (rgb_lines == NULL))
+        return DC1394_INVALID_ARGUMENT_VALUE;
+
+    if ((tile>DC1394_COLOR_FILTER_MAX)||(tile<DC1394_COLOR_FILTER_MIN))
+        return DC1394_INVALID_COLOR_FILTER;
+
+    if (dc1394_bayer_borders(method, &top, &bottom) != DC1394_SUCCESS)
+        return DC1394_INVALID_BAYER_METHOD;
+
+    f = output->downscale;
+    if (((f != 1) && (f != 2) && (f != 4)) ||
+        (output->format > DC1394_BAYER_OUTPUT_INT8_PLANAR) ||
+        (output->filter > DC1394_BAYER_DOWNSCALE_BILINEAR))
+        return DC1394_INVALID_ARGUMENT_VALUE;
+
+    if ((sx <= top + bottom) || (sy <= top + bottom) || (sx < f) || (sy < f))
+        return DC1394_INVALID_ARGUMENT_VALUE;
+
+    /* Whole blocks of f lines per strip */
+    strip = rgb_lines_size / (3 * sx);
+    strip -= strip % f;
+    if (strip == 0)
+        return DC1394_MEMORY_ALLOCATION_FAILURE;
+
+    /* Partial blocks at the right and bottom edges are dropped */
+    height = (sy / f) * f;
+
+    for (y = 0; y < height; y += n) {
+        n = (height - y) < strip ? (height - y) : strip;
+        dc1394_bayer_frame_rows(bayer, rgb_lines, sx, sy, tile, method, y, n, top, bottom);
+        dc1394_bayer_output_rows(output, rgb_lines, sx, sx / f, sy / f, y / f, n / f, out);
+    }
+
+    return DC1394_SUCCESS;
+}
+
+/* Tiled decoding */
+typedef struct {
+    const uint8_t         *bayer;
+    uint8_t               *rgb;
+    uint32_t               sx;
+    uint32_t               sy;
+    dc1394color_filter_t   tile;
+    dc1394bayer_method_t   method;
+    uint32_t               row;
+    uint32_t               rows;
+    uint32_t               top;
+    uint32_t               bottom;
+} dc1394bayer_band_t;
+
+static void
+dc1394_bayer_band(void *arg)
+{
+    const dc1394bayer_band_t *band = arg;
+
+    dc1394_bayer_frame_rows(band->bayer, band->rgb + band->row * 3 * band->sx,
+                            band->sx, band->sy, band->tile, band->method,
+                            band->row, band->rows, band->top, band->bottom);
+}
+
+dc1394error_t
+dc1394_bayer_decoding_8bit_tiled(const uint8_t *restrict bayer, uint8_t *restrict rgb, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method, const dc1394bayer_workers_t *workers)
+{
+    dc1394bayer_band_t bands[DC1394_BAYER_WORKERS_MAX];
+    uint32_t top, bottom, count, i;
+
+    if ((bayer == NULL) || (rgb == NULL) || (workers == NULL) ||
+        (workers->count == 0) || (workers->count > DC1394_BAYER_WORKERS_MAX) ||
+        (workers->start == NULL) || (workers->wait == NULL))
+        return DC1394_INVALID_ARGUMENT_VALUE;
+
+    if ((tile>DC1394_COLOR_FILTER_MAX)||(tile<DC1394_COLOR_FILTER_MIN))
+        return DC1394_INVALID_COLOR_FILTER;
+
+    if (dc1394_bayer_borders(method, &top, &bottom) != DC1394_SUCCESS)
+        return DC1394_INVALID_BAYER_METHOD;
+
+    if ((sx <= top + bottom) || (sy <= top + bottom))
+        return DC1394_INVALID_ARGUMENT_VALUE;
+
+    count = workers->count < sy ? workers->count : sy;
+
+    for (i = 0; i < count; i++) {
+        bands[i].bayer  = bayer;
+        bands[i].rgb    = rgb;
+        bands[i].sx     = sx;
+        bands[i].sy     = sy;
+        bands[i].tile   = tile;
+        bands[i].method = method;
+        bands[i].row    = sy * i / count;
+        bands[i].rows   = sy * (i + 1) / count - bands[i].row;
+        bands[i].top    = top;
+        bands[i].bottom = bottom;
+
+        if (workers->start(workers->context, i, dc1394_bayer_band, &bands[i]) != 0)
+            dc1394_bayer_band(&bands[i]);
+    }
+
+    workers->wait(workers->context);
+
+    return DC1394_SUCCESS;
+}
 #endif /* end of ENABLE_8_BIT_VERSION */
 
 #if ENABLE_16_BIT_VERSION
@@ -2146,10 +2874,14 @@ dc1394_bayer_decoding_16bit(const uint16_t *restrict bayer, uint16_t *restrict r
         return dc1394_bayer_Downsample_uint16(bayer, rgb, sx, sy, tile, bits);
     case DC1394_BAYER_METHOD_EDGESENSE:
         return dc1394_bayer_EdgeSense_uint16(bayer, rgb, sx, sy, tile, bits);
+#if ENABLE_DC1394_BAYER_METHOD_VNG
     case DC1394_BAYER_METHOD_VNG:
         return dc1394_bayer_VNG_uint16(bayer, rgb, sx, sy, tile, bits);
+#endif
+#if ENABLE_DC1394_BAYER_METHOD_AHD
     case DC1394_BAYER_METHOD_AHD:
         return dc1394_bayer_AHD_uint16(bayer, rgb, sx, sy, tile, bits);
+#endif
     default:
         return DC1394_INVALID_BAYER_METHOD;
     }
@@ -1,3 +1,6 @@
+#ifndef _BAYER_H_
+#define _BAYER_H_
+
 #include <stdint.h>
 
 typedef enum {
@@ -85,3 +88,100 @@ dc1394_bayer_decoding_8bit(const uint8_t * bayer, uint8_t * rgb, uint32_t sx, ui
 
 dc1394error_t
 dc1394_bayer_decoding_16bit(const uint16_t * bayer, uint16_t * rgb, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method, uint32_t bits);
+
+/**
+ * Streaming 8-bit decoding state (Simple, Bilinear and HQLinear methods).
+ *
+ * Raw lines are pushed as they arrive (e.g. from the CPI line or frame
+ * events) and RGB lines are produced as soon as their interpolation window
+ * is complete. Only the last few raw lines are kept, in a caller-provided
+ * arena, so neither the full raw frame nor any heap memory is required.
+ */
+typedef struct {
+    uint8_t              *lines;      /* Line buffer arena                      */
+    uint32_t              max_lines;  /* Arena capacity in lines                */
+    uint32_t              num_lines;  /* Lines currently held in the arena      */
+    uint32_t              first_row;  /* Frame row of the first held line       */
+    uint32_t              in_rows;    /* Raw rows received for this frame       */
+    uint32_t              out_rows;   /* RGB rows produced for this frame       */
+    uint32_t              sx;
+    uint32_t              sy;
+    uint32_t              top;        /* Border lines/columns before the image  */
+    uint32_t              bottom;     /* Border lines/columns after the image   */
+    dc1394color_filter_t  tile;
+    dc1394bayer_method_t  method;
+} dc1394bayer_stream_t;
+
+/* Largest interpolation window (HQLinear), in lines */
+#define DC1394_BAYER_STREAM_WINDOW_MAX          5
+/* A push of N lines produces at most N + DC1394_BAYER_STREAM_EXTRA_LINES RGB lines */
+#define DC1394_BAYER_STREAM_EXTRA_LINES         2
+/* Arena size in bytes to process up to `lines` new lines per kernel call */
+#define DC1394_BAYER_STREAM_ARENA_SIZE(sx, lines) \
+    ((sx) * ((lines) + DC1394_BAYER_STREAM_WINDOW_MAX - 1))
+
+dc1394error_t
+dc1394_bayer_stream_init(dc1394bayer_stream_t *stream, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method, void *arena, uint32_t arena_size);
+
+void
+dc1394_bayer_stream_start_frame(dc1394bayer_stream_t *stream);
+
+dc1394error_t
+dc1394_bayer_stream_push(dc1394bayer_stream_t *stream, const uint8_t *bayer, uint32_t lines, uint8_t *rgb, uint32_t *rgb_lines);
+
+/**
+ * Fused 8-bit decoding output stages.
+ *
+ * Lines are demosaiced a strip at a time into a small RGB888 line buffer and
+ * converted (and optionally downscaled) straight into the final image, so the
+ * full-size RGB888 image is never written out.
+ */
+typedef enum {
+    DC1394_BAYER_OUTPUT_RGB888 = 0,   /* Packed R, G, B bytes                  */
+    DC1394_BAYER_OUTPUT_RGB565,       /* Packed 16-bit, R in the top bits      */
+    DC1394_BAYER_OUTPUT_INT8_PLANAR   /* Three int8 planes: R, then G, then B  */
+} dc1394bayer_output_format_t;
+
+typedef enum {
+    DC1394_BAYER_DOWNSCALE_BOX = 0,   /* Average of each f x f block           */
+    DC1394_BAYER_DOWNSCALE_BILINEAR   /* Bilinear sample at each block centre  */
+} dc1394bayer_downscale_t;
+
+typedef struct {
+    dc1394bayer_output_format_t format;
+    dc1394bayer_downscale_t     filter;
+    uint32_t                    downscale;  /* 1, 2 or 4                        */
+    int32_t                     scale[3];   /* INT8_PLANAR: R, G, B scale, Q16  */
+    int32_t                     offset[3];  /* INT8_PLANAR: R, G, B offset      */
+} dc1394bayer_output_t;
+
+/* Minimum line buffer size in bytes for dc1394_bayer_decoding_8bit_output */
+#define DC1394_BAYER_OUTPUT_LINES_SIZE(sx, downscale)   (3 * (sx) * (downscale))
+
+dc1394error_t
+dc1394_bayer_decoding_8bit_output(const uint8_t * bayer, void * out, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method, const dc1394bayer_output_t * output, uint8_t * rgb_lines, uint32_t rgb_lines_size);
+
+/**
+ * Tiled 8-bit decoding (Simple, Bilinear and HQLinear methods).
+ *
+ * The frame is split into one band of lines per worker. Each band reads its
+ * lines plus the 1-2 line halo of the method from the shared raw frame and
+ * writes only its own RGB lines, so the result is identical to
+ * dc1394_bayer_decoding_8bit for any number of workers.
+ */
+#define DC1394_BAYER_WORKERS_MAX                8
+
+typedef struct {
+    uint32_t   count;       /* Number of workers, 1..DC1394_BAYER_WORKERS_MAX   */
+    void      *context;     /* Passed back to start and wait                     */
+    /* Runs band(arg) on worker `index`, returns 0 once started.
+     * A band that fails to start is run by the caller instead. */
+    int32_t  (*start)(void *context, uint32_t index, void (*band)(void *arg), void *arg);
+    /* Returns once every started band has completed */
+    void     (*wait)(void *context);
+} dc1394bayer_workers_t;
+
+dc1394error_t
+dc1394_bayer_decoding_8bit_tiled(const uint8_t * bayer, uint8_t * rgb, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method, const dc1394bayer_workers_t * workers);
+
+#endif /* _BAYER_H_ */
@@ -0,0 +1,79 @@
+/**************************************************************************//**
+ * @file     arm_mve.h
+ * @brief    Host-only scalar model of the Helium (MVE) intrinsics used by
+ *           bayer.c, one lane at a time, so the Helium inner loops can be
+ *           checked bit-exactly against the scalar reference on a PC.
+ *           Predicated "don't care" lanes are computed like active lanes.
+ *           Never put this directory on the include path of a target build.
+ ******************************************************************************/
+
+#ifndef HOST_ARM_MVE_H
+#define HOST_ARM_MVE_H
+
+#include <stdint.h>
+typedef struct { uint8_t v[16]; } uint8x16_t;
+typedef struct { uint16_t v[8]; } uint16x8_t;
+typedef struct { uint32_t v[4]; } uint32x4_t;
+typedef struct { int16_t v[8]; } int16x8_t;
+typedef struct { int32_t v[4]; } int32x4_t;
+typedef struct { uint8x16_t val[2]; } uint8x16x2_t;
+typedef struct { uint16x8_t val[2]; } uint16x8x2_t;
+typedef uint16_t mve_pred16_t;
+#define MVE_LANES(n) for (int i = 0; i < (n); i++)
+static inline uint8x16x2_t vld2q_u8(const uint8_t *p){uint8x16x2_t r; MVE_LANES(16){r.val[0].v[i]=p[2*i]; r.val[1].v[i]=p[2*i+1];} return r;}
+static inline uint16x8x2_t vld2q_u16(const uint16_t *p){uint16x8x2_t r; MVE_LANES(8){r.val[0].v[i]=p[2*i]; r.val[1].v[i]=p[2*i+1];} return r;}
+#define vld2q vld2q_u8
+static inline uint16x8_t vmovlbq_u8(uint8x16_t a){uint16x8_t r; MVE_LANES(8) r.v[i]=a.v[2*i]; return r;}
+static inline uint16x8_t vmovltq_u8(uint8x16_t a){uint16x8_t r; MVE_LANES(8) r.v[i]=a.v[2*i+1]; return r;}
+static inline uint32x4_t vmovlbq_u16(uint16x8_t a){uint32x4_t r; MVE_LANES(4) r.v[i]=a.v[2*i]; return r;}
+static inline uint32x4_t vmovltq_u16(uint16x8_t a){uint32x4_t r; MVE_LANES(4) r.v[i]=a.v[2*i+1]; return r;}
+static inline uint16x8_t vaddq_u16(uint16x8_t a, uint16x8_t b){MVE_LANES(8) a.v[i]+=b.v[i]; return a;}
+static inline uint32x4_t vaddq_u32(uint32x4_t a, uint32x4_t b){MVE_LANES(4) a.v[i]+=b.v[i]; return a;}
+static inline int16x8_t vaddq_s16(int16x8_t a, int16x8_t b){MVE_LANES(8) a.v[i]+=b.v[i]; return a;}
+static inline int32x4_t vaddq_s32(int32x4_t a, int32x4_t b){MVE_LANES(4) a.v[i]+=b.v[i]; return a;}
+static inline int16x8_t vsubq_s16(int16x8_t a, int16x8_t b){MVE_LANES(8) a.v[i]-=b.v[i]; return a;}
+static inline int32x4_t vsubq_s32(int32x4_t a, int32x4_t b){MVE_LANES(4) a.v[i]-=b.v[i]; return a;}
+static inline int16x8_t vaddq_n_s16(int16x8_t a, int16_t b){MVE_LANES(8) a.v[i]+=b; return a;}
+static inline int32x4_t vaddq_n_s32(int32x4_t a, int32_t b){MVE_LANES(4) a.v[i]+=b; return a;}
+static inline uint16x8_t vrshrq_n_u16(uint16x8_t a, int n){MVE_LANES(8) a.v[i]=(uint16_t)(((uint32_t)a.v[i]+(1u<<(n-1)))>>n); return a;}
+static inline uint32x4_t vrshrq_n_u32(uint32x4_t a, int n){MVE_LANES(4) a.v[i]=(uint32_t)(((uint64_t)a.v[i]+(1u<<(n-1)))>>n); return a;}
+static inline int16x8_t vrshrq_n_s16(int16x8_t a, int n){MVE_LANES(8) a.v[i]=(int16_t)(((int32_t)a.v[i]+(1<<(n-1)))>>n); return a;}
+static inline int32x4_t vrshrq_n_s32(int32x4_t a, int n){MVE_LANES(4) a.v[i]=(int32_t)(((int64_t)a.v[i]+(1<<(n-1)))>>n); return a;}
+static inline int16x8_t vshrq_n_s16(int16x8_t a, int n){MVE_LANES(8) a.v[i]>>=n; return a;}
+static inline int32x4_t vshrq_n_s32(int32x4_t a, int n){MVE_LANES(4) a.v[i]>>=n; return a;}
+static inline int16x8_t vshlq_n_s16(int16x8_t a, int n){MVE_LANES(8) a.v[i]=(int16_t)(a.v[i]<<n); return a;}
+static inline int32x4_t vshlq_n_s32(int32x4_t a, int n){MVE_LANES(4) a.v[i]=a.v[i]<<n; return a;}
+static inline uint8x16_t vmovnbq_u16(uint8x16_t a, uint16x8_t b){MVE_LANES(8) a.v[2*i]=(uint8_t)b.v[i]; return a;}
+static inline uint8x16_t vmovntq_u16(uint8x16_t a, uint16x8_t b){MVE_LANES(8) a.v[2*i+1]=(uint8_t)b.v[i]; return a;}
+static inline uint16x8_t vmovnbq_u32(uint16x8_t a, uint32x4_t b){MVE_LANES(4) a.v[2*i]=(uint16_t)b.v[i]; return a;}
+static inline uint16x8_t vmovntq_u32(uint16x8_t a, uint32x4_t b){MVE_LANES(4) a.v[2*i+1]=(uint16_t)b.v[i]; return a;}
+static inline uint8_t mve_sat8(int x){return x<0?0:x>255?255:x;}
+static inline uint16_t mve_sat16(int x){return x<0?0:x>65535?65535:x;}
+static inline uint8x16_t vqmovunbq_s16(uint8x16_t a, int16x8_t b){MVE_LANES(8) a.v[2*i]=mve_sat8(b.v[i]); return a;}
+static inline uint8x16_t vqmovuntq_s16(uint8x16_t a, int16x8_t b){MVE_LANES(8) a.v[2*i+1]=mve_sat8(b.v[i]); return a;}
+static inline uint16x8_t vqmovunbq_s32(uint16x8_t a, int32x4_t b){MVE_LANES(4) a.v[2*i]=mve_sat16(b.v[i]); return a;}
+static inline uint16x8_t vqmovuntq_s32(uint16x8_t a, int32x4_t b){MVE_LANES(4) a.v[2*i+1]=mve_sat16(b.v[i]); return a;}
+static inline uint8x16_t vdupq_n_u8(uint8_t x){uint8x16_t r; MVE_LANES(16) r.v[i]=x; return r;}
+static inline uint16x8_t vdupq_n_u16(uint16_t x){uint16x8_t r; MVE_LANES(8) r.v[i]=x; return r;}
+static inline int32x4_t vdupq_n_s32(int32_t x){int32x4_t r; MVE_LANES(4) r.v[i]=x; return r;}
+static inline int16x8_t vreinterpretq_s16_u16(uint16x8_t a){int16x8_t r; MVE_LANES(8) r.v[i]=(int16_t)a.v[i]; return r;}
+static inline int32x4_t vreinterpretq_s32_u32(uint32x4_t a){int32x4_t r; MVE_LANES(4) r.v[i]=(int32_t)a.v[i]; return r;}
+static inline uint8x16_t vmulq_n_u8(uint8x16_t a, uint8_t b){MVE_LANES(16) a.v[i]*=b; return a;}
+static inline uint16x8_t vmulq_n_u16(uint16x8_t a, uint16_t b){MVE_LANES(8) a.v[i]*=b; return a;}
+static inline int16x8_t vmulq_n_s16(int16x8_t a, int16_t b){MVE_LANES(8) a.v[i]*=b; return a;}
+static inline int32x4_t vmulq_n_s32(int32x4_t a, int32_t b){MVE_LANES(4) a.v[i]*=b; return a;}
+#define vmulq vmulq_n_u8
+static inline uint8x16_t vidupq_n_u8(uint32_t a, int imm){uint8x16_t r; MVE_LANES(16) r.v[i]=a+i*imm; return r;}
+static inline uint16x8_t vidupq_n_u16(uint32_t a, int imm){uint16x8_t r; MVE_LANES(8) r.v[i]=a+i*imm; return r;}
+static inline void vstrbq_scatter_offset_u8(uint8_t *b, uint8x16_t o, uint8x16_t v){MVE_LANES(16) b[o.v[i]]=v.v[i];}
+static inline void vstrbq_scatter_offset_p(uint8_t *b, uint8x16_t o, uint8x16_t v, mve_pred16_t p){MVE_LANES(16) if(p&(1u<<i)) b[o.v[i]]=v.v[i];}
+static inline void vstrhq_scatter_shifted_offset_u16(uint16_t *b, uint16x8_t o, uint16x8_t v){MVE_LANES(8) b[o.v[i]]=v.v[i];}
+static inline uint8x16_t vrhaddq_u8(uint8x16_t a, uint8x16_t b){MVE_LANES(16) a.v[i]=(a.v[i]+b.v[i]+1)>>1; return a;}
+static inline uint8x16_t vrhaddq_x(uint8x16_t a, uint8x16_t b, mve_pred16_t p){(void)p; return vrhaddq_u8(a,b);}
+static inline uint16x8_t vrhaddq_u16(uint16x8_t a, uint16x8_t b){MVE_LANES(8) a.v[i]=((uint32_t)a.v[i]+b.v[i]+1)>>1; return a;}
+static inline uint16x8_t vhaddq_u16(uint16x8_t a, uint16x8_t b){MVE_LANES(8) a.v[i]=((uint32_t)a.v[i]+b.v[i])>>1; return a;}
+static inline int32x4_t vminq_s32(int32x4_t a, int32x4_t b){MVE_LANES(4) a.v[i]=a.v[i]<b.v[i]?a.v[i]:b.v[i]; return a;}
+static inline uint16x8_t vminq_u16(uint16x8_t a, uint16x8_t b){MVE_LANES(8) a.v[i]=a.v[i]<b.v[i]?a.v[i]:b.v[i]; return a;}
+static inline mve_pred16_t vctp8q(int n){return n>=16?0xFFFF:n<=0?0:(uint16_t)((1u<<n)-1);}
+
+#endif /* HOST_ARM_MVE_H */
@@ -0,0 +1,31 @@
+/**************************************************************************//**
+ * @file     bayer_ref.c
+ * @brief    Host-only second build of bayer.c with the Helium (MVE) inner
+ *           loops disabled. Every public symbol gets a ref_ prefix so the
+ *           scalar reference links next to the optimized build in
+ *           bayer_test.
+ ******************************************************************************/
+
+#undef  ENABLE_MVE_BAYER2RGB
+#define ENABLE_MVE_BAYER2RGB                      0
+
+#define ClearBorders                              ref_ClearBorders
+#define ClearBorders_uint16                       ref_ClearBorders_uint16
+#define dc1394_bayer_NearestNeighbor_uint16       ref_dc1394_bayer_NearestNeighbor_uint16
+#define dc1394_bayer_Simple                       ref_dc1394_bayer_Simple
+#define dc1394_bayer_Simple_uint16                ref_dc1394_bayer_Simple_uint16
+#define dc1394_bayer_Bilinear                     ref_dc1394_bayer_Bilinear
+#define dc1394_bayer_Bilinear_uint16              ref_dc1394_bayer_Bilinear_uint16
+#define dc1394_bayer_HQLinear                     ref_dc1394_bayer_HQLinear
+#define dc1394_bayer_HQLinear_uint16              ref_dc1394_bayer_HQLinear_uint16
+#define dc1394_bayer_Downsample_uint16            ref_dc1394_bayer_Downsample_uint16
+#define dc1394_bayer_EdgeSense_uint16             ref_dc1394_bayer_EdgeSense_uint16
+#define dc1394_bayer_decoding_8bit                ref_dc1394_bayer_decoding_8bit
+#define dc1394_bayer_decoding_16bit               ref_dc1394_bayer_decoding_16bit
+#define dc1394_bayer_decoding_8bit_output         ref_dc1394_bayer_decoding_8bit_output
+#define dc1394_bayer_decoding_8bit_tiled          ref_dc1394_bayer_decoding_8bit_tiled
+#define dc1394_bayer_stream_init                  ref_dc1394_bayer_stream_init
+#define dc1394_bayer_stream_start_frame           ref_dc1394_bayer_stream_start_frame
+#define dc1394_bayer_stream_push                  ref_dc1394_bayer_stream_push
+
+#include "../bayer.c"
@@ -0,0 +1,290 @@
+/**************************************************************************//**
+ * @file     bayer_test.c
+ * @brief    Host (Linux) test and benchmark of the bayer2rgb decoding paths.
+ *
+ *           Checks the optimized build of bayer.c bit-exactly against the
+ *           portable scalar reference (host/bayer_ref.c) for the Simple,
+ *           Bilinear and HQLinear methods, every color filter and odd frame
+ *           sizes: full frame 8-bit and 16-bit decoding, streaming, tiled
+ *           and fused output. Then times one frame per method.
+ *
+ *           Build and run from the bayer2rgb directory:
+ *
+ *             cc -O2 -Wall -I. -Ihost -DENABLE_MVE_BAYER2RGB=1 \
+ *                -DENABLE_16_BIT_VERSION=1 \
+ *                -DENABLE_DC1394_BAYER_METHOD_SIMPLE=1 \
+ *                -DENABLE_DC1394_BAYER_METHOD_BILINEAR=1 \
+ *                host/bayer_test.c host/bayer_ref.c bayer.c -o bayer_test
+ *             ./bayer_test [width height iterations]
+ *
+ *           With -DENABLE_MVE_BAYER2RGB=1 the Helium inner loops run on the
+ *           scalar intrinsic model in host/arm_mve.h: the comparison is
+ *           exact, but the "optimized" timings only mean something on a
+ *           Cortex-M55. Build with -DENABLE_MVE_BAYER2RGB=0 to time the
+ *           scalar loops with the host compiler's own vectorizer instead.
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bayer.h"
+
+dc1394error_t
+ref_dc1394_bayer_decoding_8bit(const uint8_t * bayer, uint8_t * rgb, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method);
+
+dc1394error_t
+ref_dc1394_bayer_decoding_16bit(const uint16_t * bayer, uint16_t * rgb, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method, uint32_t bits);
+
+dc1394error_t
+ref_dc1394_bayer_decoding_8bit_output(const uint8_t * bayer, void * out, uint32_t sx, uint32_t sy, dc1394color_filter_t tile, dc1394bayer_method_t method, const dc1394bayer_output_t * output, uint8_t * rgb_lines, uint32_t rgb_lines_size);
+
+static const dc1394bayer_method_t test_methods[] = {
+    DC1394_BAYER_METHOD_SIMPLE,
+    DC1394_BAYER_METHOD_BILINEAR,
+    DC1394_BAYER_METHOD_HQLINEAR
+};
+static const char *const test_method_names[] = { "Simple", "Bilinear", "HQLinear" };
+#define TEST_METHODS    (sizeof(test_methods) / sizeof(test_methods[0]))
+
+/* Odd widths and heights exercise the Helium line tails */
+static const uint32_t test_sizes[][2] = {
+    { 5, 5 }, { 6, 6 }, { 9, 7 }, { 33, 5 }, { 35, 6 }, { 37, 23 },
+    { 64, 9 }, { 67, 35 }, { 100, 100 }, { 101, 53 }, { 160, 120 }
+};
+#define TEST_SIZES      (sizeof(test_sizes) / sizeof(test_sizes[0]))
+
+static uint32_t test_failures;
+
+static void test_fail(const char *what, uint32_t sx, uint32_t sy, uint32_t m, uint32_t tile, int32_t arg)
+{
+    printf("FAIL %-8s %ux%u %-8s tile %u arg %d\n", what, sx, sy, test_method_names[m],
+           tile - DC1394_COLOR_FILTER_MIN, arg);
+    test_failures++;
+}
+
+/* Random raw data with saturated pixels to hit the clipping paths */
+static void test_fill_8bit(uint8_t *raw, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+        raw[i] = (i % 7U == 0U) ? (uint8_t)((rand() & 1) * 255) : (uint8_t)rand();
+}
+
+static void test_fill_16bit(uint16_t *raw, uint32_t n, uint32_t bits)
+{
+    for (uint32_t i = 0; i < n; i++)
+        raw[i] = (i % 5U == 0U) ? (uint16_t)((rand() & 1) * ((1 << bits) - 1))
+                                : (uint16_t)(rand() & ((1 << bits) - 1));
+}
+
+/* Inline worker backend: every third band is refused and run by the caller */
+static int32_t test_band_start(void *context, uint32_t index, void (*band)(void *arg), void *arg)
+{
+    (void)context;
+    if (index % 3U == 2U)
+        return -1;
+    band(arg);
+    return 0;
+}
+
+static void test_band_wait(void *context)
+{
+    (void)context;
+}
+
+static void test_frame(uint32_t sx, uint32_t sy, uint32_t m, dc1394color_filter_t tile, const uint8_t *raw,
+                       const uint8_t *ref, uint8_t *out)
+{
+    const uint32_t size = 3 * sx * sy;
+    const dc1394bayer_method_t method = test_methods[m];
+    dc1394error_t err;
+
+    /* Full frame */
+    memset(out, 0x55, size);
+    err = dc1394_bayer_decoding_8bit(raw, out, sx, sy, tile, method);
+    if (err != DC1394_SUCCESS || memcmp(ref, out, size) != 0)
+        test_fail("frame", sx, sy, m, tile, err);
+
+    /* Streaming, several push sizes and arena sizes */
+    for (uint32_t push = 1; push <= sy; push += (push < 4U) ? 1U : 7U) {
+        for (uint32_t extra = 0; extra < 3U; extra++) {
+            const uint32_t arena_size = DC1394_BAYER_STREAM_ARENA_SIZE(sx, push + 3U * extra);
+            uint8_t *arena = malloc(arena_size);
+            dc1394bayer_stream_t stream;
+            uint32_t row = 0, rgb_row = 0, lines;
+
+            err = dc1394_bayer_stream_init(&stream, sx, sy, tile, method, arena, arena_size);
+            if (err != DC1394_SUCCESS) {
+                test_fail("stream", sx, sy, m, tile, err);
+                free(arena);
+                continue;
+            }
+            memset(out, 0x77, size);
+            while (row < sy) {
+                const uint32_t n = (push < sy - row) ? push : sy - row;
+                err = dc1394_bayer_stream_push(&stream, raw + row * sx, n, out + rgb_row * 3 * sx, &lines);
+                if (err != DC1394_SUCCESS || lines > n + DC1394_BAYER_STREAM_EXTRA_LINES)
+                    break;
+                row += n;
+                rgb_row += lines;
+            }
+            if (err != DC1394_SUCCESS || rgb_row != sy || memcmp(ref, out, size) != 0)
+                test_fail("stream", sx, sy, m, tile, (int32_t)push);
+            free(arena);
+        }
+    }
+
+    /* Tiled, 1 to DC1394_BAYER_WORKERS_MAX bands */
+    for (uint32_t count = 1; count <= DC1394_BAYER_WORKERS_MAX; count++) {
+        const dc1394bayer_workers_t workers = { count, NULL, test_band_start, test_band_wait };
+        memset(out, 0x33, size);
+        err = dc1394_bayer_decoding_8bit_tiled(raw, out, sx, sy, tile, method, &workers);
+        if (err != DC1394_SUCCESS || memcmp(ref, out, size) != 0)
+            test_fail("tiled", sx, sy, m, tile, (int32_t)count);
+    }
+
+    /* Fused RGB888 without downscale is the plain frame */
+    for (uint32_t strip = 1; strip <= 5U; strip++) {
+        dc1394bayer_output_t output = { 0 };
+        uint8_t *rgb_lines = malloc(3 * sx * strip);
+        output.format    = DC1394_BAYER_OUTPUT_RGB888;
+        output.downscale = 1;
+        memset(out, 0x11, size);
+        err = dc1394_bayer_decoding_8bit_output(raw, out, sx, sy, tile, method, &output, rgb_lines, 3 * sx * strip);
+        if (err != DC1394_SUCCESS || memcmp(ref, out, size) != 0)
+            test_fail("fused", sx, sy, m, tile, (int32_t)strip);
+        free(rgb_lines);
+    }
+
+    /* Fused RGB565 / planar int8 with downscale, against the scalar build */
+    for (uint32_t f = 2; f <= 4U; f += 2U) {
+        for (uint32_t format = DC1394_BAYER_OUTPUT_RGB565; format <= DC1394_BAYER_OUTPUT_INT8_PLANAR; format++) {
+            for (uint32_t filter = DC1394_BAYER_DOWNSCALE_BOX; filter <= DC1394_BAYER_DOWNSCALE_BILINEAR; filter++) {
+                const uint32_t lines_size = DC1394_BAYER_OUTPUT_LINES_SIZE(sx, f) * 2U;
+                const uint32_t out_size = 3 * (sx / f) * (sy / f);
+                dc1394bayer_output_t output = {
+                    (dc1394bayer_output_format_t)format, (dc1394bayer_downscale_t)filter, f,
+                    { 65536 / 2, 65536 / 3, 65536 / 2 }, { -128, -64, -100 }
+                };
+                uint8_t *rgb_lines = malloc(lines_size);
+                uint8_t *fused_ref = malloc(out_size + 1);
+                dc1394error_t ref_err;
+
+                memset(out, 0x22, out_size + 1);
+                memset(fused_ref, 0x22, out_size + 1);
+                ref_err = ref_dc1394_bayer_decoding_8bit_output(raw, fused_ref, sx, sy, tile, method, &output, rgb_lines, lines_size);
+                err = dc1394_bayer_decoding_8bit_output(raw, out, sx, sy, tile, method, &output, rgb_lines, lines_size);
+                if (err != DC1394_SUCCESS || err != ref_err || memcmp(fused_ref, out, out_size + 1) != 0)
+                    test_fail("downscale", sx, sy, m, tile, (int32_t)(f * 100U + format * 10U + filter));
+                free(rgb_lines);
+                free(fused_ref);
+            }
+        }
+    }
+}
+
+static void test_frame_16bit(uint32_t sx, uint32_t sy, uint32_t m, dc1394color_filter_t tile)
+{
+    static const uint32_t test_bits[] = { 10, 12, 16 };
+    const uint32_t n = sx * sy;
+    uint16_t *raw = malloc(n * sizeof(uint16_t));
+    uint16_t *ref = malloc(3 * n * sizeof(uint16_t));
+    uint16_t *out = malloc(3 * n * sizeof(uint16_t));
+
+    for (uint32_t b = 0; b < sizeof(test_bits) / sizeof(test_bits[0]); b++) {
+        dc1394error_t ref_err, err;
+
+        test_fill_16bit(raw, n, test_bits[b]);
+        /* Bilinear leaves the 16-bit border untouched: same fill on both */
+        memset(ref, 0xA5, 3 * n * sizeof(uint16_t));
+        memset(out, 0xA5, 3 * n * sizeof(uint16_t));
+        ref_err = ref_dc1394_bayer_decoding_16bit(raw, ref, sx, sy, tile, test_methods[m], test_bits[b]);
+        err = dc1394_bayer_decoding_16bit(raw, out, sx, sy, tile, test_methods[m], test_bits[b]);
+        if (err != DC1394_SUCCESS || err != ref_err || memcmp(ref, out, 3 * n * sizeof(uint16_t)) != 0)
+            test_fail("16-bit", sx, sy, m, tile, (int32_t)test_bits[b]);
+    }
+    free(raw);
+    free(ref);
+    free(out);
+}
+
+static double test_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+static void test_benchmark(uint32_t sx, uint32_t sy, uint32_t iterations)
+{
+    uint8_t *raw = malloc(sx * sy);
+    uint8_t *rgb = malloc(3 * sx * sy);
+
+    test_fill_8bit(raw, sx * sy);
+    printf("\n%ux%u, %u iterations, ms per frame\n", sx, sy, iterations);
+    printf("%-10s %12s %12s\n", "method", "reference", "optimized");
+    for (uint32_t m = 0; m < TEST_METHODS; m++) {
+        double t0, t_ref, t_opt;
+
+        t0 = test_now_ms();
+        for (uint32_t i = 0; i < iterations; i++)
+            ref_dc1394_bayer_decoding_8bit(raw, rgb, sx, sy, DC1394_COLOR_FILTER_GRBG, test_methods[m]);
+        t_ref = (test_now_ms() - t0) / iterations;
+
+        t0 = test_now_ms();
+        for (uint32_t i = 0; i < iterations; i++)
+            dc1394_bayer_decoding_8bit(raw, rgb, sx, sy, DC1394_COLOR_FILTER_GRBG, test_methods[m]);
+        t_opt = (test_now_ms() - t0) / iterations;
+
+        printf("%-10s %12.3f %12.3f\n", test_method_names[m], t_ref, t_opt);
+    }
+    free(raw);
+    free(rgb);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t bench_sx = 560, bench_sy = 560, iterations = 20;
+
+    if (argc == 4) {
+        bench_sx   = (uint32_t)strtoul(argv[1], NULL, 0);
+        bench_sy   = (uint32_t)strtoul(argv[2], NULL, 0);
+        iterations = (uint32_t)strtoul(argv[3], NULL, 0);
+    } else if (argc != 1) {
+        fprintf(stderr, "usage: %s [width height iterations]\n", argv[0]);
+        return 2;
+    }
+
+    srand(1);
+    for (uint32_t s = 0; s < TEST_SIZES; s++) {
+        const uint32_t sx = test_sizes[s][0], sy = test_sizes[s][1];
+        uint8_t *raw = malloc(sx * sy);
+        uint8_t *ref = malloc(3 * sx * sy);
+        uint8_t *out = malloc(3 * sx * sy + 1);
+
+        test_fill_8bit(raw, sx * sy);
+        for (uint32_t m = 0; m < TEST_METHODS; m++) {
+            for (uint32_t tile = DC1394_COLOR_FILTER_MIN; tile <= DC1394_COLOR_FILTER_MAX; tile++) {
+                memset(ref, 0xAA, 3 * sx * sy);
+                if (ref_dc1394_bayer_decoding_8bit(raw, ref, sx, sy, (dc1394color_filter_t)tile, test_methods[m]) != DC1394_SUCCESS) {
+                    test_fail("ref", sx, sy, m, tile, 0);
+                    continue;
+                }
+                test_frame(sx, sy, m, (dc1394color_filter_t)tile, raw, ref, out);
+                test_frame_16bit(sx, sy, m, (dc1394color_filter_t)tile);
+            }
+        }
+        free(raw);
+        free(ref);
+        free(out);
+    }
+    printf("%u sizes x %u methods x %u filters: %s (%u failures)\n", (unsigned)TEST_SIZES, (unsigned)TEST_METHODS,
+           (unsigned)DC1394_COLOR_FILTER_NUM, test_failures ? "FAILED" : "bit-exact", test_failures);
+
+    if (iterations != 0U)
+        test_benchmark(bench_sx, bench_sy, iterations);
+
+    return test_failures ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+/**************************************************************************//**
+ * @file     bayer_tiled_bench.c
+ * @brief    Host (Linux) scaling benchmark of dc1394_bayer_decoding_8bit_tiled
+ *           on the POSIX threads worker backend, from 1 to N workers.
+ *
+ *           Every tiled result is first checked bit-exactly against the
+ *           single-threaded dc1394_bayer_decoding_8bit frame.
+ *
+ *           Build and run from the bayer2rgb directory:
+ *
+ *             cc -O2 -Wall -I. -Ihost -DENABLE_MVE_BAYER2RGB=0 \
+ *                -DENABLE_DC1394_BAYER_METHOD_SIMPLE=1 \
+ *                -DENABLE_DC1394_BAYER_METHOD_BILINEAR=1 \
+ *                host/bayer_tiled_bench.c host/bayer_workers_pthread.c \
+ *                bayer.c -o bayer_tiled_bench -lpthread
+ *             ./bayer_tiled_bench [width height iterations workers]
+ *
+ *           workers defaults to the online CPUs, at most
+ *           DC1394_BAYER_WORKERS_MAX.
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bayer.h"
+#include "bayer_workers_pthread.h"
+
+static const dc1394bayer_method_t bench_methods[] = {
+    DC1394_BAYER_METHOD_SIMPLE,
+    DC1394_BAYER_METHOD_BILINEAR,
+    DC1394_BAYER_METHOD_HQLINEAR
+};
+static const char *const bench_method_names[] = { "Simple", "Bilinear", "HQLinear" };
+#define BENCH_METHODS   (sizeof(bench_methods) / sizeof(bench_methods[0]))
+
+static double bench_now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t sx = 1920, sy = 1080, iterations = 50, max_workers;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    uint8_t *raw, *ref, *rgb;
+    uint32_t failures = 0;
+
+    max_workers = (cpus > 0) ? (uint32_t)cpus : 1U;
+    if (argc >= 4) {
+        sx         = (uint32_t)strtoul(argv[1], NULL, 0);
+        sy         = (uint32_t)strtoul(argv[2], NULL, 0);
+        iterations = (uint32_t)strtoul(argv[3], NULL, 0);
+        if (argc == 5)
+            max_workers = (uint32_t)strtoul(argv[4], NULL, 0);
+    }
+    if ((argc != 1 && argc != 4 && argc != 5) || (iterations == 0U) || (max_workers == 0U)) {
+        fprintf(stderr, "usage: %s [width height iterations [workers]]\n", argv[0]);
+        return 2;
+    }
+    if (max_workers > DC1394_BAYER_WORKERS_MAX)
+        max_workers = DC1394_BAYER_WORKERS_MAX;
+
+    raw = malloc(sx * sy);
+    ref = malloc(3 * sx * sy);
+    rgb = malloc(3 * sx * sy);
+    srand(1);
+    for (uint32_t i = 0; i < sx * sy; i++)
+        raw[i] = (uint8_t)rand();
+
+    printf("%ux%u, %u iterations, %ld online CPUs, ms per frame (speedup)\n", sx, sy, iterations, cpus);
+    printf("%-10s %10s", "method", "single");
+    for (uint32_t w = 1; w <= max_workers; w++)
+        printf("   %2u workers     ", w);
+    printf("\n");
+
+    for (uint32_t m = 0; m < BENCH_METHODS; m++) {
+        double t0, t_single;
+
+        if (dc1394_bayer_decoding_8bit(raw, ref, sx, sy, DC1394_COLOR_FILTER_GRBG, bench_methods[m]) != DC1394_SUCCESS) {
+            printf("%-10s not enabled\n", bench_method_names[m]);
+            failures++;
+            continue;
+        }
+        t0 = bench_now_ms();
+        for (uint32_t i = 0; i < iterations; i++)
+            dc1394_bayer_decoding_8bit(raw, ref, sx, sy, DC1394_COLOR_FILTER_GRBG, bench_methods[m]);
+        t_single = (bench_now_ms() - t0) / iterations;
+        printf("%-10s %10.3f", bench_method_names[m], t_single);
+
+        for (uint32_t w = 1; w <= max_workers; w++) {
+            bayer_workers_pthread_t pool;
+            dc1394bayer_workers_t workers;
+            double t_tiled;
+
+            if (bayer_workers_pthread_init(&pool, w, &workers) != 0) {
+                printf("   %-15s", "no threads");
+                failures++;
+                continue;
+            }
+
+            memset(rgb, 0x5A, 3 * sx * sy);
+            if ((dc1394_bayer_decoding_8bit_tiled(raw, rgb, sx, sy, DC1394_COLOR_FILTER_GRBG, bench_methods[m], &workers) != DC1394_SUCCESS) ||
+                (memcmp(ref, rgb, 3 * sx * sy) != 0)) {
+                printf("   %-15s", "MISMATCH");
+                failures++;
+                bayer_workers_pthread_uninit(&pool);
+                continue;
+            }
+
+            t0 = bench_now_ms();
+            for (uint32_t i = 0; i < iterations; i++)
+                dc1394_bayer_decoding_8bit_tiled(raw, rgb, sx, sy, DC1394_COLOR_FILTER_GRBG, bench_methods[m], &workers);
+            t_tiled = (bench_now_ms() - t0) / iterations;
+            printf("   %7.3f (%4.2fx)", t_tiled, t_single / t_tiled);
+
+            bayer_workers_pthread_uninit(&pool);
+        }
+        printf("\n");
+    }
+
+    free(raw);
+    free(ref);
+    free(rgb);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,112 @@
+/**************************************************************************//**
+ * @file     bayer_workers_pthread.c
+ * @brief    POSIX threads backend of dc1394bayer_workers_t (host only).
+ ******************************************************************************/
+
+#include <stddef.h>
+#include "bayer_workers_pthread.h"
+
+static void *bayer_worker_thread(void *arg)
+{
+    bayer_worker_pthread_t *worker = arg;
+    bayer_workers_pthread_t *pool = worker->pool;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while ((worker->band == NULL) && !pool->stop)
+            pthread_cond_wait(&pool->cond, &pool->lock);
+        if (worker->band == NULL)
+            break;
+
+        pthread_mutex_unlock(&pool->lock);
+        worker->band(worker->arg);
+        pthread_mutex_lock(&pool->lock);
+
+        worker->band = NULL;
+        if (--pool->pending == 0U)
+            pthread_cond_broadcast(&pool->cond);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+static int32_t bayer_workers_pthread_start(void *context, uint32_t index, void (*band)(void *arg), void *arg)
+{
+    bayer_workers_pthread_t *pool = context;
+    int32_t ret = -1;
+
+    if (index >= pool->count)
+        return -1;
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->worker[index].band == NULL) {
+        pool->worker[index].band = band;
+        pool->worker[index].arg  = arg;
+        pool->pending++;
+        pthread_cond_broadcast(&pool->cond);
+        ret = 0;
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return ret;
+}
+
+static void bayer_workers_pthread_wait(void *context)
+{
+    bayer_workers_pthread_t *pool = context;
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending != 0U)
+        pthread_cond_wait(&pool->cond, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+int32_t bayer_workers_pthread_init(bayer_workers_pthread_t *pool, uint32_t count, dc1394bayer_workers_t *workers)
+{
+    uint32_t i;
+
+    if ((count == 0U) || (count > DC1394_BAYER_WORKERS_MAX))
+        return -1;
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+    pool->count   = 0;
+    pool->pending = 0;
+    pool->stop    = false;
+
+    for (i = 0; i < count; i++) {
+        pool->worker[i].pool = pool;
+        pool->worker[i].band = NULL;
+        pool->worker[i].arg  = NULL;
+        if (pthread_create(&pool->worker[i].thread, NULL, bayer_worker_thread, &pool->worker[i]) != 0) {
+            bayer_workers_pthread_uninit(pool);
+            return -1;
+        }
+        pool->count++;
+    }
+
+    workers->count   = count;
+    workers->context = pool;
+    workers->start   = bayer_workers_pthread_start;
+    workers->wait    = bayer_workers_pthread_wait;
+
+    return 0;
+}
+
+void bayer_workers_pthread_uninit(bayer_workers_pthread_t *pool)
+{
+    uint32_t i;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->count; i++)
+        pthread_join(pool->worker[i].thread, NULL);
+
+    pthread_cond_destroy(&pool->cond);
+    pthread_mutex_destroy(&pool->lock);
+    pool->count = 0;
+}
@@ -0,0 +1,40 @@
+/**************************************************************************//**
+ * @file     bayer_workers_pthread.h
+ * @brief    POSIX threads backend of dc1394bayer_workers_t (host only).
+ *
+ *           A fixed pool of threads, one per band, created once and reused
+ *           for every frame so thread creation stays out of the timings.
+ ******************************************************************************/
+
+#ifndef BAYER_WORKERS_PTHREAD_H
+#define BAYER_WORKERS_PTHREAD_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include "bayer.h"
+
+struct bayer_workers_pthread;
+
+typedef struct {
+    struct bayer_workers_pthread *pool;
+    pthread_t                     thread;
+    void                        (*band)(void *arg);   /* Band to run, NULL when idle */
+    void                         *arg;
+} bayer_worker_pthread_t;
+
+typedef struct bayer_workers_pthread {
+    pthread_mutex_t         lock;
+    pthread_cond_t          cond;      /* Band posted, band done or stop */
+    uint32_t                count;
+    uint32_t                pending;   /* Bands started and not done     */
+    bool                    stop;
+    bayer_worker_pthread_t  worker[DC1394_BAYER_WORKERS_MAX];
+} bayer_workers_pthread_t;
+
+/* Starts `count` threads and fills `workers` to use them, returns 0 on success */
+int32_t bayer_workers_pthread_init(bayer_workers_pthread_t *pool, uint32_t count, dc1394bayer_workers_t *workers);
+
+/* Stops and joins the threads, the pool must be idle */
+void bayer_workers_pthread_uninit(bayer_workers_pthread_t *pool);
+
+#endif /* BAYER_WORKERS_PTHREAD_H */
@@ -35,6 +35,11 @@
 #include "lwip/apps/fs.h"
 #include <string.h>
 
+/** Slot of the file name hash index generated by makefsdata.py */
+struct fsdata_index_entry {
+  u32_t hash;
+  const struct fsdata_file *file;
+};
 
 #include HTTPD_FSDATA_FILE
 
@@ -52,6 +57,52 @@ int fs_read_custom(struct fs_file *file, char *buffer, int count);
 #endif /* LWIP_HTTPD_FS_ASYNC_READ */
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
 
+/*-----------------------------------------------------------------------------------*/
+#ifdef FS_INDEX_SIZE
+/* 32-bit FNV-1a, must match fnv1a() in makefsdata.py */
+static u32_t
+fs_name_hash(const char *name)
+{
+  u32_t hash = 0x811c9dc5UL;
+
+  while (*name) {
+    hash ^= (u8_t)*name++;
+    hash *= 0x01000193UL;
+  }
+  return hash;
+}
+
+/* Open addressing lookup, the index is at most half full */
+static const struct fsdata_file *
+fs_find(const char *name)
+{
+  u32_t hash = fs_name_hash(name);
+  u32_t i;
+
+  for (i = hash & (FS_INDEX_SIZE - 1); FS_INDEX[i].file != NULL;
+       i = (i + 1) & (FS_INDEX_SIZE - 1)) {
+    if ((FS_INDEX[i].hash == hash) &&
+        !strcmp(name, (const char *)FS_INDEX[i].file->name)) {
+      return FS_INDEX[i].file;
+    }
+  }
+  return NULL;
+}
+#else /* FS_INDEX_SIZE */
+static const struct fsdata_file *
+fs_find(const char *name)
+{
+  const struct fsdata_file *f;
+
+  for (f = FS_ROOT; f != NULL; f = f->next) {
+    if (!strcmp(name, (const char *)f->name)) {
+      return f;
+    }
+  }
+  return NULL;
+}
+#endif /* FS_INDEX_SIZE */
+
 /*-----------------------------------------------------------------------------------*/
 err_t
 fs_open(struct fs_file *file, const char *name)
@@ -70,25 +121,26 @@ fs_open(struct fs_file *file, const char *name)
   file->is_custom_file = 0;
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
 
-  for (f = FS_ROOT; f != NULL; f = f->next) {
-    if (!strcmp(name, (const char *)f->name)) {
-      file->data = (const char *)f->data;
-      file->len = f->len;
-      file->index = f->len;
-      file->pextension = NULL;
-      file->flags = f->flags;
+  f = fs_find(name);
+  if (f == NULL) {
+    /* file not found */
+    return ERR_VAL;
+  }
+
+  /* Served in place from the constant data, header included */
+  file->data = (const char *)f->data;
+  file->len = f->len;
+  file->index = f->len;
+  file->pextension = NULL;
+  file->flags = f->flags;
 #if HTTPD_PRECALCULATED_CHECKSUM
-      file->chksum_count = f->chksum_count;
-      file->chksum = f->chksum;
+  file->chksum_count = f->chksum_count;
+  file->chksum = f->chksum;
 #endif /* HTTPD_PRECALCULATED_CHECKSUM */
 #if LWIP_HTTPD_FILE_STATE
-      file->state = fs_state_init(file, name);
+  file->state = fs_state_init(file, name);
 #endif /* #if LWIP_HTTPD_FILE_STATE */
-      return ERR_OK;
-    }
-  }
-  /* file not found */
-  return ERR_VAL;
+  return ERR_OK;
 }
 
 /*-----------------------------------------------------------------------------------*/
@@ -25,31 +25,155 @@
 #include "fsdata_alignment.h"
 #endif
 #if FSDATA_FILE_ALIGNMENT==1
-static const unsigned int dummy_align__img_sics_gif = 0;
+static const unsigned int dummy_align__404_html = 0;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST = {
+/* /404.html (10 chars) */
+0x2f,0x34,0x30,0x34,0x2e,0x68,0x74,0x6d,0x6c,0x00,0x00,0x00,
+
+/* HTTP header */
+/* "HTTP/1.0 404 File not found\r\n" (29 bytes) */
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x34,0x30,0x34,0x20,0x46,0x69,0x6c,
+0x65,0x20,0x6e,0x6f,0x74,0x20,0x66,0x6f,0x75,0x6e,0x64,0x0d,0x0a,
+/* "Server: lwIP/2.0.3d (http://savannah.nongnu.org/projects/lwip)\r\n" (64 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x32,0x2e,0x30,
+0x2e,0x33,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,
+0x6e,0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,
+0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
+/* "Content-Length: 344\r\n" (21 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x33,0x34,0x34,0x0d,0x0a,
+/* "Content-Encoding: gzip\r\n" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Content-Type: text/html\r\n\r\n" (27 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x0d,0x0a,
+/* gzip compressed file data (344 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x8d,0x92,0xcf,0x4e,0xc3,0x30,
+0x0c,0xc6,0xcf,0x9b,0xb4,0x77,0xb0,0x22,0xc1,0x09,0x96,0x6e,0x1a,0x12,0x82,0xb6,
+0x12,0xda,0x69,0x12,0x87,0x49,0xe5,0x05,0xd2,0xd5,0x4b,0x22,0xb2,0xa6,0x24,0xde,
+0xca,0xde,0x1e,0xf7,0x0f,0xac,0x47,0x72,0x48,0x22,0xfb,0xf7,0x25,0x9f,0xe3,0xa4,
+0x86,0x4e,0x2e,0x5f,0xcc,0x53,0x83,0xaa,0xca,0x53,0xb2,0xe4,0x30,0x77,0xed,0x6e,
+0x0f,0x8f,0xf0,0x06,0xef,0x56,0x1b,0x6a,0xb1,0x9b,0xe1,0x63,0xbb,0x97,0x1c,0x2e,
+0x48,0x1d,0x3e,0x53,0x39,0x80,0xa9,0xec,0x65,0x2c,0x2f,0x7d,0x75,0x85,0x52,0x1f,
+0xbc,0xf3,0x21,0x13,0xad,0xb1,0x84,0x02,0x08,0xbf,0x29,0x13,0xa5,0x63,0x85,0x60,
+0x68,0x31,0x07,0x1e,0x29,0xa9,0xd2,0x21,0xb4,0xb6,0x22,0x93,0x89,0x55,0x92,0xdc,
+0x75,0x39,0x80,0x21,0x17,0xe0,0xa2,0x9c,0xd5,0x75,0x26,0xc8,0x37,0x82,0x0d,0x55,
+0xbf,0xe4,0x73,0x22,0xf2,0x19,0xc0,0x62,0xce,0x53,0xaa,0xc0,0x04,0x3c,0x66,0xc2,
+0x10,0x35,0x2f,0x52,0xb6,0x6d,0xbb,0x8c,0xf6,0x10,0x97,0x11,0x25,0x8b,0xec,0x49,
+0x43,0x0c,0x87,0x4c,0x48,0xde,0xc9,0x3e,0xa1,0xed,0x51,0xf4,0xd2,0xd2,0x87,0x0a,
+0xd9,0x62,0x22,0x40,0x39,0x76,0x57,0xec,0xb6,0x05,0x38,0xaf,0x3d,0xdb,0xed,0x6a,
+0x9a,0x46,0xb8,0x3e,0xc5,0xde,0x66,0x5c,0x6e,0x35,0xb5,0xf2,0x94,0x4c,0xbd,0x98,
+0xd5,0x7f,0x1e,0x8c,0xa9,0x11,0x5f,0xe7,0x9b,0x64,0xc3,0xf4,0x5e,0x69,0x84,0xda,
+0x13,0x1c,0xfd,0xb9,0xae,0x98,0x58,0x8f,0x44,0x33,0xac,0x00,0x85,0x0f,0xe1,0xfa,
+0x00,0x64,0x10,0x9a,0x0e,0xbe,0xfa,0x33,0xa8,0x80,0x10,0xf0,0xeb,0x8c,0x91,0x6c,
+0xad,0xa1,0x55,0xf1,0x76,0x06,0xf8,0x9a,0x61,0x1b,0x47,0x79,0xc4,0x70,0xc1,0xb0,
+0x1c,0x6d,0xca,0x66,0x5a,0xca,0x70,0xc5,0x7d,0x5d,0xc6,0xe6,0xf5,0x2f,0x2c,0x29,
+0xdc,0x5a,0x21,0xfb,0x3e,0x75,0xbd,0x95,0x5d,0x73,0xfb,0xcd,0xf8,0x59,0x7e,0x00,
+0x5c,0x50,0x54,0x55,0x35,0x02,0x00,0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT==1
+static const unsigned int dummy_align__index_html = 1;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST = {
+/* /index.html (12 chars) */
+0x2f,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c,0x00,
+
+/* HTTP header */
+/* "HTTP/1.0 200 OK\r\n" (17 bytes) */
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x0a,
+/* "Server: lwIP/2.0.3d (http://savannah.nongnu.org/projects/lwip)\r\n" (64 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x32,0x2e,0x30,
+0x2e,0x33,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,
+0x6e,0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,
+0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
+/* "Content-Length: 826\r\n" (21 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x38,0x32,0x36,0x0d,0x0a,
+/* "Content-Encoding: gzip\r\n" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Content-Type: text/html\r\n\r\n" (27 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x0d,0x0a,
+/* gzip compressed file data (826 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x55,0xc1,0x6e,0xd4,0x30,
+0x10,0x3d,0xb7,0x52,0xff,0x61,0x14,0x09,0xb8,0x40,0xb2,0x48,0x20,0x21,0xd8,0xad,
+0x54,0x95,0x4b,0x25,0x2a,0x2a,0xb6,0x3f,0xe0,0x24,0xb3,0x89,0x59,0xc7,0x8e,0xec,
+0xc9,0x86,0xbd,0xf0,0xed,0x3c,0x3b,0x49,0xbb,0x2a,0x54,0x2a,0x7b,0xd8,0x38,0xf6,
+0xbc,0xf1,0x9b,0x37,0xcf,0xce,0xba,0x95,0xce,0x5c,0x5e,0x9c,0xaf,0x5b,0x56,0xf5,
+0xe5,0x5a,0xb4,0x18,0xbe,0x34,0xe3,0xcd,0x1d,0xbd,0xa3,0x2b,0xfa,0xa6,0x9b,0x56,
+0x46,0x8e,0xff,0x74,0x7f,0x7d,0x57,0x60,0x7a,0x2b,0xaa,0xda,0xaf,0x8b,0x29,0x70,
+0x5d,0x24,0x18,0xe0,0xa5,0xab,0x8f,0x54,0x36,0x95,0x33,0xce,0x6f,0xb2,0xb1,0xd5,
+0xc2,0x19,0x09,0xff,0x92,0x4d,0x56,0x1a,0x20,0x32,0x04,0x5d,0x9c,0x13,0x7e,0x6b,
+0x51,0xa5,0x61,0x1a,0x75,0x2d,0xed,0x26,0x7b,0xbf,0x5a,0xbd,0x8a,0x6b,0x44,0xd3,
+0x9a,0xa7,0x83,0x32,0xba,0xb1,0x9b,0x4c,0x5c,0x9f,0x81,0x50,0xbd,0x44,0x7e,0x5a,
+0x65,0x97,0x67,0x44,0x17,0xe7,0xf8,0x5b,0x2b,0x6a,0x3d,0xef,0x36,0x59,0x2b,0xd2,
+0x7f,0x2e,0x8a,0x71,0x1c,0xf3,0xa0,0xab,0x90,0x07,0x2e,0x00,0xd2,0x5d,0x43,0xc1,
+0x57,0x9b,0xac,0xc0,0xa8,0x48,0x0b,0x8d,0xde,0x65,0x09,0x5a,0x3a,0x5f,0x33,0x28,
+0xae,0x32,0x52,0x06,0xec,0xb6,0x37,0xd7,0x5b,0x32,0xae,0x71,0xa0,0x1b,0x6b,0x3a,
+0x9d,0x41,0x7d,0x0a,0xdc,0xce,0x50,0x6e,0x7d,0x4a,0xe5,0xe3,0xea,0x94,0x4b,0xfb,
+0xfe,0x25,0x82,0x21,0x6a,0x0a,0xef,0xa7,0x27,0xd1,0x7d,0x0b,0x15,0xb8,0xa4,0x5e,
+0x35,0x4c,0x47,0x37,0x90,0xf2,0x98,0x50,0x52,0xb5,0xda,0x36,0x18,0x04,0x0a,0xec,
+0x0f,0x5c,0x53,0x79,0x24,0x45,0x41,0x77,0xbd,0x49,0x80,0x19,0x9e,0x16,0x3d,0xf9,
+0xc1,0xda,0x18,0xef,0x2c,0x41,0x31,0x72,0x3b,0x12,0xe4,0x35,0x7f,0xf3,0x08,0x91,
+0x07,0x94,0x9b,0xe1,0xcf,0xea,0xf7,0x5b,0xd5,0xaa,0x2b,0xcc,0xa8,0x7b,0x48,0x19,
+0x0b,0x8b,0x22,0xe4,0x13,0xf7,0xa2,0x7f,0x5a,0x44,0xaa,0x5c,0x07,0x52,0x96,0x5c,
+0xcf,0x96,0x82,0x1b,0x7c,0xc5,0x94,0xc8,0x76,0x6c,0x45,0x89,0x06,0xb3,0x99,0xd5,
+0xc4,0x64,0x46,0xf6,0xde,0x89,0x83,0x5f,0x28,0x0c,0x30,0x0b,0xd6,0x95,0xa4,0xa2,
+0x9d,0xd7,0x8d,0xb6,0xca,0x98,0x23,0x8d,0x5e,0x8b,0x20,0x29,0x04,0xf8,0x4f,0xde,
+0x57,0x18,0xd3,0xd7,0xc1,0xee,0xd9,0x84,0x19,0x38,0x73,0xd8,0x8e,0x5c,0xeb,0xd0,
+0xd2,0x8d,0x0d,0xe8,0xf7,0x80,0x9d,0xb1,0x70,0xed,0xba,0x1e,0x43,0x4f,0xdb,0x4a,
+0xb3,0xad,0x38,0x96,0x4c,0xe5,0x20,0x64,0xdd,0x88,0xea,0xe6,0x0c,0x25,0x47,0xa1,
+0x55,0x25,0xfa,0xc0,0x60,0x57,0x33,0x1e,0x28,0x7a,0x6e,0x90,0x30,0xb6,0x44,0xae,
+0x65,0xda,0x2f,0x30,0x6c,0x27,0x5e,0x23,0x1b,0x22,0x47,0xe7,0x4d,0xfd,0x0e,0x36,
+0xe2,0x9c,0xb6,0xda,0x46,0xa5,0xe4,0x4d,0x20,0xcf,0x86,0x55,0xe0,0xb7,0x93,0x9c,
+0xad,0x5a,0xa0,0xa1,0x1f,0xbc,0x07,0x4c,0xc1,0x8f,0x12,0x93,0x6b,0x0b,0x96,0x1c,
+0x04,0x7a,0xd7,0x31,0x0e,0x9c,0xa0,0x4f,0xef,0x7c,0x4c,0x2e,0x0e,0xa6,0x80,0x27,
+0x94,0x59,0x24,0x36,0x4a,0x76,0xce,0x77,0x21,0x85,0x47,0x4e,0x68,0x07,0x4a,0x08,
+0xc7,0x20,0xdc,0x85,0x7c,0xda,0xae,0x42,0xef,0x4a,0xa6,0x21,0x20,0x05,0x6b,0x68,
+0xe4,0x67,0xf8,0x88,0x17,0xb4,0x23,0x3d,0xdd,0x10,0xf7,0xa4,0xc1,0xe2,0xf0,0x98,
+0x63,0x4c,0xf2,0x7d,0xfb,0xac,0x29,0xa2,0xb3,0x77,0xae,0x1a,0xc2,0x83,0x1d,0xe3,
+0x3e,0xb3,0x0f,0x9f,0x58,0x03,0xde,0x01,0x6f,0x14,0x39,0x54,0x3c,0xc3,0x23,0xe2,
+0xc7,0xd5,0x2d,0x18,0xc5,0x93,0x81,0xbb,0x04,0xbe,0x47,0xb3,0x8c,0x41,0xc5,0x87,
+0xd4,0x02,0xda,0x0d,0x78,0x0b,0x95,0x32,0xc9,0x54,0x39,0x76,0x7c,0xe8,0x52,0xa7,
+0xf6,0x1c,0xa6,0x1d,0xa3,0xb3,0xd2,0x65,0x03,0x11,0x62,0x7d,0x90,0x8f,0xb8,0x2b,
+0xb9,0xae,0x51,0xea,0x2c,0xc2,0x54,0x25,0x5c,0x76,0xe2,0x93,0xbd,0x36,0xae,0x3c,
+0x0a,0x27,0xfe,0x3b,0xcf,0x13,0x9d,0xa8,0xa1,0x77,0xae,0x4b,0xd9,0x94,0x77,0xd0,
+0x82,0x3e,0xac,0x1e,0x83,0x1f,0xf1,0x95,0xab,0x01,0xf9,0x7e,0xfb,0xac,0x40,0xb7,
+0xce,0x47,0x32,0xb1,0x37,0x93,0x0a,0xaa,0x8c,0x02,0x9f,0xb6,0x63,0x97,0xf2,0xe3,
+0x4c,0x2c,0xfa,0x2d,0xfe,0x77,0x1d,0xa7,0x1b,0x03,0x4b,0xff,0x3e,0x14,0x41,0x1d,
+0x94,0xb5,0xaa,0xcd,0xad,0xb3,0x8d,0x1d,0x72,0xe7,0x9b,0x02,0x87,0xed,0x27,0x57,
+0x12,0x96,0xf3,0xf1,0xe2,0xd0,0xf9,0x06,0x4c,0x85,0xf9,0x53,0x3a,0xd0,0x6d,0xaf,
+0x9f,0x27,0x11,0xc1,0x79,0x0c,0x51,0x79,0xe5,0xba,0xc7,0x1d,0x9f,0xcc,0xff,0x75,
+0xb7,0x2c,0x57,0xed,0xb4,0xe9,0x6b,0x5b,0x86,0xfe,0xcb,0xc3,0x74,0x21,0xfe,0xf1,
+0x53,0x51,0xa4,0xd6,0xc6,0x6f,0x4f,0x11,0x3f,0x3e,0x69,0x30,0x7f,0xcc,0x2e,0xce,
+0xff,0x00,0x49,0xda,0x70,0xc0,0xd7,0x06,0x00,0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT==1
+static const unsigned int dummy_align__img_sics_gif = 2;
 #endif
 static const unsigned char FSDATA_ALIGN_PRE data__img_sics_gif[] FSDATA_ALIGN_POST = {
 /* /img/sics.gif (14 chars) */
 0x2f,0x69,0x6d,0x67,0x2f,0x73,0x69,0x63,0x73,0x2e,0x67,0x69,0x66,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
-" (17 bytes) */
+/* "HTTP/1.0 200 OK\r\n" (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/2.0.3d (http://savannah.nongnu.org/projects/lwip)
-" (64 bytes) */
+/* "Server: lwIP/2.0.3d (http://savannah.nongnu.org/projects/lwip)\r\n" (64 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x32,0x2e,0x30,
 0x2e,0x33,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,
 0x6e,0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,
 0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-
-/* "Content-Length: 724
-" (18+ bytes) */
+/* "Content-Length: 724\r\n" (21 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
 0x37,0x32,0x34,0x0d,0x0a,
-/* "Content-Type: image/gif
-
-" (27 bytes) */
+/* "Content-Type: image/gif\r\n\r\n" (27 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x69,0x6d,
 0x61,0x67,0x65,0x2f,0x67,0x69,0x66,0x0d,0x0a,0x0d,0x0a,
 /* raw file data (724 bytes) */
@@ -98,226 +222,13 @@ static const unsigned char FSDATA_ALIGN_PRE data__img_sics_gif[] FSDATA_ALIGN_PO
 0x0d,0x0c,0xb0,0x8b,0xda,0x90,0xca,0x80,0x06,0x5d,0x17,0x60,0x1c,0x22,0x4c,0xd8,
 0x57,0x22,0x06,0x20,0x00,0x98,0x07,0x08,0xe4,0x56,0x80,0x80,0x1c,0xc5,0xb7,0xc5,
 0x82,0x0c,0x36,0xe8,0xe0,0x83,0x10,0x46,0x28,0xe1,0x84,0x14,0x56,0x68,0xa1,0x10,
-0x41,0x00,0x00,0x3b,};
+0x41,0x00,0x00,0x3b,
+};
 
-#if FSDATA_FILE_ALIGNMENT==1
-static const unsigned int dummy_align__404_html = 1;
-#endif
-static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST = {
-/* /404.html (10 chars) */
-0x2f,0x34,0x30,0x34,0x2e,0x68,0x74,0x6d,0x6c,0x00,0x00,0x00,
 
-/* HTTP header */
-/* "HTTP/1.0 404 File not found
-" (29 bytes) */
-0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x34,0x30,0x34,0x20,0x46,0x69,0x6c,
-0x65,0x20,0x6e,0x6f,0x74,0x20,0x66,0x6f,0x75,0x6e,0x64,0x0d,0x0a,
-/* "Server: lwIP/2.0.3d (http://savannah.nongnu.org/projects/lwip)
-" (64 bytes) */
-0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x32,0x2e,0x30,
-0x2e,0x33,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,
-0x6e,0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,
-0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-
-/* "Content-Length: 565
-" (18+ bytes) */
-0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
-0x35,0x36,0x35,0x0d,0x0a,
-/* "Content-Type: text/html
-
-" (27 bytes) */
-0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (565 bytes) */
-0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x3c,0x68,0x65,0x61,0x64,0x3e,0x3c,0x74,
-0x69,0x74,0x6c,0x65,0x3e,0x6c,0x77,0x49,0x50,0x20,0x2d,0x20,0x41,0x20,0x4c,0x69,
-0x67,0x68,0x74,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x54,0x43,0x50,0x2f,0x49,0x50,
-0x20,0x53,0x74,0x61,0x63,0x6b,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x3c,0x2f,
-0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x3c,0x62,0x6f,0x64,0x79,0x20,0x62,0x67,0x63,
-0x6f,0x6c,0x6f,0x72,0x3d,0x22,0x77,0x68,0x69,0x74,0x65,0x22,0x20,0x74,0x65,0x78,
-0x74,0x3d,0x22,0x62,0x6c,0x61,0x63,0x6b,0x22,0x3e,0x0d,0x0a,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,
-0x31,0x30,0x30,0x25,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-0x72,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x74,0x6f,0x70,0x22,0x3e,0x3c,
-0x74,0x64,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x38,0x30,0x22,0x3e,0x09,0x20,
-0x20,0x0d,0x0a,0x09,0x20,0x20,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x68,
-0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x73,0x69,0x63,0x73,0x2e,0x73,
-0x65,0x2f,0x22,0x3e,0x3c,0x69,0x6d,0x67,0x20,0x73,0x72,0x63,0x3d,0x22,0x2f,0x69,
-0x6d,0x67,0x2f,0x73,0x69,0x63,0x73,0x2e,0x67,0x69,0x66,0x22,0x0d,0x0a,0x09,0x20,
-0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x61,0x6c,0x74,0x3d,
-0x22,0x53,0x49,0x43,0x53,0x20,0x6c,0x6f,0x67,0x6f,0x22,0x20,0x74,0x69,0x74,0x6c,
-0x65,0x3d,0x22,0x53,0x49,0x43,0x53,0x20,0x6c,0x6f,0x67,0x6f,0x22,0x3e,0x3c,0x2f,
-0x61,0x3e,0x0d,0x0a,0x09,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x20,0x77,0x69,
-0x64,0x74,0x68,0x3d,0x22,0x35,0x30,0x30,0x22,0x3e,0x09,0x20,0x20,0x0d,0x0a,0x09,
-0x20,0x20,0x3c,0x68,0x31,0x3e,0x6c,0x77,0x49,0x50,0x20,0x2d,0x20,0x41,0x20,0x4c,
-0x69,0x67,0x68,0x74,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x54,0x43,0x50,0x2f,0x49,
-0x50,0x20,0x53,0x74,0x61,0x63,0x6b,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x09,0x20,
-0x20,0x3c,0x68,0x32,0x3e,0x34,0x30,0x34,0x20,0x2d,0x20,0x50,0x61,0x67,0x65,0x20,
-0x6e,0x6f,0x74,0x20,0x66,0x6f,0x75,0x6e,0x64,0x3c,0x2f,0x68,0x32,0x3e,0x0d,0x0a,
-0x09,0x20,0x20,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x53,0x6f,0x72,
-0x72,0x79,0x2c,0x20,0x74,0x68,0x65,0x20,0x70,0x61,0x67,0x65,0x20,0x79,0x6f,0x75,
-0x20,0x61,0x72,0x65,0x20,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x69,0x6e,0x67,0x20,
-0x77,0x61,0x73,0x20,0x6e,0x6f,0x74,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x6f,0x6e,
-0x20,0x74,0x68,0x69,0x73,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x73,0x65,0x72,0x76,
-0x65,0x72,0x2e,0x20,0x0d,0x0a,0x09,0x20,0x20,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,
-0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x0d,0x0a,0x09,0x20,0x20,0x26,0x6e,
-0x62,0x73,0x70,0x3b,0x0d,0x0a,0x09,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,
-0x3e,0x0d,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,
-0x6d,0x6c,0x3e,0x0d,0x0a,};
-
-#if FSDATA_FILE_ALIGNMENT==1
-static const unsigned int dummy_align__index_html = 2;
-#endif
-static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST = {
-/* /index.html (12 chars) */
-0x2f,0x69,0x6e,0x64,0x65,0x78,0x2e,0x68,0x74,0x6d,0x6c,0x00,
-
-/* HTTP header */
-/* "HTTP/1.0 200 OK
-" (17 bytes) */
-0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
-0x0a,
-/* "Server: lwIP/2.0.3d (http://savannah.nongnu.org/projects/lwip)
-" (64 bytes) */
-0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x32,0x2e,0x30,
-0x2e,0x33,0x64,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,
-0x6e,0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,
-0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-
-/* "Content-Length: 1751
-" (18+ bytes) */
-0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
-0x31,0x37,0x35,0x31,0x0d,0x0a,
-/* "Content-Type: text/html
-
-" (27 bytes) */
-0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (1751 bytes) */
-0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x3c,0x68,0x65,0x61,0x64,0x3e,0x3c,0x74,
-0x69,0x74,0x6c,0x65,0x3e,0x6c,0x77,0x49,0x50,0x20,0x2d,0x20,0x41,0x20,0x4c,0x69,
-0x67,0x68,0x74,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x54,0x43,0x50,0x2f,0x49,0x50,
-0x20,0x53,0x74,0x61,0x63,0x6b,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x3c,0x2f,
-0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x3c,0x62,0x6f,0x64,0x79,0x20,0x62,0x67,0x63,
-0x6f,0x6c,0x6f,0x72,0x3d,0x22,0x77,0x68,0x69,0x74,0x65,0x22,0x20,0x74,0x65,0x78,
-0x74,0x3d,0x22,0x62,0x6c,0x61,0x63,0x6b,0x22,0x3e,0x0d,0x0a,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,
-0x31,0x30,0x30,0x25,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-0x72,0x20,0x76,0x61,0x6c,0x69,0x67,0x6e,0x3d,0x22,0x74,0x6f,0x70,0x22,0x3e,0x3c,
-0x74,0x64,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x38,0x30,0x22,0x3e,0x09,0x20,
-0x20,0x0d,0x0a,0x09,0x20,0x20,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x68,
-0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x73,0x69,0x63,0x73,0x2e,0x73,
-0x65,0x2f,0x22,0x3e,0x3c,0x69,0x6d,0x67,0x20,0x73,0x72,0x63,0x3d,0x22,0x2f,0x69,
-0x6d,0x67,0x2f,0x73,0x69,0x63,0x73,0x2e,0x67,0x69,0x66,0x22,0x0d,0x0a,0x09,0x20,
-0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,0x22,0x30,0x22,0x20,0x61,0x6c,0x74,0x3d,
-0x22,0x53,0x49,0x43,0x53,0x20,0x6c,0x6f,0x67,0x6f,0x22,0x20,0x74,0x69,0x74,0x6c,
-0x65,0x3d,0x22,0x53,0x49,0x43,0x53,0x20,0x6c,0x6f,0x67,0x6f,0x22,0x3e,0x3c,0x2f,
-0x61,0x3e,0x0d,0x0a,0x09,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x20,0x77,0x69,
-0x64,0x74,0x68,0x3d,0x22,0x35,0x30,0x30,0x22,0x3e,0x09,0x20,0x20,0x0d,0x0a,0x09,
-0x20,0x20,0x3c,0x68,0x31,0x3e,0x6c,0x77,0x49,0x50,0x20,0x2d,0x20,0x41,0x20,0x4c,
-0x69,0x67,0x68,0x74,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x54,0x43,0x50,0x2f,0x49,
-0x50,0x20,0x53,0x74,0x61,0x63,0x6b,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x09,0x20,
-0x20,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x54,0x68,0x65,0x20,0x77,
-0x65,0x62,0x20,0x70,0x61,0x67,0x65,0x20,0x79,0x6f,0x75,0x20,0x61,0x72,0x65,0x20,
-0x77,0x61,0x74,0x63,0x68,0x69,0x6e,0x67,0x20,0x77,0x61,0x73,0x20,0x73,0x65,0x72,
-0x76,0x65,0x64,0x20,0x62,0x79,0x20,0x61,0x20,0x73,0x69,0x6d,0x70,0x6c,0x65,0x20,
-0x77,0x65,0x62,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x73,0x65,0x72,0x76,0x65,0x72,
-0x20,0x72,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x20,0x6f,0x6e,0x20,0x74,0x6f,0x70,0x20,
-0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x67,0x68,0x74,0x77,0x65,0x69,0x67,
-0x68,0x74,0x20,0x54,0x43,0x50,0x2f,0x49,0x50,0x20,0x73,0x74,0x61,0x63,0x6b,0x20,
-0x3c,0x61,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x68,
-0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x73,0x69,0x63,0x73,0x2e,0x73,
-0x65,0x2f,0x7e,0x61,0x64,0x61,0x6d,0x2f,0x6c,0x77,0x69,0x70,0x2f,0x22,0x3e,0x6c,
-0x77,0x49,0x50,0x3c,0x2f,0x61,0x3e,0x2e,0x0d,0x0a,0x09,0x20,0x20,0x3c,0x2f,0x70,
-0x3e,0x0d,0x0a,0x09,0x20,0x20,0x3c,0x70,0x3e,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,
-0x6c,0x77,0x49,0x50,0x20,0x69,0x73,0x20,0x61,0x6e,0x20,0x6f,0x70,0x65,0x6e,0x20,
-0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x69,0x6d,0x70,0x6c,0x65,0x6d,0x65,0x6e,0x74,
-0x61,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x54,0x43,0x50,
-0x2f,0x49,0x50,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x70,0x72,0x6f,0x74,0x6f,0x63,
-0x6f,0x6c,0x20,0x73,0x75,0x69,0x74,0x65,0x20,0x74,0x68,0x61,0x74,0x20,0x77,0x61,
-0x73,0x20,0x6f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x6c,0x79,0x20,0x77,0x72,0x69,
-0x74,0x74,0x65,0x6e,0x20,0x62,0x79,0x20,0x3c,0x61,0x0d,0x0a,0x09,0x20,0x20,0x20,
-0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-0x77,0x2e,0x73,0x69,0x63,0x73,0x2e,0x73,0x65,0x2f,0x7e,0x61,0x64,0x61,0x6d,0x2f,
-0x6c,0x77,0x69,0x70,0x2f,0x22,0x3e,0x41,0x64,0x61,0x6d,0x20,0x44,0x75,0x6e,0x6b,
-0x65,0x6c,0x73,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,
-0x20,0x53,0x77,0x65,0x64,0x69,0x73,0x68,0x20,0x49,0x6e,0x73,0x74,0x69,0x74,0x75,
-0x74,0x65,0x20,0x6f,0x66,0x20,0x43,0x6f,0x6d,0x70,0x75,0x74,0x65,0x72,0x20,0x53,
-0x63,0x69,0x65,0x6e,0x63,0x65,0x3c,0x2f,0x61,0x3e,0x20,0x62,0x75,0x74,0x20,0x6e,
-0x6f,0x77,0x20,0x69,0x73,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x62,0x65,0x69,0x6e,
-0x67,0x20,0x61,0x63,0x74,0x69,0x76,0x65,0x6c,0x79,0x20,0x64,0x65,0x76,0x65,0x6c,
-0x6f,0x70,0x65,0x64,0x20,0x62,0x79,0x20,0x61,0x20,0x74,0x65,0x61,0x6d,0x20,0x6f,
-0x66,0x20,0x64,0x65,0x76,0x65,0x6c,0x6f,0x70,0x65,0x72,0x73,0x0d,0x0a,0x09,0x20,
-0x20,0x20,0x20,0x64,0x69,0x73,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x64,0x20,0x77,
-0x6f,0x72,0x6c,0x64,0x2d,0x77,0x69,0x64,0x65,0x2e,0x20,0x53,0x69,0x6e,0x63,0x65,
-0x20,0x69,0x74,0x27,0x73,0x20,0x72,0x65,0x6c,0x65,0x61,0x73,0x65,0x2c,0x20,0x6c,
-0x77,0x49,0x50,0x20,0x68,0x61,0x73,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x73,0x70,
-0x75,0x72,0x72,0x65,0x64,0x20,0x61,0x20,0x6c,0x6f,0x74,0x20,0x6f,0x66,0x20,0x69,
-0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x20,0x61,0x6e,0x64,0x20,0x68,0x61,0x73,0x20,
-0x62,0x65,0x65,0x6e,0x20,0x70,0x6f,0x72,0x74,0x65,0x64,0x20,0x74,0x6f,0x20,0x73,
-0x65,0x76,0x65,0x72,0x61,0x6c,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x70,0x6c,0x61,
-0x74,0x66,0x6f,0x72,0x6d,0x73,0x20,0x61,0x6e,0x64,0x20,0x6f,0x70,0x65,0x72,0x61,
-0x74,0x69,0x6e,0x67,0x20,0x73,0x79,0x73,0x74,0x65,0x6d,0x73,0x2e,0x20,0x6c,0x77,
-0x49,0x50,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x65,
-0x69,0x74,0x68,0x65,0x72,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x77,0x69,0x74,0x68,
-0x20,0x6f,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x61,0x6e,0x20,0x75,
-0x6e,0x64,0x65,0x72,0x6c,0x79,0x69,0x6e,0x67,0x20,0x4f,0x53,0x2e,0x0d,0x0a,0x09,
-0x20,0x20,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x20,0x20,0x3c,0x70,0x3e,0x0d,0x0a,
-0x09,0x20,0x20,0x20,0x20,0x54,0x68,0x65,0x20,0x66,0x6f,0x63,0x75,0x73,0x20,0x6f,
-0x66,0x20,0x74,0x68,0x65,0x20,0x6c,0x77,0x49,0x50,0x20,0x54,0x43,0x50,0x2f,0x49,
-0x50,0x20,0x69,0x6d,0x70,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,
-0x20,0x69,0x73,0x20,0x74,0x6f,0x20,0x72,0x65,0x64,0x75,0x63,0x65,0x0d,0x0a,0x09,
-0x20,0x20,0x20,0x20,0x74,0x68,0x65,0x20,0x52,0x41,0x4d,0x20,0x75,0x73,0x61,0x67,
-0x65,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x73,0x74,0x69,0x6c,0x6c,0x20,0x68,0x61,
-0x76,0x69,0x6e,0x67,0x20,0x61,0x20,0x66,0x75,0x6c,0x6c,0x20,0x73,0x63,0x61,0x6c,
-0x65,0x20,0x54,0x43,0x50,0x2e,0x20,0x54,0x68,0x69,0x73,0x0d,0x0a,0x09,0x20,0x20,
-0x20,0x20,0x6d,0x61,0x6b,0x65,0x73,0x20,0x6c,0x77,0x49,0x50,0x20,0x73,0x75,0x69,
-0x74,0x61,0x62,0x6c,0x65,0x20,0x66,0x6f,0x72,0x20,0x75,0x73,0x65,0x20,0x69,0x6e,
-0x20,0x65,0x6d,0x62,0x65,0x64,0x64,0x65,0x64,0x20,0x73,0x79,0x73,0x74,0x65,0x6d,
-0x73,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x65,0x6e,0x73,0x0d,0x0a,0x09,0x20,0x20,
-0x20,0x20,0x6f,0x66,0x20,0x6b,0x69,0x6c,0x6f,0x62,0x79,0x74,0x65,0x73,0x20,0x6f,
-0x66,0x20,0x66,0x72,0x65,0x65,0x20,0x52,0x41,0x4d,0x20,0x61,0x6e,0x64,0x20,0x72,
-0x6f,0x6f,0x6d,0x20,0x66,0x6f,0x72,0x20,0x61,0x72,0x6f,0x75,0x6e,0x64,0x20,0x34,
-0x30,0x20,0x6b,0x69,0x6c,0x6f,0x62,0x79,0x74,0x65,0x73,0x0d,0x0a,0x09,0x20,0x20,
-0x20,0x20,0x6f,0x66,0x20,0x63,0x6f,0x64,0x65,0x20,0x52,0x4f,0x4d,0x2e,0x0d,0x0a,
-0x09,0x20,0x20,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,0x20,0x20,0x3c,0x70,0x3e,0x0d,
-0x0a,0x09,0x20,0x20,0x20,0x20,0x4d,0x6f,0x72,0x65,0x20,0x69,0x6e,0x66,0x6f,0x72,
-0x6d,0x61,0x74,0x69,0x6f,0x6e,0x20,0x61,0x62,0x6f,0x75,0x74,0x20,0x6c,0x77,0x49,
-0x50,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x61,
-0x74,0x20,0x74,0x68,0x65,0x20,0x6c,0x77,0x49,0x50,0x0d,0x0a,0x09,0x20,0x20,0x20,
-0x20,0x68,0x6f,0x6d,0x65,0x70,0x61,0x67,0x65,0x20,0x61,0x74,0x20,0x3c,0x61,0x0d,
-0x0a,0x09,0x20,0x20,0x20,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x68,0x74,0x74,0x70,
-0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,
-0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,
-0x6c,0x77,0x69,0x70,0x2f,0x22,0x3e,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,
-0x76,0x61,0x6e,0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,
-0x67,0x2f,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x2f,
-0x3c,0x2f,0x61,0x3e,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x6f,0x72,0x20,0x61,0x74,
-0x20,0x74,0x68,0x65,0x20,0x6c,0x77,0x49,0x50,0x20,0x77,0x69,0x6b,0x69,0x20,0x61,
-0x74,0x20,0x3c,0x61,0x0d,0x0a,0x09,0x20,0x20,0x20,0x20,0x68,0x72,0x65,0x66,0x3d,
-0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x6c,0x77,0x69,0x70,0x2e,0x77,0x69,0x6b,
-0x69,0x61,0x2e,0x63,0x6f,0x6d,0x2f,0x22,0x3e,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-0x6c,0x77,0x69,0x70,0x2e,0x77,0x69,0x6b,0x69,0x61,0x2e,0x63,0x6f,0x6d,0x2f,0x3c,
-0x2f,0x61,0x3e,0x2e,0x0d,0x0a,0x09,0x20,0x20,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x09,
-0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x0d,0x0a,0x09,0x20,0x20,0x26,0x6e,
-0x62,0x73,0x70,0x3b,0x0d,0x0a,0x09,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,
-0x3e,0x0d,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,
-0x6d,0x6c,0x3e,0x0d,0x0a,0x0d,0x0a,};
-
-
-
-const struct fsdata_file file__img_sics_gif[] = { {
-file_NULL,
-data__img_sics_gif,
-data__img_sics_gif + 16,
-sizeof(data__img_sics_gif) - 16,
-FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-}};
 
 const struct fsdata_file file__404_html[] = { {
-file__img_sics_gif,
+file_NULL,
 data__404_html,
 data__404_html + 12,
 sizeof(data__404_html) - 12,
@@ -332,6 +243,28 @@ sizeof(data__index_html) - 12,
 FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
 }};
 
-#define FS_ROOT file__index_html
+const struct fsdata_file file__img_sics_gif[] = { {
+file__index_html,
+data__img_sics_gif,
+data__img_sics_gif + 16,
+sizeof(data__img_sics_gif) - 16,
+FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+}};
+
+#define FS_ROOT file__img_sics_gif
 #define FS_NUMFILES 3
 
+/* File name hash index, see fs_name_hash() */
+static const struct fsdata_index_entry fs_index[] = {
+{ 0x00000000, file_NULL },
+{ 0xbdd71e79, file__404_html },
+{ 0x457c5a71, file__index_html },
+{ 0x00000000, file_NULL },
+{ 0x369ddf54, file__img_sics_gif },
+{ 0x00000000, file_NULL },
+{ 0x00000000, file_NULL },
+{ 0x00000000, file_NULL },
+};
+
+#define FS_INDEX fs_index
+#define FS_INDEX_SIZE 8
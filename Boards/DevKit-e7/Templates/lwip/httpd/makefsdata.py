@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+#
+# Generate fsdata.c for the LWIP httpd demo from a directory of web files.
+#
+# Copyright (C) 2024 ALIF SEMICONDUCTOR
+#
+# Output is compatible with fsdata.c from the lwIP makefsdata tool, with two
+# additions:
+#  - Text assets are stored gzip compressed, with "Content-Encoding: gzip" in
+#    their prebuilt HTTP header, when that makes them smaller.
+#  - FS_INDEX, an open addressing hash table over the file names, lets
+#    fs_open() find a file without walking the FS_ROOT list.
+#
+# Usage: makefsdata.py [-o fsdata.c] [--no-gzip] [fs directory]
+
+import argparse
+import gzip
+import os
+import sys
+
+SERVER = "lwIP/2.0.3d (http://savannah.nongnu.org/projects/lwip)"
+
+CONTENT_TYPES = {
+    "html": "text/html",
+    "htm": "text/html",
+    "shtml": "text/html",
+    "shtm": "text/html",
+    "ssi": "text/html",
+    "gif": "image/gif",
+    "png": "image/png",
+    "jpg": "image/jpeg",
+    "bmp": "image/bmp",
+    "ico": "image/x-icon",
+    "class": "application/octet-stream",
+    "cls": "application/octet-stream",
+    "js": "application/javascript",
+    "ram": "application/javascript",
+    "css": "text/css",
+    "swf": "application/x-shockwave-flash",
+    "xml": "text/xml",
+    "xsl": "text/xml",
+    "pdf": "application/pdf",
+    "json": "application/json",
+    "csv": "text/csv",
+    "tsv": "text/tsv",
+    "svg": "image/svg+xml",
+    "txt": "text/plain",
+}
+
+# Already compressed formats gain nothing from gzip
+COMPRESSIBLE = ("html", "htm", "js", "css", "xml", "xsl", "json", "csv",
+                "tsv", "svg", "txt")
+
+# SSI files are parsed by httpd and must stay plain
+SSI = ("shtml", "shtm", "ssi")
+
+
+def fnv1a(data):
+    """32-bit FNV-1a, must match fs_name_hash() in fs.c."""
+    h = 0x811c9dc5
+    for b in data:
+        h = ((h ^ b) * 0x01000193) & 0xffffffff
+    return h
+
+
+def c_ident(name):
+    return "".join(c if c.isalnum() else "_" for c in name)
+
+
+def hex_lines(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("".join("0x%02x," % b for b in data[i:i + 16]))
+    return "\n".join(lines)
+
+
+def c_comment(text):
+    return text.replace("\r", "\\r").replace("\n", "\\n").replace("*/", "*\\/")
+
+
+def build_file(root, path, use_gzip):
+    name = "/" + os.path.relpath(path, root).replace(os.sep, "/")
+    ext = name.rsplit(".", 1)[-1].lower() if "." in name else ""
+
+    with open(path, "rb") as f:
+        body = f.read()
+
+    encoding = None
+    if use_gzip and ext in COMPRESSIBLE and ext not in SSI:
+        packed = gzip.compress(body, 9, mtime=0)
+        if len(packed) < len(body):
+            body, encoding = packed, "gzip"
+
+    if name.startswith("/404"):
+        status = "HTTP/1.0 404 File not found\r\n"
+    else:
+        status = "HTTP/1.0 200 OK\r\n"
+
+    headers = [status, "Server: " + SERVER + "\r\n",
+               "Content-Length: %d\r\n" % len(body)]
+    if encoding:
+        headers.append("Content-Encoding: %s\r\n" % encoding)
+    headers.append("Content-Type: %s\r\n\r\n" %
+                   CONTENT_TYPES.get(ext, "text/plain"))
+
+    # Name is NUL terminated and padded so that the header is word aligned
+    raw_name = name.encode() + b"\0"
+    raw_name += b"\0" * (-len(raw_name) % 4)
+
+    return {
+        "name": name,
+        "ident": c_ident(name),
+        "raw_name": raw_name,
+        "headers": headers,
+        "body": body,
+        "encoding": encoding,
+        "ssi": ext in SSI,
+    }
+
+
+def build_index(files):
+    size = 1
+    while size < 2 * len(files):
+        size *= 2
+
+    slots = [None] * size
+    for f in files:
+        h = fnv1a(f["name"].encode())
+        i = h & (size - 1)
+        while slots[i] is not None:
+            i = (i + 1) & (size - 1)
+        slots[i] = (h, f)
+
+    return slots
+
+
+def emit(files, out):
+    w = out.write
+
+    w("#include \"lwip/apps/fs.h\"\n")
+    w("#include \"lwip/def.h\"\n\n\n")
+    w("#define file_NULL (struct fsdata_file *) NULL\n\n\n")
+    w("#ifndef FS_FILE_FLAGS_HEADER_INCLUDED\n"
+      "#define FS_FILE_FLAGS_HEADER_INCLUDED 1\n#endif\n")
+    w("#ifndef FS_FILE_FLAGS_HEADER_PERSISTENT\n"
+      "#define FS_FILE_FLAGS_HEADER_PERSISTENT 0\n#endif\n")
+    w("/* FSDATA_FILE_ALIGNMENT: 0=off, 1=by variable, 2=by include */\n")
+    w("#ifndef FSDATA_FILE_ALIGNMENT\n#define FSDATA_FILE_ALIGNMENT 0\n#endif\n")
+    w("#ifndef FSDATA_ALIGN_PRE\n#define FSDATA_ALIGN_PRE\n#endif\n")
+    w("#ifndef FSDATA_ALIGN_POST\n#define FSDATA_ALIGN_POST\n#endif\n")
+    w("#if FSDATA_FILE_ALIGNMENT==2\n#include \"fsdata_alignment.h\"\n#endif\n")
+
+    for n, f in enumerate(files):
+        w("#if FSDATA_FILE_ALIGNMENT==1\n")
+        w("static const unsigned int dummy_align_%s = %d;\n" % (f["ident"], n))
+        w("#endif\n")
+        w("static const unsigned char FSDATA_ALIGN_PRE data_%s[] FSDATA_ALIGN_POST = {\n"
+          % f["ident"])
+        w("/* %s (%d chars) */\n" % (f["name"], len(f["name"]) + 1))
+        w(hex_lines(f["raw_name"]) + "\n\n")
+        w("/* HTTP header */\n")
+        for h in f["headers"]:
+            w("/* \"%s\" (%d bytes) */\n" % (c_comment(h), len(h)))
+            w(hex_lines(h.encode()) + "\n")
+        if f["encoding"]:
+            w("/* %s compressed file data (%d bytes) */\n"
+              % (f["encoding"], len(f["body"])))
+        else:
+            w("/* raw file data (%d bytes) */\n" % len(f["body"]))
+        w(hex_lines(f["body"]) + "\n};\n\n")
+
+    w("\n\n")
+
+    prev = "file_NULL"
+    for f in files:
+        flags = "FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT"
+        if f["ssi"]:
+            flags += " | FS_FILE_FLAGS_SSI"
+        w("const struct fsdata_file file_%s[] = { {\n" % f["ident"])
+        w("%s,\n" % prev)
+        w("data_%s,\n" % f["ident"])
+        w("data_%s + %d,\n" % (f["ident"], len(f["raw_name"])))
+        w("sizeof(data_%s) - %d,\n" % (f["ident"], len(f["raw_name"])))
+        w("%s,\n" % flags)
+        w("}};\n\n")
+        prev = "file_" + f["ident"]
+
+    w("#define FS_ROOT %s\n" % prev)
+    w("#define FS_NUMFILES %d\n\n" % len(files))
+
+    slots = build_index(files)
+    w("/* File name hash index, see fs_name_hash() */\n")
+    w("static const struct fsdata_index_entry fs_index[] = {\n")
+    for slot in slots:
+        if slot is None:
+            w("{ 0x00000000, file_NULL },\n")
+        else:
+            w("{ 0x%08x, file_%s },\n" % (slot[0], slot[1]["ident"]))
+    w("};\n\n")
+    w("#define FS_INDEX fs_index\n")
+    w("#define FS_INDEX_SIZE %d\n" % len(slots))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Generate fsdata.c for the LWIP httpd demo.")
+    parser.add_argument("fsdir", nargs="?", default="fs",
+                        help="directory holding the web files (default: fs)")
+    parser.add_argument("-o", "--output", default="fsdata.c",
+                        help="output file (default: fsdata.c)")
+    parser.add_argument("--no-gzip", action="store_true",
+                        help="store all files uncompressed")
+    args = parser.parse_args()
+
+    if not os.path.isdir(args.fsdir):
+        sys.exit("%s: not a directory" % args.fsdir)
+
+    paths = []
+    for dirpath, dirnames, filenames in os.walk(args.fsdir):
+        dirnames.sort()
+        for name in sorted(filenames):
+            paths.append(os.path.join(dirpath, name))
+
+    if not paths:
+        sys.exit("%s: no files" % args.fsdir)
+
+    files = [build_file(args.fsdir, p, not args.no_gzip) for p in paths]
+
+    with open(args.output, "w", newline="\n") as out:
+        emit(files, out)
+
+    for f in files:
+        print("%-40s %7d bytes%s" % (f["name"], len(f["body"]),
+              " (gzip)" if f["encoding"] else ""))
+
+
+if __name__ == "__main__":
+    main()
@@ -9339,6 +9339,28 @@
 // <i> Default: 0
 #define RTE_ETH_MAC_IRQ_PRIORITY                    0
 
+// <o> Rx DMA descriptor count <4-1024>
+// <i> Defines the number of Rx DMA descriptors, each with a 1536 byte buffer
+// <i> Default: 8
+#define RTE_ETH_MAC_RX_DESC_COUNT                   8
+
+// <o> Tx DMA descriptor count <4-1024>
+// <i> Defines the number of Tx DMA descriptors, each with a 1536 byte buffer
+// <i> Default: 8
+#define RTE_ETH_MAC_TX_DESC_COUNT                   8
+
+// <o> Rx interrupt coalescing frame count <1-255>
+// <i> Defines the number of received frames per Rx interrupt
+// <i> Values above 1 need a non-zero Rx interrupt watchdog timeout
+// <i> Default: 1
+#define RTE_ETH_MAC_RX_COALESCE_FRAMES              1
+
+// <o> Rx interrupt watchdog timeout <0-255>
+// <i> Defines the Rx interrupt delay after a frame in units of 256 AXI clock cycles
+// <i> 0 disables the Rx interrupt watchdog
+// <i> Default: 0
+#define RTE_ETH_MAC_RX_COALESCE_TIMEOUT             0
+
 #endif
 // </e> ETH (Ethernet MAC) [Driver_ETH_MAC0]
 // </h> ETH (Ethernet MAC)
@@ -0,0 +1,13 @@
+/**************************************************************************//**
+ * @file     RTE_Components.h
+ * @brief    Host (Linux) build of the drivers in drivers/host: points
+ *           CMSIS_device_header at the host shim instead of the device
+ *           header. Never put this directory on a target include path.
+ ******************************************************************************/
+
+#ifndef RTE_COMPONENTS_H
+#define RTE_COMPONENTS_H
+
+#define CMSIS_device_header "host_device.h"
+
+#endif /* RTE_COMPONENTS_H */
@@ -0,0 +1,21 @@
+/**************************************************************************//**
+ * @file     host_device.h
+ * @brief    Host (Linux) stand-in for the device header: the CMSIS register
+ *           qualifiers and the system utilities the drivers use.
+ ******************************************************************************/
+
+#ifndef HOST_DEVICE_H
+#define HOST_DEVICE_H
+
+#include <stdint.h>
+
+#define __I     volatile const
+#define __O     volatile
+#define __IO    volatile
+#define __IM    volatile const
+#define __OM    volatile
+#define __IOM   volatile
+
+int32_t sys_busy_loop_us(uint32_t delay_us);
+
+#endif /* HOST_DEVICE_H */
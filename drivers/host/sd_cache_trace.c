@@ -0,0 +1,429 @@
+/**************************************************************************//**
+ * @file     sd_cache_trace.c
+ * @brief    Host (Linux) harness of the SD sector cache (sd_cache.c): replays
+ *           a FatFs disk_read / disk_write trace on a block device or an
+ *           image file and prints the cache hit rates.
+ *
+ *           The SD driver underneath is modelled by sd_submit(), backed by
+ *           the device opened read-only: sectors written by the cache go to
+ *           an in-memory overlay, so a real card is never modified. Requests
+ *           complete inside sd_submit(), as if the card were infinitely
+ *           fast, which keeps the hit rates independent of timing.
+ *
+ *           Every read is checked against a model of the disk kept apart
+ *           from the cache, and after the final sd_cache_flush() every
+ *           written sector is checked on the card.
+ *
+ *           Trace format, one access per line, '#' starts a comment:
+ *             R <sector> <count>    disk_read
+ *             W <sector> <count>    disk_write, with generated data
+ *             F                     disk_ioctl(CTRL_SYNC): sd_cache_flush()
+ *           Capture one on the target by printing these lines from the
+ *           FatFs diskio glue, in front of SD_Cache_Driver or SD_Driver.
+ *
+ *           The card counters are requests as submitted; the driver queue
+ *           merges back-to-back requests into fewer card commands.
+ *
+ *           Build from the repository root:
+ *
+ *             cc -O2 -Wall -no-pie -Wno-pointer-to-int-cast \
+ *                -Wno-int-to-pointer-cast -Idrivers/host/include \
+ *                -IDevice/E7/AE722F80F55D5XX -Idrivers/include \
+ *                drivers/host/sd_cache_trace.c drivers/source/sd_cache.c \
+ *                -o sd_cache_trace
+ *             ./sd_cache_trace [-l lines] [-r read_ahead] [-b bypass]
+ *                              [-e erase_blk_cnt] [-w] device [trace]
+ *
+ *           The driver keeps buffer addresses in 32 bits, like on the
+ *           target: buffers are mapped below 4GB (MAP_32BIT) and the
+ *           harness is linked without PIE for the driver's static buffer.
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <linux/fs.h>
+#include "sd_cache.h"
+
+#define SECTOR_SIZE             SDMMC_BLK_SIZE_512_Msk
+
+/* Largest access of a trace line, in sectors */
+#define TRACE_MAX_BLK_CNT       1024U
+
+/**
+ * @brief  Sector overlay, open addressing hash of sector -> 512 bytes
+ */
+typedef struct {
+    uint32_t   *sector;
+    uint8_t    *data;
+    uint32_t    size;       /* Slots, power of 2    */
+    uint32_t    used;
+} overlay_t;
+
+#define OVERLAY_EMPTY           0xFFFFFFFFU
+
+/**
+ * @brief  Card model behind sd_submit()
+ */
+typedef struct {
+    int         fd;
+    uint32_t    sectors;        /* Device size in sectors                       */
+    overlay_t   written;        /* Sectors written through the cache            */
+    uint32_t    rd_cmds;
+    uint32_t    rd_sectors;
+    uint32_t    wr_cmds;
+    uint32_t    wr_sectors;
+} card_t;
+
+static card_t card;
+
+/* What the disk holds from the trace's point of view */
+static overlay_t model;
+
+static uint32_t trace_errors;
+
+static void *alloc_low(size_t size)
+{
+    void *p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+
+    if (p == MAP_FAILED) {
+        perror("mmap");
+        exit(2);
+    }
+    return p;
+}
+
+static void overlay_init(overlay_t *ov, uint32_t size)
+{
+    ov->size   = size;
+    ov->used   = 0;
+    ov->sector = malloc(size * sizeof(uint32_t));
+    ov->data   = malloc((size_t)size * SECTOR_SIZE);
+    if ((ov->sector == NULL) || (ov->data == NULL)) {
+        fprintf(stderr, "out of memory\n");
+        exit(2);
+    }
+    memset(ov->sector, 0xFF, size * sizeof(uint32_t));
+}
+
+static uint8_t *overlay_find(const overlay_t *ov, uint32_t sector)
+{
+    uint32_t slot = (sector * 2654435761U) & (ov->size - 1U);
+
+    while (ov->sector[slot] != OVERLAY_EMPTY) {
+        if (ov->sector[slot] == sector)
+            return &ov->data[(size_t)slot * SECTOR_SIZE];
+        slot = (slot + 1U) & (ov->size - 1U);
+    }
+    return NULL;
+}
+
+static uint8_t *overlay_get(overlay_t *ov, uint32_t sector)
+{
+    uint8_t *data = overlay_find(ov, sector);
+    uint32_t slot;
+
+    if (data != NULL)
+        return data;
+
+    if ((ov->used + 1U) * 4U > ov->size * 3U) {
+        overlay_t bigger;
+
+        overlay_init(&bigger, ov->size * 2U);
+        for (slot = 0; slot < ov->size; slot++) {
+            if (ov->sector[slot] != OVERLAY_EMPTY)
+                memcpy(overlay_get(&bigger, ov->sector[slot]), &ov->data[(size_t)slot * SECTOR_SIZE], SECTOR_SIZE);
+        }
+        free(ov->sector);
+        free(ov->data);
+        *ov = bigger;
+    }
+
+    slot = (sector * 2654435761U) & (ov->size - 1U);
+    while (ov->sector[slot] != OVERLAY_EMPTY)
+        slot = (slot + 1U) & (ov->size - 1U);
+    ov->sector[slot] = sector;
+    ov->used++;
+
+    return &ov->data[(size_t)slot * SECTOR_SIZE];
+}
+
+/* Device content, ignoring the writes */
+static void device_read(uint32_t sector, uint8_t *buff)
+{
+    ssize_t n = pread(card.fd, buff, SECTOR_SIZE, (off_t)sector * SECTOR_SIZE);
+
+    if (n != (ssize_t)SECTOR_SIZE) {
+        fprintf(stderr, "read of sector %u failed\n", sector);
+        exit(2);
+    }
+}
+
+/* SD driver entries used by sd_cache.c */
+SD_DRV_STATUS sd_submit(sd_request_t *req)
+{
+    uint8_t *buff = (uint8_t *)req->buff;
+    uint32_t i;
+
+    /* same checks as the driver, plus the card size */
+    if ((req->blk_cnt == 0) || (req->blk_cnt > SD_QUEUE_MAX_BLK_CNT) ||
+        (buff == NULL) || ((uintptr_t)buff & 0x1FU) ||
+        (req->sector >= card.sectors) || (req->blk_cnt > card.sectors - req->sector)) {
+        fprintf(stderr, "bad request: sector %u count %u buffer %p\n", req->sector, req->blk_cnt, (void *)buff);
+        trace_errors++;
+        return (req->dir == SD_REQ_READ) ? SD_DRV_STATUS_RD_ERR : SD_DRV_STATUS_WR_ERR;
+    }
+
+    for (i = 0; i < req->blk_cnt; i++, buff += SECTOR_SIZE) {
+        if (req->dir == SD_REQ_WRITE) {
+            memcpy(overlay_get(&card.written, req->sector + i), buff, SECTOR_SIZE);
+        } else {
+            const uint8_t *data = overlay_find(&card.written, req->sector + i);
+            if (data != NULL)
+                memcpy(buff, data, SECTOR_SIZE);
+            else
+                device_read(req->sector + i, buff);
+        }
+    }
+
+    if (req->dir == SD_REQ_WRITE) {
+        card.wr_cmds++;
+        card.wr_sectors += req->blk_cnt;
+    } else {
+        card.rd_cmds++;
+        card.rd_sectors += req->blk_cnt;
+    }
+
+    req->status = SD_DRV_STATUS_OK;
+    if (req->complete != NULL)
+        req->complete(req);
+
+    return SD_DRV_STATUS_OK;
+}
+
+SD_DRV_STATUS sd_init(sd_param_t *param)
+{
+    (void)param;
+    return SD_DRV_STATUS_OK;
+}
+
+SD_DRV_STATUS sd_uninit(uint8_t devId)
+{
+    (void)devId;
+    return SD_DRV_STATUS_OK;
+}
+
+SD_CARD_STATE sd_state(sd_handle_t *handle)
+{
+    (void)handle;
+    return SD_CARD_STATE_TRAN;
+}
+
+int32_t sys_busy_loop_us(uint32_t delay_us)
+{
+    (void)delay_us;
+    return 0;
+}
+
+/* Data of the gen-th write of a sector, never all zeroes */
+static void trace_pattern(uint32_t sector, uint32_t gen, uint8_t *buff)
+{
+    uint32_t x = sector * 2654435761U + gen * 40503U + 1U;
+    uint32_t i;
+
+    if (x == 0U)
+        x = 1U;
+
+    for (i = 0; i < SECTOR_SIZE; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        buff[i] = (uint8_t)x;
+    }
+}
+
+static void trace_check(uint32_t sector, const uint8_t *data, const char *what, uint32_t line)
+{
+    uint8_t expect[SECTOR_SIZE];
+    const uint8_t *model_data = overlay_find(&model, sector);
+
+    if (model_data == NULL) {
+        device_read(sector, expect);
+        model_data = expect;
+    }
+    if (memcmp(data, model_data, SECTOR_SIZE) != 0) {
+        fprintf(stderr, "line %u: %s sector %u: data mismatch\n", line, what, sector);
+        trace_errors++;
+    }
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [-l lines] [-r read_ahead] [-b bypass] [-e erase_blk_cnt] [-w] device [trace]\n"
+            "  -l  cache lines (default 256)\n"
+            "  -r  sectors read ahead, 0..%u (default 8)\n"
+            "  -b  requests of this many sectors bypass the cache, 0: never (default 0)\n"
+            "  -e  write-back unit in sectors (default 8192)\n"
+            "  -w  write-back instead of write-through\n",
+            name, SD_CACHE_RA_MAX);
+    exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+    sd_cache_config_t cfg = { 0 };
+    sd_cache_stats_t stats;
+    uint64_t size = 0;
+    struct stat st;
+    FILE *trace = stdin;
+    uint8_t *buff;
+    char text[256];
+    uint32_t line = 0, reads = 0, writes = 0, flushes = 0, gen = 0;
+    uint32_t num_lines = 256, slot;
+    int opt;
+
+    cfg.read_ahead    = 8;
+    cfg.erase_blk_cnt = 8192;
+
+    while ((opt = getopt(argc, argv, "l:r:b:e:w")) != -1) {
+        switch (opt) {
+        case 'l': num_lines          = (uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'r': cfg.read_ahead     = (uint16_t)strtoul(optarg, NULL, 0); break;
+        case 'b': cfg.bypass_blk_cnt = (uint16_t)strtoul(optarg, NULL, 0); break;
+        case 'e': cfg.erase_blk_cnt  = (uint16_t)strtoul(optarg, NULL, 0); break;
+        case 'w': cfg.write_back     = 1; break;
+        default:  usage(argv[0]);
+        }
+    }
+    if ((optind >= argc) || (argc - optind > 2) || (num_lines >= SD_CACHE_LINE_NONE))
+        usage(argv[0]);
+
+    card.fd = open(argv[optind], O_RDONLY);
+    if ((card.fd < 0) || (fstat(card.fd, &st) != 0)) {
+        perror(argv[optind]);
+        return 2;
+    }
+    if (S_ISBLK(st.st_mode))
+        ioctl(card.fd, BLKGETSIZE64, &size);
+    else
+        size = (uint64_t)st.st_size;
+    card.sectors = (size / SECTOR_SIZE > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)(size / SECTOR_SIZE);
+    if (card.sectors == 0) {
+        fprintf(stderr, "%s: empty device\n", argv[optind]);
+        return 2;
+    }
+
+    if ((argc - optind == 2) && ((trace = fopen(argv[optind + 1], "r")) == NULL)) {
+        perror(argv[optind + 1]);
+        return 2;
+    }
+
+    overlay_init(&card.written, 1024);
+    overlay_init(&model, 1024);
+
+    cfg.num_lines = (uint16_t)num_lines;
+    cfg.data      = alloc_low((size_t)num_lines * SECTOR_SIZE);
+    cfg.lines     = alloc_low(num_lines * sizeof(sd_cache_line_t));
+    buff          = alloc_low(TRACE_MAX_BLK_CNT * SECTOR_SIZE);
+
+    if (sd_cache_init(&cfg) != SD_DRV_STATUS_OK) {
+        fprintf(stderr, "sd_cache_init failed, check the configuration\n");
+        return 2;
+    }
+
+    while (fgets(text, sizeof(text), trace) != NULL) {
+        unsigned long sector, count;
+        char op;
+        uint32_t i;
+
+        line++;
+        if (sscanf(text, " %c", &op) != 1 || op == '#')
+            continue;
+
+        if ((op == 'F') || (op == 'f')) {
+            if (sd_cache_flush() != SD_DRV_STATUS_OK) {
+                fprintf(stderr, "line %u: flush failed\n", line);
+                trace_errors++;
+            }
+            flushes++;
+            continue;
+        }
+
+        if ((sscanf(text, " %c %lu %lu", &op, &sector, &count) != 3) ||
+            (count == 0) || (count > TRACE_MAX_BLK_CNT) ||
+            (sector >= card.sectors) || (count > card.sectors - sector)) {
+            fprintf(stderr, "line %u: skipped: %s", line, text);
+            continue;
+        }
+
+        if ((op == 'R') || (op == 'r')) {
+            if (sd_cache_read((uint32_t)sector, (uint32_t)count, buff) != SD_DRV_STATUS_OK) {
+                fprintf(stderr, "line %u: read failed\n", line);
+                trace_errors++;
+                continue;
+            }
+            for (i = 0; i < count; i++)
+                trace_check((uint32_t)sector + i, buff + i * SECTOR_SIZE, "read", line);
+            reads++;
+        } else if ((op == 'W') || (op == 'w')) {
+            gen++;
+            for (i = 0; i < count; i++)
+                trace_pattern((uint32_t)sector + i, gen, buff + i * SECTOR_SIZE);
+            if (sd_cache_write((uint32_t)sector, (uint32_t)count, buff) != SD_DRV_STATUS_OK) {
+                fprintf(stderr, "line %u: write failed\n", line);
+                trace_errors++;
+                continue;
+            }
+            for (i = 0; i < count; i++)
+                memcpy(overlay_get(&model, (uint32_t)sector + i), buff + i * SECTOR_SIZE, SECTOR_SIZE);
+            writes++;
+        } else {
+            fprintf(stderr, "line %u: skipped: %s", line, text);
+        }
+    }
+
+    if (sd_cache_flush() != SD_DRV_STATUS_OK) {
+        fprintf(stderr, "final flush failed\n");
+        trace_errors++;
+    }
+
+    /* Everything written must have reached the card */
+    for (slot = 0; slot < model.size; slot++) {
+        const uint8_t *data;
+
+        if (model.sector[slot] == OVERLAY_EMPTY)
+            continue;
+        data = overlay_find(&card.written, model.sector[slot]);
+        if ((data == NULL) || (memcmp(data, &model.data[(size_t)slot * SECTOR_SIZE], SECTOR_SIZE) != 0)) {
+            fprintf(stderr, "sector %u: written data not on the card\n", model.sector[slot]);
+            trace_errors++;
+        }
+    }
+
+    sd_cache_get_stats(&stats);
+
+    printf("trace:    %u reads, %u writes, %u flushes\n", reads, writes, flushes);
+    printf("cache:    %u lines, read-ahead %u, bypass %u, %s, erase unit %u\n",
+           num_lines, cfg.read_ahead, cfg.bypass_blk_cnt,
+           cfg.write_back ? "write-back" : "write-through", cfg.erase_blk_cnt);
+    printf("reads:    %u hits, %u misses, hit rate %.1f%%\n", stats.read_hits, stats.read_misses,
+           (stats.read_hits + stats.read_misses) ?
+           100.0 * stats.read_hits / (stats.read_hits + stats.read_misses) : 0.0);
+    printf("ahead:    %u sectors prefetched, %u used (%.1f%%)\n", stats.ra_sectors, stats.ra_hits,
+           stats.ra_sectors ? 100.0 * stats.ra_hits / stats.ra_sectors : 0.0);
+    printf("writes:   %u sectors, %u card write commands\n", stats.writes, stats.card_writes);
+    printf("bypass:   %u sectors\n", stats.bypass);
+    printf("card:     %u read requests (%u sectors), %u write requests (%u sectors)\n",
+           card.rd_cmds, card.rd_sectors, card.wr_cmds, card.wr_sectors);
+    printf("check:    %s (%u errors)\n", trace_errors ? "FAILED" : "data consistent", trace_errors);
+
+    return trace_errors ? 1 : 0;
+}
@@ -65,6 +65,8 @@ typedef struct {
 #define ADC_EXTERNAL_TRIGGER_MAX_VAL             (0x3F)        /* ADC External trigger max value */
 
 /********Interrupt mask macro*******/
+#define ADC_INTR_DONE0_POS                       (0)                                    /* Interrupt done0 mask position          */
+#define ADC_INTR_DONE0_MSK                       (1 << ADC_INTR_DONE0_POS)              /* Interrupt done0 mask                   */
 #define ADC_INTR_CMPA_POS                        (2)                                    /* Interrupt comparator A mask position   */
 #define ADC_INTR_CMPA_MSK                        (1 << ADC_INTR_CMPA_POS)               /* Interrupt comparator A mask            */
 #define ADC_INTR_CMPB_POS                        (3)                                    /* Interrupt comparator B mask position   */
@@ -147,8 +149,58 @@ typedef enum _ADC_CONV_STAT{
   ADC_CONV_STAT_CMP_THLD_BELOW_B     = (1U << 4),  /* ADC Conversion status comparator threshold below B       */
   ADC_CONV_STAT_CMP_THLD_BETWEEN_A_B = (1U << 5),  /* ADC Conversion status comparator threshold between A & B */
   ADC_CONV_STAT_CMP_THLD_OUTSIDE_A_B = (1U << 6),  /* ADC Conversion status comparator threshold outside A & B */
+  ADC_CONV_STAT_STREAM_HALF          = (1U << 7),  /* ADC Conversion status stream first half filled           */
+  ADC_CONV_STAT_STREAM_FULL          = (1U << 8),  /* ADC Conversion status stream second half filled          */
+  ADC_CONV_STAT_SCAN_COMPLETE        = (1U << 9),  /* ADC Conversion status scan group vector updated          */
+  ADC_CONV_STAT_CAPTURE_COMPLETE     = (1U << 10), /* ADC Conversion status capture window complete            */
 } ADC_CONV_STAT;
 
+/****Stream Macros****/
+#define ADC_STREAM_CHANNEL_Pos                   (28)                                   /* Stream entry channel position */
+#define ADC_STREAM_VALUE_Msk                     ((1UL << ADC_STREAM_CHANNEL_Pos) - 1)  /* Stream entry value mask       */
+
+/* Structure to store the stream (continuous capture) info */
+typedef struct adc_stream{
+  uint32_t                        *buf;                   /* sample buffer                  */
+  uint32_t                        num;                    /* buffer entries, even           */
+  volatile uint32_t               idx;                    /* next entry                     */
+  volatile uint8_t                owned[2];               /* half owned by the application  */
+  volatile uint32_t               samples;                /* samples stored                 */
+  volatile uint32_t               overruns;               /* samples dropped                */
+}adc_stream_t;
+
+/**
+ * enum ADC_CAPTURE_STATE.
+ * State of a triggered capture.
+ */
+typedef enum _ADC_CAPTURE_STATE{
+    ADC_CAPTURE_STATE_ARMED,             /* ADC CAPTURE filling the pre-trigger buffer */
+    ADC_CAPTURE_STATE_TRIGGERED,         /* ADC CAPTURE taking post-trigger samples    */
+    ADC_CAPTURE_STATE_DONE               /* ADC CAPTURE window frozen                  */
+}ADC_CAPTURE_STATE;
+
+/* Structure to store the triggered capture info */
+typedef struct adc_capture{
+  uint32_t                        *buf;                   /* capture buffer                 */
+  uint32_t                        num;                    /* buffer entries                 */
+  uint32_t                        post;                   /* samples after the trigger      */
+  uint32_t                        trigger_mask;           /* ADC_CONV_STAT_CMP_THLD_x       */
+  volatile uint32_t               idx;                    /* next entry                     */
+  volatile uint32_t               filled;                 /* entries written, up to num     */
+  volatile uint32_t               remaining;              /* post-trigger samples left      */
+  volatile uint32_t               trigger_idx;            /* entry of the trigger sample    */
+  volatile ADC_CAPTURE_STATE      state;                  /* capture state                  */
+}adc_capture_t;
+
+/* Structure to store the scan group info */
+typedef struct adc_scan{
+  uint32_t                        channels;               /* channel mask                   */
+  uint32_t                        *values;                /* one value per channel          */
+  const volatile uint32_t         *timestamp_src;         /* counter read per scan, or NULL */
+  volatile uint32_t               timestamp;              /* timestamp of the last scan     */
+  volatile uint32_t               count;                  /* scans completed                */
+}adc_scan_t;
+
 /* Structure to store the conversion info */
 typedef struct conv_info{
   const uint32_t                  user_input;             /* user channel input             */
@@ -158,6 +210,9 @@ typedef struct conv_info{
   volatile ADC_CONV_STAT          status;                 /* Conversion status              */
   volatile ADC_CONV_MODE          mode;                   /* Conversion status control      */
   volatile uint8_t                read_channel;           /* Store channel                  */
+  adc_stream_t                    *stream;                /* continuous capture, or NULL    */
+  adc_scan_t                      *scan;                  /* scan group, or NULL            */
+  adc_capture_t                   *capture;               /* triggered capture, or NULL     */
 }conv_info_t;
 
 /**
@@ -329,6 +384,17 @@ static inline void adc_unmask_interrupt(ADC_Type *adc)
     adc->ADC_INTERRUPT_MASK = 0x0;
 }
 
+/*
+ * @func         : void adc_mask_done0_interrupt(ADC_Type *adc)
+ * @brief        : Disable the per-sample (avg sample ready) interrupt
+ * @parameter[1] : adc  : Pointer to the ADC register map
+ * @return       : NONE
+*/
+static inline void adc_mask_done0_interrupt(ADC_Type *adc)
+{
+    adc->ADC_INTERRUPT_MASK |= ADC_INTR_DONE0_MSK;
+}
+
 /*
  * @func         : void adc_mask_interrupt(ADC_Type *adc)
  * @brief        : Disable the interrupts
@@ -442,6 +508,109 @@ static inline void adc_set_multi_ch_scan_mode(ADC_Type *adc, conv_info_t *conv_i
     conv_info->sequencer_ctrl_status = ADC_SCAN_MODE_MULTI_CH;
 }
 
+/*
+ * @func         : void adc_stream_init(adc_stream_t *stream, uint32_t *buf, uint32_t num)
+ * @brief        : Set up a stream buffer, both halves owned by the driver
+ * @parameter[1] : stream : Pointer to the adc_stream_t structure
+ * @parameter[2] : buf    : sample buffer
+ * @parameter[3] : num    : number of entries, even
+ * @return       : NONE
+ */
+static inline void adc_stream_init(adc_stream_t *stream, uint32_t *buf, uint32_t num)
+{
+    stream->buf      = buf;
+    stream->num      = num;
+    stream->idx      = 0;
+    stream->owned[0] = 0;
+    stream->owned[1] = 0;
+    stream->samples  = 0;
+    stream->overruns = 0;
+}
+
+/*
+ * @func         : void adc_stream_release(adc_stream_t *stream, uint32_t half)
+ * @brief        : Hand a filled half back to the driver
+ * @parameter[1] : stream : Pointer to the adc_stream_t structure
+ * @parameter[2] : half   : 0 for the first half, 1 for the second
+ * @return       : NONE
+ */
+static inline void adc_stream_release(adc_stream_t *stream, uint32_t half)
+{
+    /* byte store, no read-modify-write against the IRQ */
+    stream->owned[half] = 0;
+}
+
+/*
+ * @func         : void adc_scan_read(ADC_Type *adc, adc_scan_t *scan)
+ * @brief        : Copy the samples of the scan group channels, in ascending
+ *                 channel order, and take the timestamp
+ * @parameter[1] : adc  : Pointer to the ADC register map
+ * @parameter[2] : scan : Pointer to the adc_scan_t structure
+ * @return       : NONE
+ */
+static inline void adc_scan_read(ADC_Type *adc, adc_scan_t *scan)
+{
+    uint32_t mask    = scan->channels;
+    uint32_t *values = scan->values;
+    uint32_t channel;
+
+    if (scan->timestamp_src)
+        scan->timestamp = *scan->timestamp_src;
+
+    for (channel = 0; mask; channel++, mask >>= 1)
+    {
+        if (mask & 1U)
+            *values++ = adc->ADC_SAMPLE_REG_[channel];
+    }
+
+    scan->count++;
+}
+
+/*
+ * @func         : void adc_capture_arm(adc_capture_t *capture)
+ * @brief        : Start filling the pre-trigger buffer, the state is set
+ *                 last so that the IRQ sees a clean buffer
+ * @parameter[1] : capture : Pointer to the adc_capture_t structure
+ * @return       : NONE
+ */
+static inline void adc_capture_arm(adc_capture_t *capture)
+{
+    capture->idx         = 0;
+    capture->filled      = 0;
+    capture->remaining   = 0;
+    capture->trigger_idx = 0;
+    capture->state       = ADC_CAPTURE_STATE_ARMED;
+}
+
+/**
+ * @fn       : void adc_capture_trigger(adc_capture_t *capture, uint32_t status)
+ * @brief    : Trigger an armed capture on a comparator condition.
+ * @param[1] : capture : Pointer to the adc_capture_t structure
+ * @param[2] : status  : comparator status, ADC_CONV_STAT_CMP_THLD_x
+ * @return   : none
+*/
+void adc_capture_trigger(adc_capture_t *capture, uint32_t status);
+
+/**
+ * @fn       : uint32_t adc_capture_put(adc_capture_t *capture, uint32_t channel, uint32_t value)
+ * @brief    : Store a sample tagged with its channel in the capture buffer.
+ * @param[1] : capture : Pointer to the adc_capture_t structure
+ * @param[2] : channel : channel of the sample
+ * @param[3] : value   : sample value
+ * @return   : ADC_CONV_STAT_CAPTURE_COMPLETE when the window is complete, else 0
+*/
+uint32_t adc_capture_put(adc_capture_t *capture, uint32_t channel, uint32_t value);
+
+/**
+ * @fn       : uint32_t adc_stream_put(adc_stream_t *stream, uint32_t channel, uint32_t value)
+ * @brief    : Store a sample tagged with its channel in the stream buffer.
+ * @param[1] : stream  : Pointer to the adc_stream_t structure
+ * @param[2] : channel : channel of the sample
+ * @param[3] : value   : sample value
+ * @return   : ADC_CONV_STAT_STREAM_HALF/FULL when a half got filled, else 0
+*/
+uint32_t adc_stream_put(adc_stream_t *stream, uint32_t channel, uint32_t value);
+
 /**
  * @fn       : void adc_irq_handler(ADC_Type *adc, conv_info_t *conversion)
  * @brief    : Handle DONE0 (avg sample ready)interrupts for the ADC instance.
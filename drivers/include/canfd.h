@@ -571,6 +571,17 @@ static inline void canfd_counter_clear(CANFD_CNT_Type* canfd_cntr)
     canfd_cntr->CANFD_CNTR_CTRL = CANFD_CNTR_CTRL_CNTR_CLEAR;
 }
 
+/**
+  \fn          static inline uint32_t canfd_counter_get(CANFD_CNT_Type* canfd_cntr)
+  \brief       Reads the CANFD timer counter
+  \param[in]   canfd_cntr : Pointer to the CANFD counter map
+  \return      Counter value
+*/
+static inline uint32_t canfd_counter_get(CANFD_CNT_Type* canfd_cntr)
+{
+    return canfd_cntr->CANFD_CNTR_LOW;
+}
+
 /**
   \fn          static inline CANFD_BUS_STATUS canfd_get_bus_status(CANFD_Type* canfd)
   \brief       Fetches the current bus status
@@ -613,6 +624,42 @@ static inline void canfd_select_tx_buf(CANFD_Type* canfd,
     }
 }
 
+/**
+  \fn          static inline void canfd_start_tx(CANFD_Type* canfd,
+  \                                            const uint8_t buf_type)
+  \brief       Starts the transmission of the loaded buffer
+  \param[in]   canfd    : Pointer to the CANFD register map
+  \param[in]   buf_type : Tx Buffer type
+  \return      None
+*/
+static inline void canfd_start_tx(CANFD_Type* canfd, const uint8_t buf_type)
+{
+    if(buf_type != CANFD_BUF_TYPE_PRIMARY)
+    {
+        /* Enables the tx of all frames in sec buf */
+        canfd->CANFD_TCMD |= CANFD_TCMD_TSALL;
+    }
+    else
+    {
+        /* Enables primary buffer transmission */
+        canfd->CANFD_TCMD |= CANFD_TCMD_TPE;
+    }
+}
+
+/**
+  \fn          static inline bool canfd_tx_complete(CANFD_Type* canfd,
+  \                                               const uint8_t buf_type)
+  \brief       Returns the pending Tx complete flag of a buffer
+  \param[in]   canfd    : Pointer to the CANFD register map
+  \param[in]   buf_type : Tx Buffer type
+  \return      Tx complete flag
+*/
+static inline bool canfd_tx_complete(CANFD_Type* canfd, const uint8_t buf_type)
+{
+    return ((canfd->CANFD_RTIF & ((buf_type != CANFD_BUF_TYPE_PRIMARY) ?
+                                  CANFD_RTIF_TSIF : CANFD_RTIF_TPIF)) != 0);
+}
+
 /**
   \fn          static inline bool canfd_ptb_tx_active(CANFD_Type* canfd)
   \brief       Fetches the Primary Trasmit buffer Tx status
@@ -1191,6 +1238,22 @@ CANFD_MSG_ERROR canfd_get_last_error_code(CANFD_Type* canfd);
 void canfd_send(CANFD_Type* canfd, const canfd_tx_info_t tx_header,
                 const uint8_t *data, const uint8_t size);
 
+/**
+  \fn          void canfd_load_tx_msg(CANFD_Type* canfd,
+  \                                  const canfd_tx_info_t tx_header,
+  \                                  const uint8_t *data,
+  \                                  const uint8_t size)
+  \brief       Loads the message into the selected Tx buffer without
+  \            starting the transmission
+  \param[in]   canfd      : Pointer to the CANFD register map
+  \param[in]   tx_header  : Header of tx message
+  \param[in]   data       : Message payload
+  \param[in]   size       : payload size
+  \return      none
+*/
+void canfd_load_tx_msg(CANFD_Type* canfd, const canfd_tx_info_t tx_header,
+                       const uint8_t *data, const uint8_t size);
+
 /**
   \fn          void canfd_receive(CANFD_Type* canfd,
   \                               canfd_data_transfer_t *dest_data))
@@ -1226,6 +1289,29 @@ void canfd_send_blocking(CANFD_Type* canfd, const canfd_tx_info_t tx_header,
 */
 void canfd_receive_blocking(CANFD_Type* canfd, canfd_transfer_t *dest_data);
 
+/**
+  \fn          void canfd_get_rx_header(CANFD_Type* canfd,
+  \                                    canfd_rx_info_t *rx_header)
+  \brief       Fetches the header and timestamp of the msg in Rx buffer
+  \param[in]   canfd      : Pointer to the CANFD register map
+  \param[in]   rx_header  : Destination header
+  \return      none
+*/
+void canfd_get_rx_header(CANFD_Type* canfd, canfd_rx_info_t *rx_header);
+
+/**
+  \fn          void canfd_read_rx_data(CANFD_Type* canfd,
+  \                                   uint32_t *data,
+  \                                   const uint8_t size)
+  \brief       Copies the payload of the msg in Rx buffer word wise
+  \            and releases the Rx buffer slot
+  \param[in]   canfd  : Pointer to the CANFD register map
+  \param[in]   data   : Destination buffer, word aligned
+  \param[in]   size   : payload size, 0 to drop the msg
+  \return      none
+*/
+void canfd_read_rx_data(CANFD_Type* canfd, uint32_t *data, const uint8_t size);
+
 /**
   \fn          void canfd_clear_interrupt(CANFD_Type* canfd, const uint32_t event)
   \brief       Clears the interrupt
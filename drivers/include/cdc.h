@@ -314,6 +314,36 @@ static inline void cdc_set_backgnd_color (CDC_Type *const cdc, const CDC_SHADOW_
     cdc->CDC_SRCTRL = (1UL << sh_rld);
 }
 
+/**
+ * @fn      static inline void cdc_global_shadow_reload (CDC_Type *const cdc, const CDC_SHADOW_RELOAD sh_rld)
+ * @brief   Trigger the global shadow register reload.
+ * @param   cdc     Pointer to the cdc register map structure. See {@ref CDC_Type} for details.
+ * @param   sh_rld  The shadow register update method. See {@ref CDC_SHADOW_RELOAD} for details.
+ * @retval  none.
+ */
+static inline void cdc_global_shadow_reload (CDC_Type *const cdc, const CDC_SHADOW_RELOAD sh_rld)
+{
+    cdc->CDC_SRCTRL = (1UL << sh_rld);
+}
+
+/**
+ * @fn      static inline void cdc_set_layer_fb_addr_shadow (CDC_Type *const cdc, const CDC_LAYER layer,
+ *                                                           const uint32_t fb_addr)
+ * @brief   Write layer frame buffer address to the shadow register only.
+ *          The layer is unmasked from the global shadow reload, the address takes
+ *          effect with the next {@ref cdc_global_shadow_reload}.
+ * @param   cdc      Pointer to the cdc register map structure. See {@ref CDC_Type} for details.
+ * @param   layer    The layer number needs to be configure. See {@ref CDC_LAYER} for details.
+ * @param   fb_addr  The Color FB start address.
+ * @retval  none.
+ */
+static inline void cdc_set_layer_fb_addr_shadow (CDC_Type *const cdc, const CDC_LAYER layer,
+                                                 const uint32_t fb_addr)
+{
+    cdc->CDC_LAYER_CFG[layer].CDC_L_REL_CTRL &= ~CDC_Ln_REL_CTRL_SH_MASK;
+    cdc->CDC_LAYER_CFG[layer].CDC_L_CFB_ADDR = fb_addr;
+}
+
 /**
  * @fn      static inline void cdc_irq_enable (CDC_Type *const cdc, const uint32_t irq_mask)
  * @brief   Enable cdc interrupts.
@@ -208,6 +208,24 @@ typedef struct {                                           /*!< (@ 0x49032000) D
 #define DSI_GEN_PLD_B4                       24U
 #define DSI_GEN_PLD_B4_MASK                  (0xFFU << DSI_GEN_PLD_B4)
 
+/*PCKHDL_CFG register bits parameters*/
+#define DSI_BTA_EN                           2U
+#define DSI_BTA_EN_MASK                      (0x1U << DSI_BTA_EN)
+
+/*CMD_MODE_CFG register bits parameters*/
+#define DSI_TEAR_FX_EN                       0U
+#define DSI_TEAR_FX_EN_MASK                  (0x1U << DSI_TEAR_FX_EN)
+
+/*CMD_PKT_STATUS register bits parameters*/
+#define DSI_GEN_CMD_EMPTY                    0U
+#define DSI_GEN_CMD_EMPTY_MASK               (0x1U << DSI_GEN_CMD_EMPTY)
+#define DSI_GEN_CMD_FULL                     1U
+#define DSI_GEN_CMD_FULL_MASK                (0x1U << DSI_GEN_CMD_FULL)
+#define DSI_GEN_PLD_W_EMPTY                  2U
+#define DSI_GEN_PLD_W_EMPTY_MASK             (0x1U << DSI_GEN_PLD_W_EMPTY)
+#define DSI_GEN_PLD_W_FULL                   3U
+#define DSI_GEN_PLD_W_FULL_MASK              (0x1U << DSI_GEN_PLD_W_FULL)
+
 /*LPCLK_CTRL register bits parameters*/
 #define DSI_PHY_TXREQUESTCLKHS               0U
 #define DSI_PHY_TXREQUESTCLKHS_MASK          (0x1U << DSI_PHY_TXREQUESTCLKHS)
@@ -245,6 +263,8 @@ typedef struct {                                           /*!< (@ 0x49032000) D
 /*PHY_STATUS register bits parameters*/
 #define DSI_PHY_LOCK                         0U
 #define DSI_PHY_LOCK_MASK                    (0x1U << DSI_PHY_LOCK)
+#define DSI_PHY_DIRECTION                    1U
+#define DSI_PHY_DIRECTION_MASK               (0x1U << DSI_PHY_DIRECTION)
 #define DSI_PHY_STOPSTATECLKLANE             2U
 #define DSI_PHY_STOPSTATECLKLANE_MASK        (0x1U << DSI_PHY_STOPSTATECLKLANE)
 #define DSI_PHY_STOPSTATELANE_0              4U
@@ -271,6 +291,13 @@ typedef struct {                                           /*!< (@ 0x49032000) D
 #define DSI_DCS_SHORT_WRITE_DATA_TYPE        0x15
 #define DSI_DCS_LONG_WRITE_DATA_TYPE         0x39
 #define DSI_DCS_LONG_WRITE_DATA_LEN          0x06
+#define DSI_DCS_NOP                          0x00
+#define DSI_DCS_SET_COLUMN_ADDRESS           0x2A
+#define DSI_DCS_SET_PAGE_ADDRESS             0x2B
+#define DSI_DCS_WRITE_MEMORY_START           0x2C
+#define DSI_DCS_SET_TEAR_OFF                 0x34
+#define DSI_DCS_SET_TEAR_ON                  0x35
+#define DSI_DCS_WRITE_MEMORY_CONTINUE        0x3C
 
 /* DSI_IRQ0 register bits parameters */
 #define DSI_IRQ0_ACK_WITH_ERR_0     (1U << 0)        /**< SoT error from the Acknowledge error report                                       */
@@ -911,6 +938,105 @@ static inline DSI_CMD_MODE_CFG dsi_get_command_mode_config(DSI_Type *dsi)
     return dsi->DSI_CMD_MODE_CFG;
 }
 
+/**
+  \fn          static inline void dsi_tear_effect_ack_enable(DSI_Type *dsi)
+  \brief       Enable dsi tearing effect acknowledge request.
+  \param[in]   dsi     Pointer to the dsi register map.
+  \return      none
+*/
+static inline void dsi_tear_effect_ack_enable(DSI_Type *dsi)
+{
+    dsi->DSI_CMD_MODE_CFG |= DSI_TEAR_FX_EN_MASK;
+}
+
+/**
+  \fn          static inline void dsi_tear_effect_ack_disable(DSI_Type *dsi)
+  \brief       Disable dsi tearing effect acknowledge request.
+  \param[in]   dsi     Pointer to the dsi register map.
+  \return      none
+*/
+static inline void dsi_tear_effect_ack_disable(DSI_Type *dsi)
+{
+    dsi->DSI_CMD_MODE_CFG &= ~DSI_TEAR_FX_EN_MASK;
+}
+
+/**
+  \fn          static inline void dsi_bta_enable(DSI_Type *dsi)
+  \brief       Enable dsi bus turn-around request.
+  \param[in]   dsi     Pointer to the dsi register map.
+  \return      none
+*/
+static inline void dsi_bta_enable(DSI_Type *dsi)
+{
+    dsi->DSI_PCKHDL_CFG |= DSI_BTA_EN_MASK;
+}
+
+/**
+  \fn          static inline void dsi_bta_disable(DSI_Type *dsi)
+  \brief       Disable dsi bus turn-around request.
+  \param[in]   dsi     Pointer to the dsi register map.
+  \return      none
+*/
+static inline void dsi_bta_disable(DSI_Type *dsi)
+{
+    dsi->DSI_PCKHDL_CFG &= ~DSI_BTA_EN_MASK;
+}
+
+/**
+  \fn          static inline uint32_t dsi_phy_direction_rx(DSI_Type *dsi)
+  \brief       Get dsi data lane 0 direction, set while the peripheral owns the bus.
+  \param[in]   dsi     Pointer to the dsi register map.
+  \return      1 if lane 0 is in receive direction, 0 otherwise.
+*/
+static inline uint32_t dsi_phy_direction_rx(DSI_Type *dsi)
+{
+    return (dsi->DSI_PHY_STATUS & DSI_PHY_DIRECTION_MASK) >> DSI_PHY_DIRECTION;
+}
+
+/**
+  \fn          static inline uint32_t dsi_gen_cmd_fifo_empty(DSI_Type *dsi)
+  \brief       Check dsi generic command FIFO is empty.
+  \param[in]   dsi     Pointer to the dsi register map.
+  \return      1 if generic command FIFO is empty else 0.
+*/
+static inline uint32_t dsi_gen_cmd_fifo_empty(DSI_Type *dsi)
+{
+    return (dsi->DSI_CMD_PKT_STATUS & DSI_GEN_CMD_EMPTY_MASK) >> DSI_GEN_CMD_EMPTY;
+}
+
+/**
+  \fn          static inline uint32_t dsi_gen_cmd_fifo_full(DSI_Type *dsi)
+  \brief       Check dsi generic command FIFO is full.
+  \param[in]   dsi     Pointer to the dsi register map.
+  \return      1 if generic command FIFO is full else 0.
+*/
+static inline uint32_t dsi_gen_cmd_fifo_full(DSI_Type *dsi)
+{
+    return (dsi->DSI_CMD_PKT_STATUS & DSI_GEN_CMD_FULL_MASK) >> DSI_GEN_CMD_FULL;
+}
+
+/**
+  \fn          static inline uint32_t dsi_gen_pld_write_fifo_empty(DSI_Type *dsi)
+  \brief       Check dsi generic write payload FIFO is empty.
+  \param[in]   dsi     Pointer to the dsi register map.
+  \return      1 if generic write payload FIFO is empty else 0.
+*/
+static inline uint32_t dsi_gen_pld_write_fifo_empty(DSI_Type *dsi)
+{
+    return (dsi->DSI_CMD_PKT_STATUS & DSI_GEN_PLD_W_EMPTY_MASK) >> DSI_GEN_PLD_W_EMPTY;
+}
+
+/**
+  \fn          static inline uint32_t dsi_gen_pld_write_fifo_full(DSI_Type *dsi)
+  \brief       Check dsi generic write payload FIFO is full.
+  \param[in]   dsi     Pointer to the dsi register map.
+  \return      1 if generic write payload FIFO is full else 0.
+*/
+static inline uint32_t dsi_gen_pld_write_fifo_full(DSI_Type *dsi)
+{
+    return (dsi->DSI_CMD_PKT_STATUS & DSI_GEN_PLD_W_FULL_MASK) >> DSI_GEN_PLD_W_FULL;
+}
+
 /**
   \fn          static inline void dsi_auto_clklane_enable(DSI_Type *dsi)
   \brief       Enable dsi automatic mechanism on clock lane.
@@ -1283,6 +1409,20 @@ void dsi_dcs_cmd_short_write(DSI_Type *dsi, uint8_t cmd, uint8_t vc_id);
 */
 void dsi_dcs_long_write(DSI_Type *dsi, uint8_t cmd, uint32_t data, uint8_t vc_id);
 
+/**
+  \fn          void dsi_dcs_long_write_buffer(DSI_Type *dsi, uint8_t cmd, const uint8_t *data,
+                                              uint32_t len, uint8_t vc_id)
+  \brief       Perform dsi DCS long write of a byte buffer.
+               The command byte and the payload must fit in the generic payload FIFO.
+  \param[in]   cmd is DCS command info.
+  \param[in]   data pointer to the payload bytes.
+  \param[in]   len number of payload bytes.
+  \param[in]   vc_id virtual channel ID.
+  \return      none.
+*/
+void dsi_dcs_long_write_buffer(DSI_Type *dsi, uint8_t cmd, const uint8_t *data,
+                               uint32_t len, uint8_t vc_id);
+
 /**
   \fn          DSI_LANE_STOPSTATE dsi_get_lane_stopstate_status(DSI_Type *dsi, DSI_LANE lane)
   \brief       Get dsi lane stopstate status.
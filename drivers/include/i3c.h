@@ -184,7 +184,15 @@ typedef struct {                                     /*!< (@ 0x49034000) I3C Str
 
 #define RX_TX_DATA_PORT                   0x14
 #define IBI_QUEUE_STATUS                  0x18
+#define IBI_QUEUE_STATUS_NACK             BIT(31)
+#define IBI_QUEUE_STATUS_IBI_ID(x)        (((x) & GENMASK(15, 8)) >> 8)
+#define IBI_QUEUE_STATUS_DATA_LEN(x)      ((x) & GENMASK(7, 0))
+#define IBI_QUEUE_IBI_ADDR(x)             (IBI_QUEUE_STATUS_IBI_ID(x) >> 1)
+#define IBI_QUEUE_IBI_RNW(x)              (IBI_QUEUE_STATUS_IBI_ID(x) & BIT(0))
+
 #define QUEUE_THLD_CTRL                   0x1c
+#define QUEUE_THLD_CTRL_IBI_STAT_MASK     GENMASK(31, 24)
+#define QUEUE_THLD_CTRL_IBI_STAT(x)       ((((x) - 1) << 24) & GENMASK(31, 24))
 #define QUEUE_THLD_CTRL_RESP_BUF_MASK     GENMASK(15, 8)
 #define QUEUE_THLD_CTRL_RESP_BUF(x)       (((x) - 1) << 8)
 
@@ -197,6 +205,10 @@ typedef struct {                                     /*!< (@ 0x49034000) I3C Str
 #define IBI_SIR_REQ_REJECT                0x30
 #define IBI_REQ_REJECT_ALL                GENMASK(31, 0)
 
+/* SIR request rejection bit of a dynamic address,
+ *  (DA[6:5] + DA[4:0]) mod 32 as per mipi_i3c_databook */
+#define IBI_SIR_REQ_ID(da)                ((((da) >> 5) + (da)) & GENMASK(4, 0))
+
 #define RESET_CTRL                        0x34
 #define RESET_CTRL_IBI_QUEUE              BIT(5)
 #define RESET_CTRL_RX_FIFO                BIT(4)
@@ -304,10 +316,14 @@ typedef struct {                                     /*!< (@ 0x49034000) I3C Str
 #define I3C_VER_ID                        0xe0
 #define I3C_VER_TYPE                      0xe4
 #define EXTENDED_CAPABILITY               0xe8
+#define QUEUE_SIZE_CAP_TX_BUF_WORDS(x)    (2U << ((x) & GENMASK(3, 0)))
+#define QUEUE_SIZE_CAP_RX_BUF_WORDS(x)    (2U << (((x) & GENMASK(7, 4)) >> 4))
 #define SLAVE_CONFIG                      0xec
 
 #define DEV_ADDR_TABLE_LEGACY_I2C_DEV     BIT(31)
 #define DEV_ADDR_TABLE_DYNAMIC_ADDR(x)    (((x) << 16) & GENMASK(23, 16))
+#define DEV_ADDR_TABLE_SIR_REJECT         BIT(13)
+#define DEV_ADDR_TABLE_IBI_MDB            BIT(12)
 #define DEV_ADDR_TABLE_STATIC_ADDR(x)     ((x) & GENMASK(6, 0))
 #define DEV_ADDR_TABLE_LOC(start, idx)    ((start) + ((idx) << 2))
 
@@ -515,6 +531,99 @@ static inline void i3c_clear_xfer_error(I3C_Type *i3c)
   i3c->I3C_INTR_STATUS = INTR_TRANSFER_ERR_STAT;
 }
 
+/**
+  \fn           void i3c_flush_xfer_queues(I3C_Type *i3c)
+  \brief        flush command and response queues and data buffers,
+                 drops the commands not yet run
+                 (used in case of an error in a transfer list)
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \return       none
+*/
+static inline void i3c_flush_xfer_queues(I3C_Type *i3c)
+{
+  i3c->I3C_RESET_CTRL = RESET_CTRL_CMD_QUEUE  |
+                        RESET_CTRL_RESP_QUEUE |
+                        RESET_CTRL_TX_FIFO    |
+                        RESET_CTRL_RX_FIFO;
+
+  /* reset bits are cleared by hardware once done */
+  while (i3c->I3C_RESET_CTRL)
+    ;
+}
+
+/**
+  \fn           void i3c_set_resp_thld(I3C_Type *i3c,
+                                       uint32_t  nresp)
+  \brief        set up for an interrupt after nresp responses
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \param[in]    nresp   : Number of responses, 1 to 256
+  \return       none
+*/
+static inline void i3c_set_resp_thld(I3C_Type *i3c,
+                                     uint32_t  nresp)
+{
+  uint32_t val = i3c->I3C_QUEUE_THLD_CTRL;
+
+  val &= ~QUEUE_THLD_CTRL_RESP_BUF_MASK;
+  val |= QUEUE_THLD_CTRL_RESP_BUF(nresp) & QUEUE_THLD_CTRL_RESP_BUF_MASK;
+  i3c->I3C_QUEUE_THLD_CTRL = val;
+}
+
+/**
+  \fn           uint32_t i3c_get_resp_count(I3C_Type *i3c)
+  \brief        get the number of entries in the response queue
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \return       number of responses
+*/
+static inline uint32_t i3c_get_resp_count(I3C_Type *i3c)
+{
+  return QUEUE_STATUS_LEVEL_RESP(i3c->I3C_QUEUE_STATUS_LEVEL);
+}
+
+/**
+  \fn           uint32_t i3c_get_cmd_empty_loc(I3C_Type *i3c)
+  \brief        get the number of empty command queue locations
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \return       empty command queue locations
+*/
+static inline uint32_t i3c_get_cmd_empty_loc(I3C_Type *i3c)
+{
+  return QUEUE_STATUS_LEVEL_CMD(i3c->I3C_QUEUE_STATUS_LEVEL);
+}
+
+/**
+  \fn           uint32_t i3c_get_tx_empty_loc(I3C_Type *i3c)
+  \brief        get the number of empty TX buffer locations (words)
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \return       empty TX buffer locations
+*/
+static inline uint32_t i3c_get_tx_empty_loc(I3C_Type *i3c)
+{
+  return DATA_BUFFER_STATUS_LEVEL_TX(i3c->I3C_DATA_BUFFER_STATUS_LEVEL);
+}
+
+/**
+  \fn           uint32_t i3c_get_tx_buf_size(I3C_Type *i3c)
+  \brief        get the TX buffer size in words
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \return       TX buffer size
+*/
+static inline uint32_t i3c_get_tx_buf_size(I3C_Type *i3c)
+{
+  return QUEUE_SIZE_CAP_TX_BUF_WORDS(i3c->I3C_QUEUE_SIZE_CAPABILITY);
+}
+
+/**
+  \fn           uint32_t i3c_get_rx_buf_size(I3C_Type *i3c)
+  \brief        get the RX buffer size in words
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \return       RX buffer size
+*/
+static inline uint32_t i3c_get_rx_buf_size(I3C_Type *i3c)
+{
+  return QUEUE_SIZE_CAP_RX_BUF_WORDS(i3c->I3C_QUEUE_SIZE_CAPABILITY);
+}
+
 /**
   \fn           uint32_t i3c_get_dat_addr(I3C_Type *i3c)
   \brief        get start address of Device Address Table
@@ -580,9 +689,10 @@ static inline void i3c_add_slv_to_dat(I3C_Type *i3c,
 
   if(dyn_addr)
   {
-    /* i3c slave */
+    /* i3c slave, IBIs rejected until enabled \ref i3c_dat_set_ibi */
     val = DEV_ADDR_TABLE_DYNAMIC_ADDR(dyn_addr) |
-          DEV_ADDR_TABLE_STATIC_ADDR(sta_addr);
+          DEV_ADDR_TABLE_STATIC_ADDR(sta_addr)  |
+          DEV_ADDR_TABLE_SIR_REJECT;
   }
   else
   {
@@ -608,6 +718,111 @@ static inline void i3c_remove_slv_from_dat(I3C_Type *i3c,
   i3c_update_dat(i3c, pos, 0);
 }
 
+/**
+  \fn           uint32_t i3c_read_dat(I3C_Type *i3c,
+                                      uint32_t  pos)
+  \brief        read Device Address Table
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \param[in]    pos     : DAT position
+  \return       Value of DAT position
+*/
+static inline uint32_t i3c_read_dat(I3C_Type *i3c,
+                                    uint32_t  pos)
+{
+  uint32_t datp = i3c_get_dat_addr(i3c);
+  uint32_t dat_addr = 0;
+
+  /* DAT address = i3c Base + DAT Base + (Pos * 4) */
+  dat_addr = (uint32_t)i3c + datp + (pos << 2);
+  return *((volatile uint32_t *) (dat_addr));
+}
+
+/**
+  \fn           void i3c_dat_set_ibi(I3C_Type *i3c,
+                                     uint32_t  pos,
+                                     uint8_t   enable,
+                                     uint8_t   with_mdb)
+  \brief        accept or reject IBIs of a Device Address Table entry
+  \param[in]    i3c      : Pointer to i3c register set structure
+  \param[in]    pos      : DAT position
+  \param[in]    enable   : 1 to accept slave interrupt requests
+  \param[in]    with_mdb : 1 if the slave sends a mandatory data byte
+  \return       none
+*/
+static inline void i3c_dat_set_ibi(I3C_Type *i3c,
+                                   uint32_t  pos,
+                                   uint8_t   enable,
+                                   uint8_t   with_mdb)
+{
+  uint32_t val = i3c_read_dat(i3c, pos);
+
+  val &= ~(DEV_ADDR_TABLE_SIR_REJECT | DEV_ADDR_TABLE_IBI_MDB);
+
+  if (!enable)
+    val |= DEV_ADDR_TABLE_SIR_REJECT;
+  else if (with_mdb)
+    val |= DEV_ADDR_TABLE_IBI_MDB;
+
+  i3c_update_dat(i3c, pos, val);
+}
+
+/**
+  \fn           void i3c_set_sir_reject(I3C_Type *i3c,
+                                        uint32_t  reject)
+  \brief        set the SIR request rejection bits,
+                 one bit per \ref IBI_SIR_REQ_ID
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \param[in]    reject  : Rejection bits
+  \return       none
+*/
+static inline void i3c_set_sir_reject(I3C_Type *i3c,
+                                      uint32_t  reject)
+{
+  i3c->I3C_IBI_SIR_REQ_REJECT = reject;
+}
+
+/**
+  \fn           void i3c_ibi_intr_enable(I3C_Type *i3c)
+  \brief        enable the interrupt for IBI status queue entries
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \return       none
+*/
+static inline void i3c_ibi_intr_enable(I3C_Type *i3c)
+{
+  uint32_t val = i3c->I3C_QUEUE_THLD_CTRL;
+
+  /* set up for an interrupt after one IBI status */
+  val &= ~QUEUE_THLD_CTRL_IBI_STAT_MASK;
+  val |= QUEUE_THLD_CTRL_IBI_STAT(1);
+  i3c->I3C_QUEUE_THLD_CTRL = val;
+
+  i3c->I3C_INTR_STATUS_EN = i3c->I3C_INTR_STATUS_EN | INTR_IBI_THLD_STAT;
+  i3c->I3C_INTR_SIGNAL_EN = i3c->I3C_INTR_SIGNAL_EN | INTR_IBI_THLD_STAT;
+}
+
+/**
+  \fn           void i3c_ibi_intr_disable(I3C_Type *i3c)
+  \brief        disable the interrupt for IBI status queue entries
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \return       none
+*/
+static inline void i3c_ibi_intr_disable(I3C_Type *i3c)
+{
+  i3c->I3C_INTR_STATUS_EN = i3c->I3C_INTR_STATUS_EN & ~INTR_IBI_THLD_STAT;
+  i3c->I3C_INTR_SIGNAL_EN = i3c->I3C_INTR_SIGNAL_EN & ~INTR_IBI_THLD_STAT;
+}
+
+/**
+  \fn           uint32_t i3c_get_ibi_count(I3C_Type *i3c)
+  \brief        get the number of entries in the IBI status queue
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \return       number of IBI status entries
+*/
+static inline uint32_t i3c_get_ibi_count(I3C_Type *i3c)
+{
+  return QUEUE_STATUS_IBI_STATUS_CNT(i3c->I3C_QUEUE_STATUS_LEVEL);
+}
+
 /**
   \fn           void i3c_send_ccc_cmd(I3C_Type *i3c,
                                       uint32_t  ccc_cmd,
@@ -666,6 +881,49 @@ void i3c_master_rx(I3C_Type *i3c,
                    uint32_t  index,
                    uint16_t  len);
 
+/**
+  \fn           void i3c_master_list_cmd(I3C_Type *i3c,
+                                         I3C_XFER *xfer,
+                                         uint32_t  index,
+                                         uint8_t   read,
+                                         uint16_t  len,
+                                         uint8_t   last)
+  \brief        send one command of a transfer list to i3c bus,
+                 the response threshold is left to the caller.
+                 Commands other than the last one keep the bus
+                 and the next one follows with a repeated start.
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \param[in]    xfer    : Pointer to i3c transfer structure,
+                            tx_buf holds the data of a write
+  \param[in]    index   : DAT Slave index
+  \param[in]    read    : 1 for a read, 0 for a write
+  \param[in]    len     : Transfer length
+  \param[in]    last    : 1 for the last command, ends with a STOP
+  \return       none
+*/
+void i3c_master_list_cmd(I3C_Type *i3c,
+                         I3C_XFER *xfer,
+                         uint32_t  index,
+                         uint8_t   read,
+                         uint16_t  len,
+                         uint8_t   last);
+
+/**
+  \fn           uint32_t i3c_master_read_resp(I3C_Type *i3c,
+                                              void     *rx_buf,
+                                              uint16_t  size)
+  \brief        read one response, and for a successful read
+                 its data from the RX buffer.
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \param[out]   rx_buf  : Pointer to buffer for read data,
+                            NULL for a write
+  \param[in]    size    : Size of the buffer in bytes
+  \return       Response, see RESPONSE_PORT_xxx
+*/
+uint32_t i3c_master_read_resp(I3C_Type *i3c,
+                              void     *rx_buf,
+                              uint16_t  size);
+
 /**
   \fn           void i3c_slave_tx(I3C_Type *i3c,
                                   I3C_XFER *xfer,
@@ -799,6 +1057,22 @@ void i3c_master_init(I3C_Type *i3c);
 void i3c_slave_init(I3C_Type *i3c,
                     uint8_t   slv_addr);
 
+/**
+  \fn           uint32_t i3c_master_read_ibi(I3C_Type *i3c,
+                                             uint8_t  *data,
+                                             uint32_t  size)
+  \brief        read one entry of the IBI status queue together
+                 with its payload; payload bytes beyond size are
+                 read out of the queue and dropped.
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \param[out]   data    : Pointer to buffer for the IBI payload
+  \param[in]    size    : Size of the buffer in bytes
+  \return       IBI status, see IBI_QUEUE_STATUS_xxx
+*/
+uint32_t i3c_master_read_ibi(I3C_Type *i3c,
+                             uint8_t  *data,
+                             uint32_t  size);
+
 /**
   \fn           void i3c_irq_handler(I3C_Type *i3c,
                                      I3C_XFER *xfer)
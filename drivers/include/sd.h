@@ -42,7 +42,8 @@ typedef enum _SD_DRV_STATUS{
     SD_DRV_STATUS_CARD_INIT_ERR,
     SD_DRV_STATUS_RD_ERR,
     SD_DRV_STATUS_WR_ERR,
-    SD_DRV_STATUS_TIMEOUT_ERR
+    SD_DRV_STATUS_TIMEOUT_ERR,
+    SD_DRV_STATUS_BUSY
 }SD_DRV_STATUS;
 
 /**
@@ -92,6 +93,49 @@ typedef struct _sd_cmd_t{
 }sd_cmd_t;
 
 
+#ifdef SDMMC_IRQ_MODE
+/* Max blocks of one queued transfer (merged requests included) */
+#define SD_QUEUE_MAX_BLK_CNT            1024U
+
+/* Max buffer segments of one queued transfer (ADMA2 mode) */
+#define SD_QUEUE_MAX_SEGS               16U
+
+/**
+ * @brief  SD block request direction
+ */
+typedef enum _SD_REQ_DIR{
+    SD_REQ_READ,
+    SD_REQ_WRITE
+}SD_REQ_DIR;
+
+/**
+ * @brief  SD asynchronous block request, see sd_submit()
+ */
+typedef struct _sd_request_t{
+    struct _sd_request_t    *next;          /*!< Queue link, used by the driver             */
+    uint32_t                sector;         /*!< First sector                               */
+    uint32_t                blk_cnt;        /*!< Number of blocks                           */
+    volatile uint8_t        *buff;          /*!< Data buffer, 32-byte (cache line) aligned  */
+    SD_REQ_DIR              dir;            /*!< Read or write                              */
+    __IO SD_DRV_STATUS      status;         /*!< SD_DRV_STATUS_BUSY until completed         */
+    void (*complete)(struct _sd_request_t *); /*!< Completion callback, from the SDMMC IRQ */
+    void                    *context;       /*!< Application context                        */
+}sd_request_t;
+
+/**
+ * @brief  SD block request queue
+ */
+typedef struct _sd_queue_t{
+    sd_request_t            *head;          /*!< First pending request                      */
+    sd_request_t            *tail;          /*!< Last pending request                       */
+    sd_request_t            *active;        /*!< Requests of the transfer in progress       */
+    adma2_seg_t             segs[SD_QUEUE_MAX_SEGS]; /*!< Buffers of the active transfer    */
+    uint32_t                nsegs;          /*!< Number of active buffer segments           */
+    __IO uint8_t            data_phase;     /*!< Transfer in progress, completed by the IRQ */
+    __IO uint8_t            starting;       /*!< Transfer being started, blocks nesting     */
+}sd_queue_t;
+#endif
+
 /**
  * @brief SD Default init Parameters
  */
@@ -122,6 +166,9 @@ typedef struct _sd_handle_t{
     uint8_t                 bus_width;      /*!< 1Bit, 4Bit, 8Bit Mode                  */
     uint8_t                 dma_mode;       /*!< SDMA, ADMA2, and ADMA3 Mode            */
     sd_param_t              sd_param;       /*!< SD Default Config Parameters           */
+#ifdef SDMMC_IRQ_MODE
+    sd_queue_t              queue;          /*!< Asynchronous block request queue       */
+#endif
 }sd_handle_t;
 
 /**
@@ -150,9 +197,13 @@ SD_DRV_STATUS sd_host_init(sd_handle_t *, sd_param_t *);
 SD_DRV_STATUS sd_card_init(sd_handle_t *, sd_param_t *);
 SD_DRV_STATUS sd_write(uint32_t, uint32_t, volatile unsigned char *);
 SD_DRV_STATUS sd_read(uint32_t, uint16_t, volatile unsigned char *);
+SD_DRV_STATUS sd_write_sg(uint32_t, const adma2_seg_t *, uint32_t);
+SD_DRV_STATUS sd_read_sg(uint32_t, const adma2_seg_t *, uint32_t);
 SD_DRV_STATUS sd_error_handler();
 #ifdef SDMMC_IRQ_MODE
 void sd_cb(uint32_t);
+SD_DRV_STATUS sd_submit(sd_request_t *);
+void sd_queue_xfer_done(sd_handle_t *, SDMMC_HC_STATUS);
 #endif
 SDMMC_HC_STATUS hc_send_cmd(sd_handle_t *, sd_cmd_t *);
 SDMMC_HC_STATUS hc_reset(sd_handle_t *, uint8_t);
@@ -173,6 +224,9 @@ SDMMC_HC_STATUS hc_set_blk_size(sd_handle_t *, uint32_t);
 SDMMC_HC_STATUS hc_set_blk_cnt(sd_handle_t *, uint32_t);
 SDMMC_HC_STATUS hc_read_setup(sd_handle_t *, uint32_t , uint32_t , uint16_t);
 SDMMC_HC_STATUS hc_write_setup(sd_handle_t *, uint32_t , uint32_t , uint16_t);
+SDMMC_HC_STATUS hc_dma_config_sg(sd_handle_t *, const adma2_seg_t *, uint32_t, uint16_t);
+SDMMC_HC_STATUS hc_read_setup_sg(sd_handle_t *, const adma2_seg_t *, uint32_t, uint32_t, uint16_t);
+SDMMC_HC_STATUS hc_write_setup_sg(sd_handle_t *, const adma2_seg_t *, uint32_t, uint32_t, uint16_t);
 SDMMC_HC_STATUS hc_check_xfer_done(sd_handle_t *, uint32_t);
 SDMMC_HC_STATUS hc_get_rca(sd_handle_t *, uint32_t *);
 SDMMC_HC_STATUS hc_get_card_status(sd_handle_t *pHsd, uint32_t *);
@@ -0,0 +1,117 @@
+/* Copyright (C) 2024 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**************************************************************************//**
+ * @file     sd_cache.h
+ * @version  V0.0.1
+ * @brief    SD sector cache with read-ahead and write-back.
+ * @bug      None.
+ * @Note     None
+ ******************************************************************************/
+
+#ifndef __SD_CACHE_H__
+#define __SD_CACHE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes */
+#include "sd.h"
+
+/* Number of hash buckets of the sector lookup, power of 2 */
+#ifndef SD_CACHE_HASH_SIZE
+#define SD_CACHE_HASH_SIZE              64U
+#endif
+
+/* Max read-ahead sectors in flight */
+#ifndef SD_CACHE_RA_MAX
+#define SD_CACHE_RA_MAX                 16U
+#endif
+
+/* Max sectors of one card access (cache lines are scattered in memory) */
+#ifndef SD_CACHE_IO_BATCH
+#define SD_CACHE_IO_BATCH               16U
+#endif
+
+/* Max wait for a read-ahead sector, in microseconds */
+#ifndef SD_CACHE_WAIT_TIMEOUT_US
+#define SD_CACHE_WAIT_TIMEOUT_US        500000U
+#endif
+
+/* Sequential reads in a row that trigger the read-ahead */
+#define SD_CACHE_SEQ_THRESHOLD          2U
+
+#define SD_CACHE_LINE_NONE              0xFFFFU
+
+/* Cache line flags */
+#define SD_CACHE_LINE_VALID             (1U << 0U)
+#define SD_CACHE_LINE_DIRTY             (1U << 1U)
+#define SD_CACHE_LINE_PENDING           (1U << 2U)  /*!< Read-ahead in flight   */
+#define SD_CACHE_LINE_PREFETCHED        (1U << 3U)  /*!< Not yet read by a user */
+#define SD_CACHE_LINE_LOCKED            (1U << 4U)  /*!< Card access in progress */
+#define SD_CACHE_LINE_STALE             (1U << 5U)  /*!< Dropped once its read-ahead lands */
+
+/**
+ * @brief  SD cache line, one sector. Used by the driver only.
+ */
+typedef struct _sd_cache_line_t{
+    uint32_t                sector;         /*!< Cached sector                          */
+    uint16_t                hnext;          /*!< Next line of the hash bucket           */
+    uint16_t                prev;           /*!< LRU list, more recently used line      */
+    uint16_t                next;           /*!< LRU list, less recently used line      */
+    uint8_t                 flags;          /*!< SD_CACHE_LINE_xxx                      */
+    uint8_t                 ra_slot;        /*!< Read-ahead request of a pending line   */
+}sd_cache_line_t;
+
+/**
+ * @brief  SD cache configuration.
+ *         The line buffers may be placed in SRAM, or in the HyperRAM XIP
+ *         region once ospi_hyperram_xip_init() has set it up. The line table
+ *         is walked on every access and is best kept in SRAM or DTCM.
+ */
+typedef struct _sd_cache_config_t{
+    uint8_t                 *data;          /*!< Line buffers, num_lines * 512 bytes, 32-byte aligned   */
+    sd_cache_line_t         *lines;         /*!< Line table, num_lines entries                          */
+    uint16_t                num_lines;      /*!< Number of cache lines                                  */
+    uint16_t                read_ahead;     /*!< Sectors to prefetch on sequential reads, 0: off        */
+    uint16_t                bypass_blk_cnt; /*!< Requests this large go straight to the card, 0: never  */
+    uint16_t                erase_blk_cnt;  /*!< Write-back unit in sectors, power of 2, e.g. 8192 (4MB AU) */
+    uint8_t                 write_back;     /*!< 0: write-through, 1: write-back until sd_cache_flush() */
+}sd_cache_config_t;
+
+/**
+ * @brief  SD cache counters, in sectors unless noted
+ */
+typedef struct _sd_cache_stats_t{
+    uint32_t                read_hits;      /*!< Sectors read from the cache            */
+    uint32_t                read_misses;    /*!< Sectors read from the card             */
+    uint32_t                ra_sectors;     /*!< Sectors prefetched                     */
+    uint32_t                ra_hits;        /*!< Prefetched sectors read later          */
+    uint32_t                writes;         /*!< Sectors written by the user            */
+    uint32_t                card_writes;    /*!< Write commands sent to the card        */
+    uint32_t                bypass;         /*!< Sectors that went straight to the card */
+}sd_cache_stats_t;
+
+extern const diskio_t SD_Cache_Driver;
+
+/* SD cache function forward declaration */
+SD_DRV_STATUS sd_cache_init(const sd_cache_config_t *);
+SD_DRV_STATUS sd_cache_read(uint32_t, uint32_t, volatile uint8_t *);
+SD_DRV_STATUS sd_cache_write(uint32_t, uint32_t, volatile uint8_t *);
+SD_DRV_STATUS sd_cache_flush(void);
+void sd_cache_invalidate(void);
+void sd_cache_get_stats(sd_cache_stats_t *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SD_CACHE_H__ */
@@ -136,12 +136,30 @@ typedef struct _adma2_desc_t{
     uint32_t addr;
 }__attribute__((__packed__))adma2_desc_t;
 
+/**
+ * @brief Scatter-gather buffer segment, one entry of an ADMA2 transfer
+ */
+typedef struct _adma2_seg_t{
+    uint32_t addr;                              /*!< Buffer address, word aligned           */
+    uint32_t len;                               /*!< Length in bytes, multiple of 4         */
+}adma2_seg_t;
+
 /* ADMA Descriptor Constant */
 #define SDMMC_ADMA2_DESC_MAX_LEN                65536U
 #define SDMMC_ADMA2_DESC_VALID                  (0x1U << 0U)
 #define SDMMC_ADMA2_DESC_END                    (0x1U << 1U)
 #define SDMMC_ADMA2_DESC_INT                    (0x1U << 2U)
 #define SDMMC_ADMA2_DESC_TRAN                   (0x1U << 5U)
+#define SDMMC_ADMA2_DESC_LINK                   (0x3U << 4U)
+
+/* ADMA2 descriptor pool: tables of SDMMC_ADMA2_DESC_TBL_LEN entries, the last
+ * entry of a table links to the next one */
+#ifndef SDMMC_ADMA2_DESC_TBL_LEN
+#define SDMMC_ADMA2_DESC_TBL_LEN                32U
+#endif
+#ifndef SDMMC_ADMA2_DESC_TBL_CNT
+#define SDMMC_ADMA2_DESC_TBL_CNT                4U
+#endif
 
 /* SDMMC Device ID Constnat */
 #define SDMMC_DEV_ID                            1U
@@ -317,6 +317,8 @@ typedef struct _spi_transfer_t {
     SPI_TMOD                        mode;               /**< SPI transfer mode                */
     uint8_t                         frame_size;         /**< SPI Data frame size              */
     volatile SPI_TRANSFER_STATUS    status;             /**< transfer status                  */
+    void (*tx_fill)(SPI_Type *spi, struct _spi_transfer_t *transfer, uint32_t count);  /**< Tx FIFO fill routine, NULL for generic  */
+    void (*rx_drain)(SPI_Type *spi, struct _spi_transfer_t *transfer, uint32_t count); /**< Rx FIFO drain routine, NULL for generic */
 } spi_transfer_t;
 
 /**
@@ -493,6 +495,32 @@ static inline bool spi_busy(SPI_Type *spi)
     return (spi->SPI_SR & 1);
 }
 
+/**
+  \fn          void spi_unmask_tx_empty_interrupt(SPI_Type *spi)
+  \brief       Unmask the Tx FIFO empty interrupt, leaving the others as set
+  \param[in]   spi   Pointer to SPI register map
+  \return      none
+*/
+static inline void spi_unmask_tx_empty_interrupt(SPI_Type *spi)
+{
+    spi->SPI_IMR |= SPI_IMR_TX_FIFO_EMPTY_INTERRUPT_MASK;
+}
+
+/**
+  \fn          void spi_select_slave(SPI_Type *spi, uint8_t slave)
+  \brief       Select a single slave, deselecting all others, with one
+               disable/enable cycle of the SPI instance
+  \param[in]   spi    Pointer to the SPI register map
+  \param[in]   slave  The slave to be selected
+  \return      none
+*/
+static inline void spi_select_slave(SPI_Type *spi, uint8_t slave)
+{
+    spi_disable(spi);
+    spi->SPI_SER = (1U << slave);
+    spi_enable(spi);
+}
+
 /**
   \fn          void spi_set_rx_sample_delay(SPI_Type *spi, uint8_t rx_sample_delay)
   \brief       Set Receive sample delay for the SPI instance
@@ -677,6 +705,16 @@ void spi_set_tx_fifo_start_level(SPI_Type *spi, uint16_t level);
 */
 void spi_control_ss(SPI_Type *spi, uint8_t slave, SPI_SS_STATE state);
 
+/**
+  \fn          void spi_set_fifo_handlers(spi_transfer_t *transfer)
+  \brief       Select the FIFO fill and drain routines used by spi_irq_handler
+               for the transfer, from its frame size and Tx buffer. To be
+               called once the transfer structure is set up.
+  \param[in]   transfer  Pointer to transfer structure
+  \return      none
+*/
+void spi_set_fifo_handlers(spi_transfer_t *transfer);
+
 /**
   \fn          void spi_send(SPI_Type *spi)
   \brief       Prepare the SPI instance for transmission
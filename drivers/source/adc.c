@@ -34,10 +34,125 @@ void adc_done0_irq_handler(ADC_Type *adc, conv_info_t *conversion)
         conversion->curr_channel = conversion->read_channel;
         /* Next channel to be read */
         conversion->read_channel = adc->ADC_SEL;
-        /* set call back */
-        conversion->status |= ADC_CONV_STAT_COMPLETE;
+
+        if (conversion->capture)
+        {
+            /* store the sample, event only once the window is complete */
+            conversion->status |= adc_capture_put(conversion->capture,
+                                                  conversion->curr_channel,
+                                                  conversion->sampled_value);
+        }
+        else if (conversion->stream)
+        {
+            /* store the sample, events only per buffer half */
+            conversion->status |= adc_stream_put(conversion->stream,
+                                                 conversion->curr_channel,
+                                                 conversion->sampled_value);
+        }
+        else
+        {
+            /* set call back */
+            conversion->status |= ADC_CONV_STAT_COMPLETE;
+        }
+    }
+
+}
+
+/**
+ * @fn       : void adc_capture_trigger(adc_capture_t *capture, uint32_t status)
+ * @brief    : Trigger an armed capture on a comparator condition. The
+ *             last stored sample is taken as the trigger sample.
+ * @param[1] : capture : Pointer to the adc_capture_t structure
+ * @param[2] : status  : comparator status, ADC_CONV_STAT_CMP_THLD_x
+ * @return   : none
+*/
+void adc_capture_trigger(adc_capture_t *capture, uint32_t status)
+{
+    if ((capture->state != ADC_CAPTURE_STATE_ARMED) || !(status & capture->trigger_mask))
+        return;
+
+    /* no sample taken yet */
+    if (!capture->filled)
+        return;
+
+    capture->trigger_idx = capture->idx ? (capture->idx - 1) : (capture->num - 1);
+    capture->remaining   = capture->post;
+    capture->state       = ADC_CAPTURE_STATE_TRIGGERED;
+}
+
+/**
+ * @fn       : uint32_t adc_capture_put(adc_capture_t *capture, uint32_t channel, uint32_t value)
+ * @brief    : Store a sample tagged with its channel round the capture
+ *             buffer. Nothing is stored once the window is complete.
+ * @param[1] : capture : Pointer to the adc_capture_t structure
+ * @param[2] : channel : channel of the sample
+ * @param[3] : value   : sample value
+ * @return   : ADC_CONV_STAT_CAPTURE_COMPLETE when the window is complete, else 0
+*/
+uint32_t adc_capture_put(adc_capture_t *capture, uint32_t channel, uint32_t value)
+{
+    uint32_t idx = capture->idx;
+
+    if (capture->state == ADC_CAPTURE_STATE_DONE)
+        return 0;
+
+    capture->buf[idx++] = (channel << ADC_STREAM_CHANNEL_Pos) | (value & ADC_STREAM_VALUE_Msk);
+    capture->idx = (idx == capture->num) ? 0 : idx;
+
+    if (capture->filled < capture->num)
+        capture->filled++;
+
+    if ((capture->state == ADC_CAPTURE_STATE_TRIGGERED) && !--capture->remaining)
+    {
+        capture->state = ADC_CAPTURE_STATE_DONE;
+        return ADC_CONV_STAT_CAPTURE_COMPLETE;
     }
 
+    return 0;
+}
+
+/**
+ * @fn       : uint32_t adc_stream_put(adc_stream_t *stream, uint32_t channel, uint32_t value)
+ * @brief    : Store a sample tagged with its channel in the stream buffer.
+ *             The sample is dropped if the half it falls in is still owned
+ *             by the application.
+ * @param[1] : stream  : Pointer to the adc_stream_t structure
+ * @param[2] : channel : channel of the sample
+ * @param[3] : value   : sample value
+ * @return   : ADC_CONV_STAT_STREAM_HALF/FULL when a half got filled, else 0
+*/
+uint32_t adc_stream_put(adc_stream_t *stream, uint32_t channel, uint32_t value)
+{
+    uint32_t half = stream->num >> 1;
+    uint32_t idx  = stream->idx;
+
+    /* ownership only changes at half boundaries */
+    if (((idx == 0) && stream->owned[0]) || ((idx == half) && stream->owned[1]))
+    {
+        stream->overruns++;
+        return 0;
+    }
+
+    stream->buf[idx++] = (channel << ADC_STREAM_CHANNEL_Pos) | (value & ADC_STREAM_VALUE_Msk);
+    stream->samples++;
+
+    if (idx == half)
+    {
+        stream->idx = idx;
+        stream->owned[0] = 1;
+        return ADC_CONV_STAT_STREAM_HALF;
+    }
+
+    if (idx == stream->num)
+    {
+        stream->idx = 0;
+        stream->owned[1] = 1;
+        return ADC_CONV_STAT_STREAM_FULL;
+    }
+
+    stream->idx = idx;
+
+    return 0;
 }
 
 /**
@@ -54,7 +169,13 @@ void adc_done1_irq_handler(ADC_Type *adc, conv_info_t *conversion)
     /* Clearing the done IRQ*/
     adc->ADC_INTERRUPT = ADC_INTR_DONE1_CLEAR;
 
-    if (conversion->mode == ADC_CONV_MODE_SINGLE_SHOT)
+    if (conversion->scan)
+    {
+        /* whole sample bank of one scan */
+        adc_scan_read(adc, conversion->scan);
+        conversion->status |= ADC_CONV_STAT_SCAN_COMPLETE;
+    }
+    else if (conversion->mode == ADC_CONV_MODE_SINGLE_SHOT)
     {
         /* read sample and store to user memory */
         conversion->status |= ADC_CONV_STAT_COMPLETE;
@@ -89,6 +210,11 @@ void adc_cmpa_irq_handler(ADC_Type *adc, conv_info_t *conversion)
          conversion->status |= ADC_CONV_STAT_CMP_THLD_BETWEEN_A_B;
          break;
     }
+
+    if (conversion->capture)
+    {
+        adc_capture_trigger(conversion->capture, conversion->status);
+    }
 }
 
 /**
@@ -114,5 +240,10 @@ void adc_cmpb_irq_handler(ADC_Type *adc, conv_info_t *conversion)
          conversion->status |= ADC_CONV_STAT_CMP_THLD_OUTSIDE_A_B;
          break;
     }
+
+    if (conversion->capture)
+    {
+        adc_capture_trigger(conversion->capture, conversion->status);
+    }
 }
 /************************ (C) COPYRIGHT ALIF SEMICONDUCTOR *****END OF FILE****/
@@ -371,6 +371,27 @@ void canfd_set_err_warn_limit(CANFD_Type* canfd, const uint8_t ewl)
 */
 void canfd_send(CANFD_Type* canfd, const canfd_tx_info_t tx_header,
                 const uint8_t *data, const uint8_t size)
+{
+    canfd_load_tx_msg(canfd, tx_header, data, size);
+
+    canfd_start_tx(canfd, tx_header.buf_type);
+}
+
+/**
+  \fn          void canfd_load_tx_msg(CANFD_Type* canfd,
+  \                                  const canfd_tx_info_t tx_header,
+  \                                  const uint8_t *data,
+  \                                  const uint8_t size)
+  \brief       Loads the message into the selected Tx buffer without
+  \            starting the transmission
+  \param[in]   canfd      : Pointer to the CANFD register map
+  \param[in]   tx_header  : Header of tx message
+  \param[in]   data       : Message payload
+  \param[in]   size       : payload size
+  \return      none
+*/
+void canfd_load_tx_msg(CANFD_Type* canfd, const canfd_tx_info_t tx_header,
+                       const uint8_t *data, const uint8_t size)
 {
     volatile tbuf_regs_t* tx_msg = (volatile tbuf_regs_t*)canfd->CANFD_TBUF;
 
@@ -392,15 +413,8 @@ void canfd_send(CANFD_Type* canfd, const canfd_tx_info_t tx_header,
 
     if(tx_header.buf_type != CANFD_BUF_TYPE_PRIMARY)
     {
-        /* Moves the pointer to next buf slot and
-         * enables the tx of all frames in sec buf*/
+        /* Moves the pointer to next buf slot */
         canfd->CANFD_TCTRL |= CANFD_TCTRL_TSNEXT;
-        canfd->CANFD_TCMD  |= CANFD_TCMD_TSALL;
-    }
-    else
-    {
-        /* Enables primary buffer transmission */
-        canfd->CANFD_TCMD |= CANFD_TCMD_TPE;
     }
 }
 
@@ -544,6 +558,56 @@ void canfd_receive_blocking(CANFD_Type* canfd, canfd_transfer_t *dest_data)
     canfd->CANFD_RCTRL   |= CANFD_RCTRL_RREL;
 }
 
+/**
+  \fn          void canfd_get_rx_header(CANFD_Type* canfd,
+  \                                    canfd_rx_info_t *rx_header)
+  \brief       Fetches the header and timestamp of the msg in Rx buffer
+  \param[in]   canfd      : Pointer to the CANFD register map
+  \param[in]   rx_header  : Destination header
+  \return      none
+*/
+void canfd_get_rx_header(CANFD_Type* canfd, canfd_rx_info_t *rx_header)
+{
+    rbuf_regs_t* rx_msg = (rbuf_regs_t*)canfd->CANFD_RBUF;
+
+    rx_header->id           = (rx_msg->can_id & (~CANFD_MSG_ESI_Msk));
+    rx_header->esi          = ((rx_msg->can_id >> CANFD_MSG_ESI_Pos) & 1U);
+    rx_header->frame_type   = ((rx_msg->control >> CANFD_MSG_IDE_Pos) & 1U);
+    rx_header->rtr          = ((rx_msg->control >> CANFD_MSG_RTR_Pos) & 1U);
+    rx_header->edl          = ((rx_msg->control >> CANFD_MSG_FDF_Pos) & 1U);
+    rx_header->brs          = ((rx_msg->control >> CANFD_MSG_BRS_Pos) & 1U);
+    rx_header->status       = rx_msg->status;
+    rx_header->dlc          = ((rx_msg->control >> CANFD_MSG_DLC_Pos) & 0xFU);
+    rx_header->timestamp[0U] = rx_msg->rx_timestamp[0U];
+}
+
+/**
+  \fn          void canfd_read_rx_data(CANFD_Type* canfd,
+  \                                   uint32_t *data,
+  \                                   const uint8_t size)
+  \brief       Copies the payload of the msg in Rx buffer word wise
+  \            and releases the Rx buffer slot
+  \param[in]   canfd  : Pointer to the CANFD register map
+  \param[in]   data   : Destination buffer, word aligned
+  \param[in]   size   : payload size, 0 to drop the msg
+  \return      none
+*/
+void canfd_read_rx_data(CANFD_Type* canfd, uint32_t *data, const uint8_t size)
+{
+    uint8_t iter                  = 0U;
+    rbuf_regs_t* rx_msg           = (rbuf_regs_t*)canfd->CANFD_RBUF;
+    volatile const uint32_t* src  = (volatile const uint32_t*)rx_msg->data;
+
+    /* Copy the data, the last word may carry padding */
+    for(iter = 0U; iter < ((size + 3U) / 4U); iter++)
+    {
+        data[iter] = src[iter];
+    }
+
+    /* Release the buffer */
+    canfd->CANFD_RCTRL   |= CANFD_RCTRL_RREL;
+}
+
 /**
   \fn          void canfd_clear_interrupt(CANFD_Type* canfd,
                                           const uint32_t event)
@@ -67,6 +67,52 @@ void dsi_dcs_long_write(DSI_Type *dsi, uint8_t cmd, uint32_t data, uint8_t vc_id
                        (DSI_DCS_LONG_WRITE_DATA_LEN << DSI_GEN_WC_LSBYTE);
 }
 
+/**
+  \fn          void dsi_dcs_long_write_buffer(DSI_Type *dsi, uint8_t cmd, const uint8_t *data,
+                                              uint32_t len, uint8_t vc_id)
+  \brief       Perform dsi DCS long write of a byte buffer.
+               The command byte and the payload must fit in the generic payload FIFO.
+  \param[in]   cmd is DCS command info.
+  \param[in]   data pointer to the payload bytes.
+  \param[in]   len number of payload bytes.
+  \param[in]   vc_id virtual channel ID.
+  \return      none.
+*/
+void dsi_dcs_long_write_buffer(DSI_Type *dsi, uint8_t cmd, const uint8_t *data,
+                               uint32_t len, uint8_t vc_id)
+{
+    uint32_t word_count = len + 1U;
+    uint32_t word       = cmd;
+    uint32_t shift      = DSI_GEN_PLD_B2;
+
+    /* Pack the command byte followed by the payload into 32-bit FIFO words */
+    for(uint32_t i = 0; i < len; i++)
+    {
+        word |= ((uint32_t)data[i] << shift);
+        shift += 8U;
+
+        if(shift == 32U)
+        {
+            while(dsi->DSI_CMD_PKT_STATUS & DSI_GEN_PLD_W_FULL_MASK);
+            dsi->DSI_GEN_PLD_DATA = word;
+            word  = 0U;
+            shift = DSI_GEN_PLD_B1;
+        }
+    }
+
+    if(shift != DSI_GEN_PLD_B1)
+    {
+        while(dsi->DSI_CMD_PKT_STATUS & DSI_GEN_PLD_W_FULL_MASK);
+        dsi->DSI_GEN_PLD_DATA = word;
+    }
+
+    while(dsi->DSI_CMD_PKT_STATUS & DSI_GEN_CMD_FULL_MASK);
+
+    dsi->DSI_GEN_HDR = (DSI_DCS_LONG_WRITE_DATA_TYPE << DSI_GEN_DT) | (vc_id << DSI_GEN_VC) | \
+                       ((word_count & 0xFFU) << DSI_GEN_WC_LSBYTE) | \
+                       ((word_count >> 8) << DSI_GEN_WC_MSBYTE);
+}
+
 /**
   \fn          DSI_LANE_STOPSTATE dsi_get_lane_stopstate_status(DSI_Type *dsi, DSI_LANE lane)
   \brief       Get dsi lane stopstate status.
@@ -181,6 +181,91 @@ void i3c_master_rx(I3C_Type *i3c,
   i3c_enqueue_xfer(i3c, xfer);
 }
 
+/**
+  \fn           void i3c_master_list_cmd(I3C_Type *i3c,
+                                         I3C_XFER *xfer,
+                                         uint32_t  index,
+                                         uint8_t   read,
+                                         uint16_t  len,
+                                         uint8_t   last)
+  \brief        send one command of a transfer list to i3c bus,
+                 the response threshold is left to the caller.
+                 Commands other than the last one keep the bus
+                 and the next one follows with a repeated start.
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \param[in]    xfer    : Pointer to i3c transfer structure,
+                            tx_buf holds the data of a write
+  \param[in]    index   : DAT Slave index
+  \param[in]    read    : 1 for a read, 0 for a write
+  \param[in]    len     : Transfer length
+  \param[in]    last    : 1 for the last command, ends with a STOP
+  \return       none
+*/
+void i3c_master_list_cmd(I3C_Type *i3c,
+                         I3C_XFER *xfer,
+                         uint32_t  index,
+                         uint8_t   read,
+                         uint16_t  len,
+                         uint8_t   last)
+{
+  xfer->cmd_hi = COMMAND_PORT_ARG_DATA_LEN(len) |
+                 COMMAND_PORT_TRANSFER_ARG;
+
+  xfer->cmd_lo = COMMAND_PORT_SPEED(0)            |
+                 COMMAND_PORT_DEV_INDEX(index)    |
+                 COMMAND_PORT_ROC;
+
+  if (read)
+  {
+    xfer->cmd_lo |= COMMAND_PORT_READ_TRANSFER |
+                    COMMAND_PORT_TID(I3C_MST_RX_TID);
+  }
+  else
+  {
+    xfer->cmd_lo |= COMMAND_PORT_TID(I3C_MST_TX_TID);
+
+    i3c_wr_tx_fifo(i3c, xfer->tx_buf, len);
+  }
+
+  if (last)
+  {
+    xfer->cmd_lo |= COMMAND_PORT_TOC;
+  }
+
+  i3c->I3C_COMMAND_QUEUE_PORT = xfer->cmd_hi;
+  i3c->I3C_COMMAND_QUEUE_PORT = xfer->cmd_lo;
+}
+
+/**
+  \fn           uint32_t i3c_master_read_resp(I3C_Type *i3c,
+                                              void     *rx_buf,
+                                              uint16_t  size)
+  \brief        read one response, and for a successful read
+                 its data from the RX buffer.
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \param[out]   rx_buf  : Pointer to buffer for read data,
+                            NULL for a write
+  \param[in]    size    : Size of the buffer in bytes
+  \return       Response, see RESPONSE_PORT_xxx
+*/
+uint32_t i3c_master_read_resp(I3C_Type *i3c,
+                              void     *rx_buf,
+                              uint16_t  size)
+{
+  uint32_t resp, len;
+
+  resp = i3c->I3C_RESPONSE_QUEUE_PORT;
+  len  = RESPONSE_PORT_DATA_LEN(resp);
+
+  if (rx_buf && len && !RESPONSE_PORT_ERR_STATUS(resp))
+  {
+    /* the slave may end a read early, never more than asked for */
+    i3c_read_rx_fifo(i3c, rx_buf, (len < size) ? len : size);
+  }
+
+  return resp;
+}
+
 /**
   \fn           void i3c_slave_tx(I3C_Type *i3c,
                                   I3C_XFER *xfer,
@@ -558,6 +643,41 @@ void i3c_slave_init(I3C_Type *i3c, uint8_t slv_addr)
     i3c->I3C_DEVICE_CTRL = i3c->I3C_DEVICE_CTRL | DEV_CTRL_ENABLE;
 }
 
+/**
+  \fn           uint32_t i3c_master_read_ibi(I3C_Type *i3c,
+                                             uint8_t  *data,
+                                             uint32_t  size)
+  \brief        read one entry of the IBI status queue together
+                 with its payload; payload bytes beyond size are
+                 read out of the queue and dropped.
+  \param[in]    i3c     : Pointer to i3c register set structure
+  \param[out]   data    : Pointer to buffer for the IBI payload
+  \param[in]    size    : Size of the buffer in bytes
+  \return       IBI status, see IBI_QUEUE_STATUS_xxx
+*/
+uint32_t i3c_master_read_ibi(I3C_Type *i3c,
+                             uint8_t  *data,
+                             uint32_t  size)
+{
+  uint32_t status, len, i, tmp;
+
+  status = i3c->I3C_IBI_QUEUE_STATUS;
+  len    = IBI_QUEUE_STATUS_DATA_LEN(status);
+
+  /* the payload follows the status in the same queue, in words */
+  for (i = 0; i < len; i += 4)
+  {
+    tmp = i3c->I3C_IBI_QUEUE_DATA;
+
+    if (i < size)
+    {
+      memcpy(data + i, &tmp, ((size - i) < 4) ? (size - i) : 4);
+    }
+  }
+
+  return status;
+}
+
 /**
   \fn           void i3c_irq_handler(I3C_Type *i3c,
                                      I3C_XFER *xfer)
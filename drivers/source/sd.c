@@ -291,6 +291,20 @@ SD_CARD_STATE sd_state(sd_handle_t *pHsd){
     return status;
 }
 
+#ifdef SDMMC_IRQ_MODE
+/**
+  \fn           static uint8_t sd_queue_busy(sd_handle_t *pHsd)
+  \brief        check if queued requests are pending or in transfer; the
+                synchronous calls must not start a transfer under them
+  \param[in]    pHsd - Global SD Handle pointer
+  \return       1 if the request queue is in use
+  */
+static uint8_t sd_queue_busy(sd_handle_t *pHsd){
+
+    return (pHsd->queue.head != NULL) || (pHsd->queue.active != NULL) || pHsd->queue.starting;
+}
+#endif
+
 /**
   \fn           SD_DRV_STATUS SD_read(uint32_t sec, uint32_t blk_cnt, volatile unsigned char * dest_buff)
   \brief        read sd sector
@@ -308,6 +322,11 @@ SD_DRV_STATUS sd_read(uint32_t sec, uint16_t blk_cnt, volatile unsigned char *de
     if(dest_buff == NULL)
         return SD_DRV_STATUS_RD_ERR;
 
+#ifdef SDMMC_IRQ_MODE
+    if(sd_queue_busy(pHsd))
+        return SD_DRV_STATUS_BUSY;
+#endif
+
 #ifdef SDMMC_PRINTF_DEBUG
     printf("SD READ Dest Buff: 0x%p Sec: %u, Block Count: %u\n",dest_buff,sec,blk_cnt);
 #endif
@@ -370,6 +389,11 @@ SD_DRV_STATUS sd_write(uint32_t sector, uint32_t blk_cnt, volatile unsigned char
     if(src_buff == NULL)
         return SD_DRV_STATUS_WR_ERR;
 
+#ifdef SDMMC_IRQ_MODE
+    if(sd_queue_busy(pHsd))
+        return SD_DRV_STATUS_BUSY;
+#endif
+
 #ifdef SDMMC_PRINTF_DEBUG
     printf("SD WRITE Src Buff: 0x%p Sec: %d, Block Count: %d\n",src_buff,sector,blk_cnt);
 #endif
@@ -401,3 +425,379 @@ retry:
     return SD_DRV_STATUS_OK;
 }
 
+
+/**
+  \fn           static uint32_t sd_sg_blk_cnt(const adma2_seg_t *segs, uint32_t nsegs)
+  \brief        get the block count of a segment list
+  \param[in]    segs - buffer segments
+  \param[in]    nsegs - number of segments
+  \return       block count, 0 if the list is empty or not made of whole blocks
+  */
+static uint32_t sd_sg_blk_cnt(const adma2_seg_t *segs, uint32_t nsegs){
+
+    uint32_t total = 0;
+
+    if((segs == NULL) || (nsegs == 0))
+        return 0;
+
+    while(nsegs--){
+        if(segs[nsegs].addr == 0)
+            return 0;
+        total += segs[nsegs].len;
+    }
+
+    if(total % SDMMC_BLK_SIZE_512_Msk)
+        return 0;
+
+    return total / SDMMC_BLK_SIZE_512_Msk;
+}
+
+/**
+  \fn           SD_DRV_STATUS sd_read_sg(uint32_t sec, const adma2_seg_t *segs, uint32_t nsegs)
+  \brief        read consecutive sd sectors into a list of buffers with one
+                multi-block command. Segments are filled in order; their
+                lengths must add up to whole blocks but need not be block
+                sized themselves. More than one segment needs ADMA2 mode.
+  \param[in]    sec - input sector number to read
+  \param[in]    segs - destination buffer segments, word aligned
+  \param[in]    nsegs - number of segments
+  \return       sd driver status
+  */
+SD_DRV_STATUS sd_read_sg(uint32_t sec, const adma2_seg_t *segs, uint32_t nsegs){
+
+    sd_handle_t *pHsd =  &Hsd;
+    uint32_t blk_cnt = sd_sg_blk_cnt(segs, nsegs);
+    uint32_t timeout_cnt = 2000 * blk_cnt;
+    uint32_t seg;
+    uint8_t retry_cnt = 1;
+
+    if((blk_cnt == 0) || (blk_cnt > 0xFFFFU))
+        return SD_DRV_STATUS_RD_ERR;
+
+#ifdef SDMMC_IRQ_MODE
+    if(sd_queue_busy(pHsd))
+        return SD_DRV_STATUS_BUSY;
+#endif
+
+#ifdef SDMMC_PRINTF_DEBUG
+    printf("SD READ SG Segments: %u Sec: %u, Block Count: %u\n",nsegs,sec,blk_cnt);
+#endif
+
+    /* Change the Card State from Tran to Data */
+    pHsd->state = SD_CARD_STATE_DATA;
+
+#ifdef SDMMC_IRQ_MODE
+
+    (void) timeout_cnt;
+    (void) retry_cnt;
+    (void) seg;
+    if(hc_read_setup_sg(pHsd, segs, nsegs, sec, (uint16_t)blk_cnt) != SDMMC_HC_STATUS_OK)
+        return SD_DRV_STATUS_RD_ERR;
+
+#else
+
+retry:
+    if(hc_read_setup_sg(pHsd, segs, nsegs, sec, (uint16_t)blk_cnt) != SDMMC_HC_STATUS_OK)
+        return SD_DRV_STATUS_RD_ERR;
+
+    if(hc_check_xfer_done(pHsd, timeout_cnt) == SDMMC_HC_STATUS_OK){
+        for(seg = 0; seg < nsegs; seg++)
+            RTSS_InvalidateDCache_by_Addr((volatile void *)segs[seg].addr, segs[seg].len);
+    }
+    else{
+        /* Soft reset Host controller cmd and data lines */
+        hc_reset(pHsd, (uint8_t)(SDMMC_SW_RST_DAT_Msk | SDMMC_SW_RST_CMD_Msk));
+
+        if(!retry_cnt--)
+            return SD_DRV_STATUS_RD_ERR;
+        goto retry;
+    }
+#endif
+
+    /* Change the Card State from Data to Tran */
+    pHsd->state = SD_CARD_STATE_TRAN;
+
+    return SD_DRV_STATUS_OK;
+}
+
+/**
+  \fn           SD_DRV_STATUS sd_write_sg(uint32_t sector, const adma2_seg_t *segs, uint32_t nsegs)
+  \brief        write consecutive sd sectors from a list of buffers with one
+                multi-block command, see sd_read_sg()
+  \param[in]    sector - input sector number to write
+  \param[in]    segs - source buffer segments, word aligned
+  \param[in]    nsegs - number of segments
+  \return       sd driver status
+  */
+SD_DRV_STATUS sd_write_sg(uint32_t sector, const adma2_seg_t *segs, uint32_t nsegs){
+
+    sd_handle_t *pHsd =  &Hsd;
+    uint32_t blk_cnt = sd_sg_blk_cnt(segs, nsegs);
+    uint32_t timeout_cnt = 2000 * blk_cnt;
+    uint32_t seg;
+    uint8_t retry_cnt = 1;
+
+    if((blk_cnt == 0) || (blk_cnt > 0xFFFFU))
+        return SD_DRV_STATUS_WR_ERR;
+
+#ifdef SDMMC_IRQ_MODE
+    if(sd_queue_busy(pHsd))
+        return SD_DRV_STATUS_BUSY;
+#endif
+
+#ifdef SDMMC_PRINTF_DEBUG
+    printf("SD WRITE SG Segments: %u Sec: %u, Block Count: %u\n",nsegs,sector,blk_cnt);
+#endif
+
+    /* Clean the DCache */
+    for(seg = 0; seg < nsegs; seg++)
+        RTSS_CleanDCache_by_Addr((volatile void *)segs[seg].addr, segs[seg].len);
+
+retry:
+    if(hc_write_setup_sg(pHsd, segs, nsegs, sector, (uint16_t)blk_cnt) != SDMMC_HC_STATUS_OK)
+        return SD_DRV_STATUS_WR_ERR;
+
+    if(hc_check_xfer_done(pHsd, timeout_cnt) != SDMMC_HC_STATUS_OK){
+        hc_reset(pHsd, (uint8_t)(SDMMC_SW_RST_DAT_Msk | SDMMC_SW_RST_CMD_Msk));
+
+        if(!retry_cnt--)
+            return SD_DRV_STATUS_WR_ERR;
+        goto retry;
+    }
+
+    return SD_DRV_STATUS_OK;
+}
+
+
+#ifdef SDMMC_IRQ_MODE
+/**
+  \fn           static uint8_t sd_queue_can_merge(sd_request_t *prev, sd_request_t *next)
+  \brief        check if a request continues the previous one on the card
+  \param[in]    prev - previous request
+  \param[in]    next - next request
+  \return       1 if both can be done by one multi-block transfer
+  */
+static uint8_t sd_queue_can_merge(sd_request_t *prev, sd_request_t *next){
+
+    return (next->dir == prev->dir) &&
+           (next->sector == prev->sector + prev->blk_cnt);
+}
+
+/**
+  \fn           static uint32_t sd_queue_take(sd_handle_t *pHsd)
+  \brief        move the first pending request, merged with the adjacent ones
+                that follow it, to the active list and build the buffer
+                segment list of the transfer. Requests with buffers apart
+                from each other are merged in ADMA2 mode only.
+  \param[in]    pHsd - Global SD Handle pointer
+  \return       block count of the merged transfer
+  */
+static uint32_t sd_queue_take(sd_handle_t *pHsd){
+
+    sd_queue_t *pq = &pHsd->queue;
+    sd_request_t *last = pq->head, *next;
+    uint32_t blk_cnt = last->blk_cnt;
+    uint32_t len;
+
+    pq->segs[0].addr = (uint32_t)last->buff;
+    pq->segs[0].len  = last->blk_cnt * SDMMC_BLK_SIZE_512_Msk;
+    pq->nsegs = 1;
+
+    while((next = last->next) && sd_queue_can_merge(last, next) &&
+          ((blk_cnt + next->blk_cnt) <= SD_QUEUE_MAX_BLK_CNT)){
+
+        len = next->blk_cnt * SDMMC_BLK_SIZE_512_Msk;
+
+        if(next->buff == last->buff + (last->blk_cnt * SDMMC_BLK_SIZE_512_Msk)){
+            pq->segs[pq->nsegs - 1].len += len;
+        }
+        else if((pHsd->dma_mode == SDMMC_HOST_CTRL1_ADMA2_MODE) && (pq->nsegs < SD_QUEUE_MAX_SEGS)){
+            pq->segs[pq->nsegs].addr = (uint32_t)next->buff;
+            pq->segs[pq->nsegs].len  = len;
+            pq->nsegs++;
+        }
+        else
+            break;
+
+        last = next;
+        blk_cnt += last->blk_cnt;
+    }
+
+    pq->active = pq->head;
+    pq->head   = last->next;
+    if(!pq->head)
+        pq->tail = NULL;
+    last->next = NULL;
+
+    return blk_cnt;
+}
+
+/**
+  \fn           static void sd_queue_finish(sd_handle_t *pHsd, SD_DRV_STATUS status)
+  \brief        complete all requests of the active transfer
+  \param[in]    pHsd - Global SD Handle pointer
+  \param[in]    status - transfer status
+  \return       none
+  */
+static void sd_queue_finish(sd_handle_t *pHsd, SD_DRV_STATUS status){
+
+    sd_request_t *req = pHsd->queue.active, *next;
+
+    pHsd->queue.active = NULL;
+    pHsd->regs->SDMMC_HOST_CTRL1_R &= ~SDMMC_HOST_CTRL1_LED_ON; //led caution off
+    pHsd->state = SD_CARD_STATE_TRAN;
+
+    while(req){
+        /* the callback may submit the request again */
+        next = req->next;
+        req->next = NULL;
+
+        /* drop lines speculatively fetched during the transfer */
+        if(req->dir == SD_REQ_READ)
+            RTSS_InvalidateDCache_by_Addr(req->buff, req->blk_cnt * SDMMC_BLK_SIZE_512_Msk);
+
+        req->status = status;
+        if(req->complete)
+            req->complete(req);
+
+        req = next;
+    }
+}
+
+/**
+  \fn           static void sd_queue_run(sd_handle_t *pHsd)
+  \brief        start the pending requests, unless a transfer is in progress.
+                Called from thread context on submit and from the SDMMC IRQ on
+                completion; the SDMMC IRQ is masked while the queue is updated.
+  \param[in]    pHsd - Global SD Handle pointer
+  \return       none
+  */
+static void sd_queue_run(sd_handle_t *pHsd){
+
+    sd_queue_t *pq = &pHsd->queue;
+    sd_request_t *req;
+    uint32_t blk_cnt;
+    SDMMC_HC_STATUS ret;
+
+    NVIC_DisableIRQ(SDMMC_IRQ_NUM);
+
+    if(pq->active || pq->starting){
+        /* the running transfer or start loop picks the new requests up */
+        NVIC_EnableIRQ(SDMMC_IRQ_NUM);
+        return;
+    }
+
+    pq->starting = 1;
+
+    while(!pq->active && pq->head){
+
+        blk_cnt = sd_queue_take(pHsd);
+        req = pq->active;
+        pq->data_phase = 1;
+
+        NVIC_EnableIRQ(SDMMC_IRQ_NUM);
+
+#ifdef SDMMC_PRINTF_DEBUG
+        printf("SD QUEUE %s Buff: 0x%p Segments: %u Sec: %u, Block Count: %u\n",
+               (req->dir == SD_REQ_READ) ? "READ" : "WRITE", req->buff, pq->nsegs, req->sector, blk_cnt);
+#endif
+
+        if(req->dir == SD_REQ_READ){
+            pHsd->state = SD_CARD_STATE_DATA;
+            ret = hc_read_setup_sg(pHsd, pq->segs, pq->nsegs, req->sector, blk_cnt);
+        }else{
+            pHsd->state = SD_CARD_STATE_RCV;
+            ret = hc_write_setup_sg(pHsd, pq->segs, pq->nsegs, req->sector, blk_cnt);
+        }
+
+        NVIC_DisableIRQ(SDMMC_IRQ_NUM);
+
+        /* on command errors the IRQ may have completed the transfer already */
+        if((ret != SDMMC_HC_STATUS_OK) && (pq->active == req)){
+            pq->data_phase = 0;
+            hc_reset(pHsd, (uint8_t)(SDMMC_SW_RST_DAT_Msk | SDMMC_SW_RST_CMD_Msk));
+            sd_queue_finish(pHsd, (req->dir == SD_REQ_READ) ? SD_DRV_STATUS_RD_ERR : SD_DRV_STATUS_WR_ERR);
+        }
+    }
+
+    pq->starting = 0;
+
+    NVIC_EnableIRQ(SDMMC_IRQ_NUM);
+}
+
+/**
+  \fn           void sd_queue_xfer_done(sd_handle_t *pHsd, SDMMC_HC_STATUS hc_status)
+  \brief        data phase of the active transfer is over, called from the SDMMC IRQ
+  \param[in]    pHsd - Global SD Handle pointer
+  \param[in]    hc_status - Host controller transfer status
+  \return       none
+  */
+void sd_queue_xfer_done(sd_handle_t *pHsd, SDMMC_HC_STATUS hc_status){
+
+    SD_DRV_STATUS status = SD_DRV_STATUS_OK;
+
+    if(!pHsd->queue.active)
+        return;
+
+    if(hc_status != SDMMC_HC_STATUS_OK)
+        status = (pHsd->queue.active->dir == SD_REQ_READ) ? SD_DRV_STATUS_RD_ERR : SD_DRV_STATUS_WR_ERR;
+
+    sd_queue_finish(pHsd, status);
+
+    /* start the next transfer while still in the IRQ handler */
+    if(!pHsd->queue.starting)
+        sd_queue_run(pHsd);
+}
+
+/**
+  \fn           SD_DRV_STATUS sd_submit(sd_request_t *req)
+  \brief        queue an asynchronous block read or write. Requests are served
+                in order; a request that continues the previous one on the
+                card is merged with it into one CMD18/CMD25 multi-block
+                transfer, scattered over the request buffers in ADMA2 mode. The request status reads
+                SD_DRV_STATUS_BUSY until the complete callback is called.
+                To be called from thread context or a complete callback.
+  \param[in]    req - block request, owned by the driver until completed
+  \return       sd driver status
+  */
+SD_DRV_STATUS sd_submit(sd_request_t *req){
+
+    sd_handle_t *pHsd = &Hsd;
+    sd_queue_t *pq = &pHsd->queue;
+    SD_DRV_STATUS errcode;
+
+    if(req == NULL)
+        return SD_DRV_STATUS_RD_ERR;
+
+    errcode = (req->dir == SD_REQ_READ) ? SD_DRV_STATUS_RD_ERR : SD_DRV_STATUS_WR_ERR;
+
+    /* buffers are cleaned/invalidated per request: they must not share a
+     * 32-byte cache line with other data, which also suits the DMA */
+    if((req->buff == NULL) || ((uint32_t)req->buff & 0x1FU) ||
+       (req->blk_cnt == 0) || (req->blk_cnt > SD_QUEUE_MAX_BLK_CNT))
+        return errcode;
+
+    /* cache maintenance is done per request, merged or not */
+    if(req->dir == SD_REQ_WRITE)
+        RTSS_CleanDCache_by_Addr(req->buff, req->blk_cnt * SDMMC_BLK_SIZE_512_Msk);
+    else
+        RTSS_InvalidateDCache_by_Addr(req->buff, req->blk_cnt * SDMMC_BLK_SIZE_512_Msk);
+
+    req->status = SD_DRV_STATUS_BUSY;
+    req->next   = NULL;
+
+    NVIC_DisableIRQ(SDMMC_IRQ_NUM);
+
+    if(pq->tail)
+        pq->tail->next = req;
+    else
+        pq->head = req;
+    pq->tail = req;
+
+    NVIC_EnableIRQ(SDMMC_IRQ_NUM);
+
+    sd_queue_run(pHsd);
+
+    return SD_DRV_STATUS_OK;
+}
+#endif
@@ -0,0 +1,966 @@
+/* Copyright (C) 2024 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**************************************************************************//**
+ * @file     sd_cache.c
+ * @version  V0.0.1
+ * @brief    SD sector cache with read-ahead and write-back.
+ *           Sits between the filesystem and the SD driver: recently used
+ *           sectors (FAT, directories) are served from memory, sequential
+ *           reads are prefetched and, in write-back mode, written sectors are
+ *           held until flushed in multi-block writes that do not cross an
+ *           erase block.
+ * @bug      None.
+ * @Note     Not reentrant, to be called from one thread.
+ ******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "sd_cache.h"
+#include "string.h"
+
+extern sd_handle_t Hsd;
+
+/* Max blocks of one card access from a single buffer */
+#define SD_CACHE_DIRECT_MAX_BLK_CNT     1024U
+
+/**
+ * @brief  SD cache state
+ */
+typedef struct _sd_cache_t{
+    sd_cache_config_t       cfg;                            /*!< Configuration                  */
+    uint16_t                hash[SD_CACHE_HASH_SIZE];       /*!< Valid lines by sector          */
+    uint16_t                mru;                            /*!< Most recently used line        */
+    uint16_t                lru;                            /*!< Least recently used line       */
+    uint32_t                seq_next;                       /*!< Sector a sequential read hits  */
+    uint32_t                seq_cnt;                        /*!< Sequential reads in a row      */
+#ifdef SDMMC_IRQ_MODE
+    sd_request_t            ra_req[SD_CACHE_RA_MAX];        /*!< Read-ahead requests            */
+    uint16_t                ra_line[SD_CACHE_RA_MAX];       /*!< Line of each read-ahead request */
+#endif
+    sd_cache_stats_t        stats;                          /*!< Counters                       */
+    uint8_t                 ready;                          /*!< Initialized                    */
+}sd_cache_t;
+
+static sd_cache_t sd_cache;
+
+#ifdef SDMMC_IRQ_MODE
+/* Bounce buffer for direct transfers of buffers off a cache line boundary */
+static uint8_t sd_cache_bounce[SDMMC_BLK_SIZE_512_Msk] __attribute__((section("sd_dma_buf"))) __attribute__((aligned(32)));
+#endif
+
+static SD_DRV_STATUS sd_cache_flush_range(uint32_t first, uint32_t last);
+
+/**
+  \fn           static inline uint8_t *sd_cache_line_data(uint16_t idx)
+  \brief        get the buffer of a cache line
+  \param[in]    idx - line index
+  \return       line buffer
+  */
+static inline uint8_t *sd_cache_line_data(uint16_t idx){
+    return sd_cache.cfg.data + ((uint32_t)idx * SDMMC_BLK_SIZE_512_Msk);
+}
+
+/**
+  \fn           static uint16_t sd_cache_find(uint32_t sector)
+  \brief        look a sector up in the cache
+  \param[in]    sector - sector number
+  \return       line index, SD_CACHE_LINE_NONE if not cached
+  */
+static uint16_t sd_cache_find(uint32_t sector){
+
+    sd_cache_line_t *lines = sd_cache.cfg.lines;
+    uint16_t idx = sd_cache.hash[sector & (SD_CACHE_HASH_SIZE - 1)];
+
+    while((idx != SD_CACHE_LINE_NONE) && (lines[idx].sector != sector))
+        idx = lines[idx].hnext;
+
+    return idx;
+}
+
+/**
+  \fn           static void sd_cache_hash_insert(uint16_t idx)
+  \brief        make a line visible to sd_cache_find()
+  \param[in]    idx - line index
+  \return       none
+  */
+static void sd_cache_hash_insert(uint16_t idx){
+
+    sd_cache_line_t *line = &sd_cache.cfg.lines[idx];
+    uint16_t *bucket = &sd_cache.hash[line->sector & (SD_CACHE_HASH_SIZE - 1)];
+
+    line->hnext = *bucket;
+    *bucket = idx;
+}
+
+/**
+  \fn           static void sd_cache_drop(uint16_t idx)
+  \brief        remove a line from the cache, its data is lost
+  \param[in]    idx - line index
+  \return       none
+  */
+static void sd_cache_drop(uint16_t idx){
+
+    sd_cache_line_t *lines = sd_cache.cfg.lines;
+    uint16_t *p;
+
+    if(lines[idx].flags & SD_CACHE_LINE_VALID){
+
+        p = &sd_cache.hash[lines[idx].sector & (SD_CACHE_HASH_SIZE - 1)];
+
+        while(*p != SD_CACHE_LINE_NONE){
+            if(*p == idx){
+                *p = lines[idx].hnext;
+                break;
+            }
+            p = &lines[*p].hnext;
+        }
+    }
+
+    lines[idx].flags = 0;
+}
+
+/**
+  \fn           static void sd_cache_touch(uint16_t idx)
+  \brief        move a line to the most recently used end of the LRU list
+  \param[in]    idx - line index
+  \return       none
+  */
+static void sd_cache_touch(uint16_t idx){
+
+    sd_cache_line_t *lines = sd_cache.cfg.lines;
+    sd_cache_line_t *line = &lines[idx];
+
+    if(sd_cache.mru == idx)
+        return;
+
+    /* unlink, the line has a previous one as it is not the MRU */
+    lines[line->prev].next = line->next;
+    if(line->next != SD_CACHE_LINE_NONE)
+        lines[line->next].prev = line->prev;
+    else
+        sd_cache.lru = line->prev;
+
+    line->prev = SD_CACHE_LINE_NONE;
+    line->next = sd_cache.mru;
+    lines[sd_cache.mru].prev = idx;
+    sd_cache.mru = idx;
+}
+
+#ifdef SDMMC_IRQ_MODE
+/**
+  \fn           static void sd_cache_ra_done(uint32_t slot)
+  \brief        retire a completed read-ahead request
+  \param[in]    slot - read-ahead request index
+  \return       none
+  */
+static void sd_cache_ra_done(uint32_t slot){
+
+    uint16_t idx = sd_cache.ra_line[slot];
+
+    sd_cache.ra_line[slot] = SD_CACHE_LINE_NONE;
+    sd_cache.cfg.lines[idx].flags &= ~SD_CACHE_LINE_PENDING;
+
+    if((sd_cache.ra_req[slot].status != SD_DRV_STATUS_OK) ||
+       (sd_cache.cfg.lines[idx].flags & SD_CACHE_LINE_STALE))
+        sd_cache_drop(idx);
+}
+
+/**
+  \fn           static void sd_cache_ra_poll(void)
+  \brief        retire the read-ahead requests completed by the SDMMC IRQ
+  \return       none
+  */
+static void sd_cache_ra_poll(void){
+
+    uint32_t slot;
+
+    for(slot = 0; slot < SD_CACHE_RA_MAX; slot++){
+        if((sd_cache.ra_line[slot] != SD_CACHE_LINE_NONE) &&
+           (sd_cache.ra_req[slot].status != SD_DRV_STATUS_BUSY))
+            sd_cache_ra_done(slot);
+    }
+}
+#endif
+
+/**
+  \fn           static SD_DRV_STATUS sd_cache_wait(uint16_t idx)
+  \brief        wait for the read-ahead of a line, the line is dropped if it
+                failed. On timeout the line stays pending, owned by the SD
+                request queue.
+  \param[in]    idx - line index
+  \return       SD_DRV_STATUS_OK, SD_DRV_STATUS_TIMEOUT_ERR
+  */
+static SD_DRV_STATUS sd_cache_wait(uint16_t idx){
+
+#ifdef SDMMC_IRQ_MODE
+    uint32_t timeout = SD_CACHE_WAIT_TIMEOUT_US;
+    uint32_t slot;
+
+    if(!(sd_cache.cfg.lines[idx].flags & SD_CACHE_LINE_PENDING))
+        return SD_DRV_STATUS_OK;
+
+    slot = sd_cache.cfg.lines[idx].ra_slot;
+
+    /* completed by the SDMMC IRQ, on errors too */
+    while(sd_cache.ra_req[slot].status == SD_DRV_STATUS_BUSY){
+        if(!timeout--)
+            return SD_DRV_STATUS_TIMEOUT_ERR;
+        sys_busy_loop_us(1);
+    }
+
+    sd_cache_ra_done(slot);
+#else
+    (void) idx;
+#endif
+
+    return SD_DRV_STATUS_OK;
+}
+
+/**
+  \fn           static uint8_t sd_cache_seg_add(adma2_seg_t *segs, uint32_t *nsegs, uint8_t *data)
+  \brief        append a sector buffer to a segment list, buffers that follow
+                each other in memory share one segment
+  \param[in]    segs - segment list of SD_CACHE_IO_BATCH entries
+  \param[in]    nsegs - number of segments in use
+  \param[in]    data - sector buffer
+  \return       0 if the list is full
+  */
+static uint8_t sd_cache_seg_add(adma2_seg_t *segs, uint32_t *nsegs, uint8_t *data){
+
+    adma2_seg_t *last;
+
+    if(*nsegs){
+        last = &segs[*nsegs - 1];
+        if(((last->addr + last->len) == (uint32_t)data) &&
+           (last->len < (SD_CACHE_DIRECT_MAX_BLK_CNT * SDMMC_BLK_SIZE_512_Msk))){
+            last->len += SDMMC_BLK_SIZE_512_Msk;
+            return 1;
+        }
+    }
+
+    if(*nsegs == SD_CACHE_IO_BATCH)
+        return 0;
+
+    segs[*nsegs].addr = (uint32_t)data;
+    segs[*nsegs].len  = SDMMC_BLK_SIZE_512_Msk;
+    (*nsegs)++;
+
+    return 1;
+}
+
+/**
+  \fn           static SD_DRV_STATUS sd_cache_io(uint8_t write, uint32_t sector, const adma2_seg_t *segs, uint32_t nsegs)
+  \brief        read or write consecutive sectors from or to a list of buffers
+                and wait for the end of the transfer
+  \param[in]    write - 0: read, 1: write
+  \param[in]    sector - first sector
+  \param[in]    segs - buffer segments, whole blocks each
+  \param[in]    nsegs - number of segments, up to SD_CACHE_IO_BATCH
+  \return       sd driver status
+  */
+static SD_DRV_STATUS sd_cache_io(uint8_t write, uint32_t sector, const adma2_seg_t *segs, uint32_t nsegs){
+
+    SD_DRV_STATUS errcode = write ? SD_DRV_STATUS_WR_ERR : SD_DRV_STATUS_RD_ERR;
+    uint32_t seg;
+
+#ifdef SDMMC_IRQ_MODE
+    /* the SD driver is owned by the request queue in IRQ mode: one request
+     * per segment, merged back into one transfer by the queue */
+    sd_request_t req[SD_CACHE_IO_BATCH];
+    SD_DRV_STATUS status = SD_DRV_STATUS_OK;
+    uint32_t num;
+
+    for(seg = 0; seg < nsegs; seg++){
+
+        req[seg].sector   = sector;
+        req[seg].blk_cnt  = segs[seg].len / SDMMC_BLK_SIZE_512_Msk;
+        req[seg].buff     = (volatile uint8_t *)segs[seg].addr;
+        req[seg].dir      = write ? SD_REQ_WRITE : SD_REQ_READ;
+        req[seg].complete = NULL;
+        req[seg].context  = NULL;
+
+        if(sd_submit(&req[seg]) != SD_DRV_STATUS_OK){
+            status = errcode;
+            break;
+        }
+
+        sector += req[seg].blk_cnt;
+    }
+
+    /* the requests live on the stack, wait for all of them */
+    for(num = seg, seg = 0; seg < num; seg++){
+        while(req[seg].status == SD_DRV_STATUS_BUSY);
+
+        if(req[seg].status != SD_DRV_STATUS_OK)
+            status = errcode;
+    }
+
+    return status;
+#else
+    if(Hsd.dma_mode == SDMMC_HOST_CTRL1_ADMA2_MODE)
+        return write ? sd_write_sg(sector, segs, nsegs) : sd_read_sg(sector, segs, nsegs);
+
+    /* SDMA takes one contiguous buffer per command */
+    for(seg = 0; seg < nsegs; seg++){
+
+        if((write ? sd_write_sg(sector, &segs[seg], 1) : sd_read_sg(sector, &segs[seg], 1)) != SD_DRV_STATUS_OK)
+            return errcode;
+
+        sector += segs[seg].len / SDMMC_BLK_SIZE_512_Msk;
+    }
+
+    return SD_DRV_STATUS_OK;
+#endif
+}
+
+/**
+  \fn           static SD_DRV_STATUS sd_cache_direct(uint8_t write, uint32_t sector, uint32_t blk_cnt, uint8_t *buff)
+  \brief        read or write sectors straight from or to the user buffer
+  \param[in]    write - 0: read, 1: write
+  \param[in]    sector - first sector
+  \param[in]    blk_cnt - number of sectors
+  \param[in]    buff - user buffer, word aligned
+  \return       sd driver status
+  */
+static SD_DRV_STATUS sd_cache_direct(uint8_t write, uint32_t sector, uint32_t blk_cnt, uint8_t *buff){
+
+    adma2_seg_t seg;
+    uint32_t cnt;
+
+#ifdef SDMMC_IRQ_MODE
+    /* queued requests take cache line aligned buffers only: go through the
+     * bounce buffer, one sector at a time, for the others */
+    if((uint32_t)buff & 0x1FU){
+
+        seg.addr = (uint32_t)sd_cache_bounce;
+        seg.len  = SDMMC_BLK_SIZE_512_Msk;
+
+        for(; blk_cnt; blk_cnt--, sector++, buff += SDMMC_BLK_SIZE_512_Msk){
+
+            if(write)
+                memcpy(sd_cache_bounce, buff, SDMMC_BLK_SIZE_512_Msk);
+
+            if(sd_cache_io(write, sector, &seg, 1) != SD_DRV_STATUS_OK)
+                return write ? SD_DRV_STATUS_WR_ERR : SD_DRV_STATUS_RD_ERR;
+
+            if(!write)
+                memcpy(buff, sd_cache_bounce, SDMMC_BLK_SIZE_512_Msk);
+        }
+
+        return SD_DRV_STATUS_OK;
+    }
+#endif
+
+    while(blk_cnt){
+
+        cnt = (blk_cnt > SD_CACHE_DIRECT_MAX_BLK_CNT) ? SD_CACHE_DIRECT_MAX_BLK_CNT : blk_cnt;
+
+        seg.addr = (uint32_t)buff;
+        seg.len  = cnt * SDMMC_BLK_SIZE_512_Msk;
+
+        if(sd_cache_io(write, sector, &seg, 1) != SD_DRV_STATUS_OK)
+            return write ? SD_DRV_STATUS_WR_ERR : SD_DRV_STATUS_RD_ERR;
+
+        if(write)
+            sd_cache.stats.card_writes++;
+
+        sector  += cnt;
+        buff    += seg.len;
+        blk_cnt -= cnt;
+    }
+
+    return SD_DRV_STATUS_OK;
+}
+
+/**
+  \fn           static uint16_t sd_cache_alloc(void)
+  \brief        take the least recently used line that is not in use, dirty
+                lines are written back first together with the dirty lines of
+                their erase block
+  \return       locked line, not hashed, SD_CACHE_LINE_NONE if none is free
+  */
+static uint16_t sd_cache_alloc(void){
+
+    sd_cache_line_t *lines = sd_cache.cfg.lines;
+    uint32_t first;
+    uint16_t idx;
+
+    for(idx = sd_cache.lru; idx != SD_CACHE_LINE_NONE; idx = lines[idx].prev){
+
+        if(lines[idx].flags & (SD_CACHE_LINE_PENDING | SD_CACHE_LINE_LOCKED))
+            continue;
+
+        if(lines[idx].flags & SD_CACHE_LINE_DIRTY){
+            first = lines[idx].sector & ~(sd_cache.cfg.erase_blk_cnt - 1U);
+
+            /* keep the data if the write fails, try the next line */
+            if(sd_cache_flush_range(first, first + (sd_cache.cfg.erase_blk_cnt - 1U)) != SD_DRV_STATUS_OK)
+                continue;
+        }
+
+        sd_cache_drop(idx);
+        lines[idx].flags = SD_CACHE_LINE_LOCKED;
+        sd_cache_touch(idx);
+
+        return idx;
+    }
+
+    return SD_CACHE_LINE_NONE;
+}
+
+/**
+  \fn           static uint32_t sd_cache_fill(uint32_t sector, uint32_t cnt, uint16_t *run)
+  \brief        read missing consecutive sectors into free lines with one transfer
+  \param[in]    sector - first sector, not cached
+  \param[in]    cnt - number of sectors, not cached
+  \param[out]   run - lines filled, SD_CACHE_IO_BATCH entries
+  \return       number of sectors read, 0 on error
+  */
+static uint32_t sd_cache_fill(uint32_t sector, uint32_t cnt, uint16_t *run){
+
+    sd_cache_line_t *lines = sd_cache.cfg.lines;
+    adma2_seg_t segs[SD_CACHE_IO_BATCH];
+    uint32_t num = 0, nsegs = 0, i;
+    uint16_t idx;
+
+    if(cnt > SD_CACHE_IO_BATCH)
+        cnt = SD_CACHE_IO_BATCH;
+
+    while(num < cnt){
+        idx = sd_cache_alloc();
+        if(idx == SD_CACHE_LINE_NONE)
+            break;
+
+        run[num++] = idx;
+        sd_cache_seg_add(segs, &nsegs, sd_cache_line_data(idx));
+    }
+
+    if(num == 0)
+        return 0;
+
+    if(sd_cache_io(0, sector, segs, nsegs) != SD_DRV_STATUS_OK){
+        for(i = 0; i < num; i++)
+            lines[run[i]].flags = 0;
+        return 0;
+    }
+
+    for(i = 0; i < num; i++){
+        lines[run[i]].sector = sector + i;
+        lines[run[i]].flags  = SD_CACHE_LINE_VALID;
+        sd_cache_hash_insert(run[i]);
+    }
+
+    return num;
+}
+
+/**
+  \fn           static void sd_cache_prefetch(uint32_t sector, uint32_t cnt)
+  \brief        read ahead the sectors that are not cached yet. In IRQ mode
+                the reads are queued and the call returns at once; the lines
+                are pending until the SDMMC IRQ completes them.
+  \param[in]    sector - first sector
+  \param[in]    cnt - number of sectors
+  \return       none
+  */
+static void sd_cache_prefetch(uint32_t sector, uint32_t cnt){
+
+    sd_cache_line_t *lines = sd_cache.cfg.lines;
+
+#ifdef SDMMC_IRQ_MODE
+    sd_request_t *req;
+    uint32_t slot = 0;
+    uint16_t idx;
+
+    for(; cnt; cnt--, sector++){
+
+        if(sd_cache_find(sector) != SD_CACHE_LINE_NONE)
+            continue;
+
+        while((slot < SD_CACHE_RA_MAX) && (sd_cache.ra_line[slot] != SD_CACHE_LINE_NONE))
+            slot++;
+
+        if(slot == SD_CACHE_RA_MAX)
+            break;
+
+        idx = sd_cache_alloc();
+        if(idx == SD_CACHE_LINE_NONE)
+            break;
+
+        lines[idx].sector  = sector;
+        lines[idx].flags   = SD_CACHE_LINE_VALID | SD_CACHE_LINE_PENDING | SD_CACHE_LINE_PREFETCHED;
+        lines[idx].ra_slot = (uint8_t)slot;
+        sd_cache_hash_insert(idx);
+
+        req = &sd_cache.ra_req[slot];
+        req->sector   = sector;
+        req->blk_cnt  = 1;
+        req->buff     = sd_cache_line_data(idx);
+        req->dir      = SD_REQ_READ;
+        req->complete = NULL;
+        req->context  = NULL;
+
+        sd_cache.ra_line[slot] = idx;
+
+        if(sd_submit(req) != SD_DRV_STATUS_OK){
+            sd_cache.ra_line[slot] = SD_CACHE_LINE_NONE;
+            sd_cache_drop(idx);
+            break;
+        }
+
+        sd_cache.stats.ra_sectors++;
+    }
+#else
+    uint16_t run[SD_CACHE_IO_BATCH];
+    uint32_t miss, num, i;
+
+    while(cnt){
+
+        if(sd_cache_find(sector) != SD_CACHE_LINE_NONE){
+            sector++;
+            cnt--;
+            continue;
+        }
+
+        for(miss = 1; (miss < cnt) && (sd_cache_find(sector + miss) == SD_CACHE_LINE_NONE); miss++);
+
+        num = sd_cache_fill(sector, miss, run);
+        if(num == 0)
+            break;
+
+        for(i = 0; i < num; i++)
+            lines[run[i]].flags |= SD_CACHE_LINE_PREFETCHED;
+
+        sd_cache.stats.ra_sectors += num;
+        sector += num;
+        cnt    -= num;
+    }
+#endif
+}
+
+/**
+  \fn           static SD_DRV_STATUS sd_cache_flush_range(uint32_t first, uint32_t last)
+  \brief        write back the dirty lines of a sector range. Runs of
+                consecutive dirty sectors go out as one multi-block write,
+                split at erase block boundaries.
+  \param[in]    first - first sector of the range
+  \param[in]    last - last sector of the range
+  \return       sd driver status
+  */
+static SD_DRV_STATUS sd_cache_flush_range(uint32_t first, uint32_t last){
+
+    sd_cache_line_t *lines = sd_cache.cfg.lines;
+    adma2_seg_t segs[SD_CACHE_IO_BATCH];
+    uint32_t erase_msk = sd_cache.cfg.erase_blk_cnt - 1U;
+    uint32_t start, sector, nsegs;
+    SD_DRV_STATUS status;
+    uint8_t found;
+    uint16_t idx;
+
+    for(;;){
+
+        /* lowest dirty sector left in the range */
+        start = last;
+        found = 0;
+        for(idx = 0; idx < sd_cache.cfg.num_lines; idx++){
+            if((lines[idx].flags & SD_CACHE_LINE_DIRTY) && !(lines[idx].flags & SD_CACHE_LINE_LOCKED) &&
+               (lines[idx].sector >= first) && (lines[idx].sector <= start)){
+                start = lines[idx].sector;
+                found = 1;
+            }
+        }
+
+        if(!found)
+            return SD_DRV_STATUS_OK;
+
+        /* gather the dirty sectors that follow it */
+        nsegs  = 0;
+        sector = start;
+        do{
+            idx = sd_cache_find(sector);
+            if((idx == SD_CACHE_LINE_NONE) || !(lines[idx].flags & SD_CACHE_LINE_DIRTY) ||
+               (lines[idx].flags & SD_CACHE_LINE_LOCKED))
+                break;
+
+            if(!sd_cache_seg_add(segs, &nsegs, sd_cache_line_data(idx)))
+                break;
+
+            lines[idx].flags |= SD_CACHE_LINE_LOCKED;
+            sector++;
+        }while((sector <= last) && (sector & erase_msk));
+
+        status = sd_cache_io(1, start, segs, nsegs);
+        sd_cache.stats.card_writes++;
+
+        for(; start != sector; start++){
+            idx = sd_cache_find(start);
+            lines[idx].flags &= ~SD_CACHE_LINE_LOCKED;
+            if(status == SD_DRV_STATUS_OK)
+                lines[idx].flags &= ~SD_CACHE_LINE_DIRTY;
+        }
+
+        if(status != SD_DRV_STATUS_OK)
+            return SD_DRV_STATUS_WR_ERR;
+
+        /* wrapped past the last sector of the card */
+        if((sector == 0) || (sector > last))
+            return SD_DRV_STATUS_OK;
+
+        first = sector;
+    }
+}
+
+/**
+  \fn           SD_DRV_STATUS sd_cache_init(const sd_cache_config_t *cfg)
+  \brief        initialize the sector cache, the cache starts empty.
+                Dirty data of a previous configuration is lost, call
+                sd_cache_flush() before.
+  \param[in]    cfg - cache configuration, copied
+  \return       sd driver status
+  */
+SD_DRV_STATUS sd_cache_init(const sd_cache_config_t *cfg){
+
+    uint16_t idx;
+
+    if((cfg == NULL) || (cfg->data == NULL) || (cfg->lines == NULL) ||
+       ((uint32_t)cfg->data & 0x1FU) ||
+       (cfg->num_lines < 2) || (cfg->num_lines >= SD_CACHE_LINE_NONE) ||
+       (cfg->read_ahead > SD_CACHE_RA_MAX) ||
+       (cfg->erase_blk_cnt == 0) || (cfg->erase_blk_cnt & (cfg->erase_blk_cnt - 1U)))
+        return SD_DRV_STATUS_HOST_INIT_ERR;
+
+    if(sd_cache.ready)
+        sd_cache_invalidate();
+
+    memset(&sd_cache, 0, sizeof(sd_cache));
+    sd_cache.cfg = *cfg;
+
+    for(idx = 0; idx < SD_CACHE_HASH_SIZE; idx++)
+        sd_cache.hash[idx] = SD_CACHE_LINE_NONE;
+
+#ifdef SDMMC_IRQ_MODE
+    for(idx = 0; idx < SD_CACHE_RA_MAX; idx++)
+        sd_cache.ra_line[idx] = SD_CACHE_LINE_NONE;
+#endif
+
+    /* all lines free, in index order */
+    for(idx = 0; idx < cfg->num_lines; idx++){
+        cfg->lines[idx].flags = 0;
+        cfg->lines[idx].hnext = SD_CACHE_LINE_NONE;
+        cfg->lines[idx].prev  = idx ? (uint16_t)(idx - 1U) : SD_CACHE_LINE_NONE;
+        cfg->lines[idx].next  = ((idx + 1U) < cfg->num_lines) ? (uint16_t)(idx + 1U) : SD_CACHE_LINE_NONE;
+    }
+
+    sd_cache.mru      = 0;
+    sd_cache.lru      = cfg->num_lines - 1;
+    sd_cache.seq_next = ~0U;
+    sd_cache.ready    = 1;
+
+    return SD_DRV_STATUS_OK;
+}
+
+/**
+  \fn           SD_DRV_STATUS sd_cache_read(uint32_t sector, uint32_t blk_cnt, volatile uint8_t *buff)
+  \brief        read sectors through the cache. Missing sectors are read in
+                multi-block transfers; after SD_CACHE_SEQ_THRESHOLD sequential
+                reads the sectors that follow are read ahead.
+  \param[in]    sector - first sector
+  \param[in]    blk_cnt - number of sectors
+  \param[out]   buff - destination buffer, word aligned
+  \return       sd driver status
+  */
+SD_DRV_STATUS sd_cache_read(uint32_t sector, uint32_t blk_cnt, volatile uint8_t *buff){
+
+    sd_cache_line_t *lines = sd_cache.cfg.lines;
+    uint8_t *dst = (uint8_t *)buff;
+    uint16_t run[SD_CACHE_IO_BATCH];
+    uint32_t end = sector + blk_cnt;
+    uint32_t sec, miss, num, i;
+    uint16_t idx;
+
+    if(!sd_cache.ready || (buff == NULL) || (blk_cnt == 0))
+        return SD_DRV_STATUS_RD_ERR;
+
+#ifdef SDMMC_IRQ_MODE
+    sd_cache_ra_poll();
+#endif
+
+    sd_cache.seq_cnt  = (sector == sd_cache.seq_next) ? (sd_cache.seq_cnt + 1) : 1;
+    sd_cache.seq_next = end;
+
+    if(sd_cache.cfg.bypass_blk_cnt && (blk_cnt >= sd_cache.cfg.bypass_blk_cnt)){
+
+        /* the card must hold the latest data */
+        if(sd_cache_flush_range(sector, end - 1) != SD_DRV_STATUS_OK)
+            return SD_DRV_STATUS_RD_ERR;
+
+        sd_cache.stats.bypass += blk_cnt;
+
+        return sd_cache_direct(0, sector, blk_cnt, dst);
+    }
+
+    for(sec = sector; sec != end;){
+
+        idx = sd_cache_find(sec);
+
+        if(idx != SD_CACHE_LINE_NONE){
+
+            if(sd_cache_wait(idx) != SD_DRV_STATUS_OK)
+                return SD_DRV_STATUS_TIMEOUT_ERR;
+
+            /* read-ahead failed, read it again */
+            if(!(lines[idx].flags & SD_CACHE_LINE_VALID))
+                continue;
+
+            if(lines[idx].flags & SD_CACHE_LINE_PREFETCHED){
+                lines[idx].flags &= ~SD_CACHE_LINE_PREFETCHED;
+                sd_cache.stats.ra_hits++;
+            }
+
+            memcpy(dst, sd_cache_line_data(idx), SDMMC_BLK_SIZE_512_Msk);
+            sd_cache_touch(idx);
+            sd_cache.stats.read_hits++;
+
+            dst += SDMMC_BLK_SIZE_512_Msk;
+            sec++;
+            continue;
+        }
+
+        for(miss = 1; ((sec + miss) != end) && (miss < SD_CACHE_IO_BATCH) &&
+                      (sd_cache_find(sec + miss) == SD_CACHE_LINE_NONE); miss++);
+
+        num = sd_cache_fill(sec, miss, run);
+
+        if(num){
+            for(i = 0; i < num; i++)
+                memcpy(dst + (i * SDMMC_BLK_SIZE_512_Msk), sd_cache_line_data(run[i]), SDMMC_BLK_SIZE_512_Msk);
+        }
+        else{
+            /* no line to spare */
+            if(sd_cache_direct(0, sec, 1, dst) != SD_DRV_STATUS_OK)
+                return SD_DRV_STATUS_RD_ERR;
+            num = 1;
+        }
+
+        sd_cache.stats.read_misses += num;
+        dst += num * SDMMC_BLK_SIZE_512_Msk;
+        sec += num;
+    }
+
+    if(sd_cache.cfg.read_ahead && (sd_cache.seq_cnt >= SD_CACHE_SEQ_THRESHOLD))
+        sd_cache_prefetch(end, sd_cache.cfg.read_ahead);
+
+    return SD_DRV_STATUS_OK;
+}
+
+/**
+  \fn           SD_DRV_STATUS sd_cache_write(uint32_t sector, uint32_t blk_cnt, volatile uint8_t *buff)
+  \brief        write sectors through the cache. In write-back mode the data
+                is kept in the cache until its line is reused or
+                sd_cache_flush() is called; otherwise it is written to the
+                card at once and cached copies are updated.
+  \param[in]    sector - first sector
+  \param[in]    blk_cnt - number of sectors
+  \param[in]    buff - source buffer, word aligned
+  \return       sd driver status
+  */
+SD_DRV_STATUS sd_cache_write(uint32_t sector, uint32_t blk_cnt, volatile uint8_t *buff){
+
+    sd_cache_line_t *lines = sd_cache.cfg.lines;
+    uint8_t *src = (uint8_t *)buff;
+    uint32_t i;
+    uint16_t idx;
+
+    if(!sd_cache.ready || (buff == NULL) || (blk_cnt == 0))
+        return SD_DRV_STATUS_WR_ERR;
+
+#ifdef SDMMC_IRQ_MODE
+    sd_cache_ra_poll();
+#endif
+
+    sd_cache.stats.writes += blk_cnt;
+
+    if(!sd_cache.cfg.write_back ||
+       (sd_cache.cfg.bypass_blk_cnt && (blk_cnt >= sd_cache.cfg.bypass_blk_cnt))){
+
+        if(sd_cache.cfg.write_back)
+            sd_cache.stats.bypass += blk_cnt;
+
+        if(sd_cache_direct(1, sector, blk_cnt, src) != SD_DRV_STATUS_OK)
+            return SD_DRV_STATUS_WR_ERR;
+
+        /* keep cached copies in step with the card */
+        for(i = 0; i < blk_cnt; i++){
+            idx = sd_cache_find(sector + i);
+            if(idx == SD_CACHE_LINE_NONE)
+                continue;
+
+            /* the read-ahead would land older data */
+            if(sd_cache_wait(idx) != SD_DRV_STATUS_OK){
+                lines[idx].flags |= SD_CACHE_LINE_STALE;
+                continue;
+            }
+
+            if(lines[idx].flags & SD_CACHE_LINE_VALID){
+                memcpy(sd_cache_line_data(idx), src + (i * SDMMC_BLK_SIZE_512_Msk), SDMMC_BLK_SIZE_512_Msk);
+                lines[idx].flags &= ~SD_CACHE_LINE_DIRTY;
+            }
+        }
+
+        return SD_DRV_STATUS_OK;
+    }
+
+    for(i = 0; i < blk_cnt; i++){
+
+        idx = sd_cache_find(sector + i);
+
+        if(idx != SD_CACHE_LINE_NONE){
+            /* a read-ahead landing later would overwrite the new data */
+            if(sd_cache_wait(idx) != SD_DRV_STATUS_OK)
+                return SD_DRV_STATUS_TIMEOUT_ERR;
+            if(!(lines[idx].flags & SD_CACHE_LINE_VALID))
+                idx = SD_CACHE_LINE_NONE;
+        }
+
+        if(idx == SD_CACHE_LINE_NONE){
+
+            idx = sd_cache_alloc();
+
+            if(idx == SD_CACHE_LINE_NONE){
+                /* no line to spare, write through */
+                if(sd_cache_direct(1, sector + i, 1, src + (i * SDMMC_BLK_SIZE_512_Msk)) != SD_DRV_STATUS_OK)
+                    return SD_DRV_STATUS_WR_ERR;
+                continue;
+            }
+
+            lines[idx].sector = sector + i;
+            sd_cache_hash_insert(idx);
+        }
+
+        memcpy(sd_cache_line_data(idx), src + (i * SDMMC_BLK_SIZE_512_Msk), SDMMC_BLK_SIZE_512_Msk);
+        lines[idx].flags = SD_CACHE_LINE_VALID | SD_CACHE_LINE_DIRTY;
+        sd_cache_touch(idx);
+    }
+
+    return SD_DRV_STATUS_OK;
+}
+
+/**
+  \fn           SD_DRV_STATUS sd_cache_flush(void)
+  \brief        write all dirty lines back to the card
+  \return       sd driver status
+  */
+SD_DRV_STATUS sd_cache_flush(void){
+
+    if(!sd_cache.ready)
+        return SD_DRV_STATUS_WR_ERR;
+
+#ifdef SDMMC_IRQ_MODE
+    sd_cache_ra_poll();
+#endif
+
+    return sd_cache_flush_range(0, ~0U);
+}
+
+/**
+  \fn           void sd_cache_invalidate(void)
+  \brief        empty the cache, e.g. after a card change. Dirty data is
+                lost, call sd_cache_flush() before.
+  \return       none
+  */
+void sd_cache_invalidate(void){
+
+    uint16_t idx;
+#ifdef SDMMC_IRQ_MODE
+    uint32_t slot;
+#endif
+
+    if(!sd_cache.ready)
+        return;
+
+#ifdef SDMMC_IRQ_MODE
+    for(slot = 0; slot < SD_CACHE_RA_MAX; slot++){
+        if(sd_cache.ra_line[slot] != SD_CACHE_LINE_NONE)
+            (void) sd_cache_wait(sd_cache.ra_line[slot]);
+    }
+#endif
+
+    /* lines of timed out read-aheads are dropped once they land */
+    for(idx = 0; idx < sd_cache.cfg.num_lines; idx++)
+        sd_cache.cfg.lines[idx].flags = (sd_cache.cfg.lines[idx].flags & SD_CACHE_LINE_PENDING) ?
+                                        (SD_CACHE_LINE_PENDING | SD_CACHE_LINE_STALE) : 0;
+
+    for(idx = 0; idx < SD_CACHE_HASH_SIZE; idx++)
+        sd_cache.hash[idx] = SD_CACHE_LINE_NONE;
+
+    sd_cache.seq_next = ~0U;
+    sd_cache.seq_cnt  = 0;
+}
+
+/**
+  \fn           void sd_cache_get_stats(sd_cache_stats_t *stats)
+  \brief        get the cache counters, e.g. to work out the hit rate of a
+                filesystem workload
+  \param[out]   stats - counters
+  \return       none
+  */
+void sd_cache_get_stats(sd_cache_stats_t *stats){
+
+    if(stats)
+        *stats = sd_cache.stats;
+}
+
+/**
+  \fn           static SD_DRV_STATUS sd_cache_disk_read(uint32_t sector, uint16_t blk_cnt, volatile uint8_t *buff)
+  \brief        disk_read entry of SD_Cache_Driver
+  \param[in]    sector - first sector
+  \param[in]    blk_cnt - number of sectors
+  \param[out]   buff - destination buffer
+  \return       sd driver status
+  */
+static SD_DRV_STATUS sd_cache_disk_read(uint32_t sector, uint16_t blk_cnt, volatile uint8_t *buff){
+    return sd_cache_read(sector, blk_cnt, buff);
+}
+
+/**
+  \fn           static SD_DRV_STATUS sd_cache_disk_uninit(uint8_t devId)
+  \brief        disk_uninitialize entry of SD_Cache_Driver, the cache is
+                flushed and emptied before the card goes away
+  \param[in]    devId - SD device id
+  \return       sd driver status
+  */
+static SD_DRV_STATUS sd_cache_disk_uninit(uint8_t devId){
+
+    SD_DRV_STATUS status = SD_DRV_STATUS_OK;
+
+    if(sd_cache.ready){
+        status = sd_cache_flush();
+        sd_cache_invalidate();
+    }
+
+    if(status != SD_DRV_STATUS_OK){
+        sd_uninit(devId);
+        return status;
+    }
+
+    return sd_uninit(devId);
+}
+
+/* Cached SD Driver Callback definitions, sd_cache_init() must be called first */
+const diskio_t SD_Cache_Driver =
+{
+    sd_init,
+    sd_cache_disk_uninit,
+    sd_state,
+    sd_cache_disk_read,
+    sd_cache_write,
+#ifdef SDMMC_IRQ_MODE
+    NULL
+#endif
+};
@@ -27,7 +27,7 @@
 #include "stdio.h"
 #endif
 extern sd_handle_t Hsd;
-static adma2_desc_t adma_desc_tbl[32] __attribute__((section("sd_dma_buf"))) __attribute__((aligned(32)));
+static adma2_desc_t adma_desc_tbl[SDMMC_ADMA2_DESC_TBL_CNT][SDMMC_ADMA2_DESC_TBL_LEN] __attribute__((section("sd_dma_buf"))) __attribute__((aligned(32)));
 
 static volatile uint8_t CardInserted = 0;
 static volatile uint16_t nis,eis,cc;
@@ -56,6 +56,13 @@ void SDMMC_IRQHandler(void){
         Hsd.regs->SDMMC_NORMAL_INT_STAT_R = nis;
     }
 
+    /* Data phase of a queued block request is over */
+    if(Hsd.queue.data_phase && (eis || (nis & SDMMC_INTR_TC_Msk))){
+        Hsd.queue.data_phase = 0;
+        sd_queue_xfer_done(&Hsd, eis ? SDMMC_HC_STATUS_ERR : SDMMC_HC_STATUS_OK);
+        return;
+    }
+
     switch(nis){
         case SDMMC_INTR_CC_Msk:
             cc = 1;
@@ -188,7 +195,16 @@ SDMMC_HC_STATUS hc_send_cmd(sd_handle_t *pHsd, sd_cmd_t *pCmd){
     cc = pHsd->regs->SDMMC_NORMAL_INT_STAT_R & SDMMC_INTR_CC_Msk;
 #endif
 
+#ifdef SDMMC_IRQ_MODE
+    /* Poll the status as well, for commands sent while the SDMMC IRQ can not
+     * run, i.e. queued block requests started from the IRQ handler */
+    while( timeout_cnt-- && (!cc) ){
+        if(pHsd->regs->SDMMC_NORMAL_INT_STAT_R & SDMMC_INTR_CC_Msk)
+            cc = 1;
+    }
+#else
     while( timeout_cnt-- && (!cc) );
+#endif
 
 #ifdef SDMMC_PRINTF_DEBUG
     printf("CMD: 0x%04x, ARG: 0x%08x, XFER: 0x%04x Resp01: %08x, Resp23: %08x, Resp45: %08x, Resp67: %08x cc:%d\n",
@@ -912,6 +928,7 @@ SDMMC_HC_STATUS hc_set_blk_cnt(sd_handle_t *pHsd, uint32_t BlkCnt){
 
     if(hc_send_cmd(pHsd, &pHsd->sd_cmd) != SDMMC_HC_STATUS_OK){
         sd_error_handler();
+        return SDMMC_HC_STATUS_ERR;
     }
 
     pHsd->regs->SDMMC_BLOCKCOUNT_R = BlkCnt;
@@ -920,66 +937,149 @@ SDMMC_HC_STATUS hc_set_blk_cnt(sd_handle_t *pHsd, uint32_t BlkCnt){
 }
 
 /**
-  \fn           SDMMC_HC_STATUS hc_dma_config(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t BlkCnt){
-  \brief        Setup read parameter and start reading sector
-  \param[in]    Global sd Handle pointer
-  \param[in]    destination buffer
-  \param[in]    sector number to read
-  \param[in]    Block Count
+  \fn           static SDMMC_HC_STATUS hc_adma2_build(const adma2_seg_t *segs, uint32_t nsegs)
+  \brief        Build the ADMA2 descriptor chain for a list of buffer segments.
+                Segments longer than one descriptor are split, and when a table
+                is full its last entry links to the next table of the pool.
+  \param[in]    segs - buffer segments
+  \param[in]    nsegs - number of segments
   \return       Host controller driver status
   */
-SDMMC_HC_STATUS hc_dma_config(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t blk_cnt){
+static SDMMC_HC_STATUS hc_adma2_build(const adma2_seg_t *segs, uint32_t nsegs){
 
-    ARG_UNUSED(sector);
-    hc_set_blk_cnt(pHsd, blk_cnt);
+    adma2_desc_t *desc = NULL;
+    uint32_t tbl = 0, idx = 0, seg;
+    uint32_t addr, len, chunk;
 
-    /* Configure DMA buffer */
-    if(pHsd->dma_mode == SDMMC_HOST_CTRL1_ADMA2_MODE){
+    for(seg = 0; seg < nsegs; seg++){
+
+        /* 32-bit ADMA2 needs word aligned addresses and lengths */
+        if((segs[seg].len == 0) || (segs[seg].addr & 0x3U) || (segs[seg].len & 0x3U))
+            return SDMMC_HC_STATUS_ERR;
 
-        uint32_t desc_num = 0;
-        uint32_t total_desc = 0, bytes_per_desc;
+        addr = LocalToGlobal((const volatile void *)segs[seg].addr);
+        len  = segs[seg].len;
 
-        bytes_per_desc = blk_cnt * SDMMC_BLK_SIZE_512_Msk;
+        while(len){
 
-        if(bytes_per_desc > SDMMC_ADMA2_DESC_MAX_LEN){
+            if(idx == (SDMMC_ADMA2_DESC_TBL_LEN - 1)){
 
-            total_desc = bytes_per_desc / SDMMC_ADMA2_DESC_MAX_LEN;
-            if(bytes_per_desc % SDMMC_ADMA2_DESC_MAX_LEN)
-                total_desc += 1;
+                if((tbl + 1) == SDMMC_ADMA2_DESC_TBL_CNT)
+                    return SDMMC_HC_STATUS_ERR;
+
+                adma_desc_tbl[tbl][idx].addr = LocalToGlobal(&adma_desc_tbl[tbl + 1][0]);
+                adma_desc_tbl[tbl][idx].len  = 0;
+                adma_desc_tbl[tbl][idx].attr = SDMMC_ADMA2_DESC_LINK | SDMMC_ADMA2_DESC_VALID;
+                tbl++;
+                idx = 0;
+            }
+
+            chunk = (len > SDMMC_ADMA2_DESC_MAX_LEN) ? SDMMC_ADMA2_DESC_MAX_LEN : len;
+
+            desc = &adma_desc_tbl[tbl][idx++];
+            desc->addr = addr;
+            desc->len  = (uint16_t)chunk;   /* 0 stands for 65536 bytes */
+            desc->attr = SDMMC_ADMA2_DESC_TRAN | SDMMC_ADMA2_DESC_VALID;
+
+            addr += chunk;
+            len  -= chunk;
         }
+    }
 
-        do{
-            adma_desc_tbl[desc_num].addr = buff + (desc_num * SDMMC_ADMA2_DESC_MAX_LEN);
-            adma_desc_tbl[desc_num].len  = bytes_per_desc;
-            adma_desc_tbl[desc_num].attr = SDMMC_ADMA2_DESC_TRAN | SDMMC_ADMA2_DESC_VALID;
-        }while(desc_num++ < total_desc);
+    if(desc == NULL)
+        return SDMMC_HC_STATUS_ERR;
+
+    desc->attr |= SDMMC_ADMA2_DESC_END;
+
+    RTSS_CleanDCache_by_Addr(adma_desc_tbl, ((tbl * SDMMC_ADMA2_DESC_TBL_LEN) + idx) * sizeof(adma2_desc_t));
 
-        adma_desc_tbl[desc_num - 1].attr |= SDMMC_ADMA2_DESC_END;
 #ifdef SDMMC_PRINTF_DEBUG
-        printf("ADMA Desc: 0x%x, addr: 0x%x, Len: 0x%x, Attr: 0x%x\n",(uint32_t)&adma_desc_tbl[0],adma_desc_tbl[0].addr,adma_desc_tbl[0].len,adma_desc_tbl[0].attr);
+    printf("ADMA Desc: 0x%x, addr: 0x%x, Len: 0x%x, Attr: 0x%x, Tables: %u, Last: %u\n",(uint32_t)&adma_desc_tbl[0][0],
+            adma_desc_tbl[0][0].addr,adma_desc_tbl[0][0].len,adma_desc_tbl[0][0].attr,tbl + 1,idx);
 #endif
 
-        pHsd->regs->SDMMC_ADMA_SA_LOW_R = (uint32_t)LocalToGlobal((&adma_desc_tbl[0]));
+    return SDMMC_HC_STATUS_OK;
+}
+
+/**
+  \fn           SDMMC_HC_STATUS hc_dma_config_sg(sd_handle_t *pHsd, const adma2_seg_t *segs, uint32_t nsegs, uint16_t blk_cnt)
+  \brief        Setup the block count and the DMA for a scatter-gather buffer list
+  \param[in]    Global sd Handle pointer
+  \param[in]    buffer segments, multiple segments need ADMA2 mode
+  \param[in]    number of segments
+  \param[in]    Block Count, must match the total segment length
+  \return       Host controller driver status
+  */
+SDMMC_HC_STATUS hc_dma_config_sg(sd_handle_t *pHsd, const adma2_seg_t *segs, uint32_t nsegs, uint16_t blk_cnt){
+
+    uint32_t total = 0, seg;
+
+    if((segs == NULL) || (nsegs == 0))
+        return SDMMC_HC_STATUS_ERR;
+
+    for(seg = 0; seg < nsegs; seg++)
+        total += segs[seg].len;
+
+    if(total != (blk_cnt * SDMMC_BLK_SIZE_512_Msk))
+        return SDMMC_HC_STATUS_ERR;
+
+    /* Configure DMA buffer */
+    if(pHsd->dma_mode == SDMMC_HOST_CTRL1_ADMA2_MODE){
+
+        if(hc_adma2_build(segs, nsegs) != SDMMC_HC_STATUS_OK)
+            return SDMMC_HC_STATUS_ERR;
     }
+    else if(nsegs != 1){
+        /* SDMA takes one contiguous buffer */
+        return SDMMC_HC_STATUS_ERR;
+    }
+
+    if(hc_set_blk_cnt(pHsd, blk_cnt) != SDMMC_HC_STATUS_OK)
+        return SDMMC_HC_STATUS_ERR;
 
+    if(pHsd->dma_mode == SDMMC_HOST_CTRL1_ADMA2_MODE)
+        pHsd->regs->SDMMC_ADMA_SA_LOW_R = (uint32_t)LocalToGlobal((&adma_desc_tbl[0][0]));
     else
-        pHsd->regs->SDMMC_ADMA_SA_LOW_R = (uint32_t)LocalToGlobal((const volatile void*)buff);
+        pHsd->regs->SDMMC_ADMA_SA_LOW_R = (uint32_t)LocalToGlobal((const volatile void*)segs[0].addr);
 
     return SDMMC_HC_STATUS_OK;
 }
 
 /**
-  \fn           SDMMC_HC_STATUS hc_read_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t BlkCnt){
+  \fn           SDMMC_HC_STATUS hc_dma_config(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t BlkCnt){
+  \brief        Setup the block count and the DMA for one contiguous buffer
+  \param[in]    Global sd Handle pointer
+  \param[in]    data buffer
+  \param[in]    sector number
+  \param[in]    Block Count
+  \return       Host controller driver status
+  */
+SDMMC_HC_STATUS hc_dma_config(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t blk_cnt){
+
+    adma2_seg_t seg;
+
+    ARG_UNUSED(sector);
+
+    seg.addr = buff;
+    seg.len  = blk_cnt * SDMMC_BLK_SIZE_512_Msk;
+
+    return hc_dma_config_sg(pHsd, &seg, 1, blk_cnt);
+}
+
+/**
+  \fn           SDMMC_HC_STATUS hc_read_setup_sg(sd_handle_t *pHsd, const adma2_seg_t *segs, uint32_t nsegs, uint32_t sector, uint16_t BlkCnt){
   \brief        Setup read parameter and start reading sector
   \param[in]    Global sd Handle pointer
-  \param[in]    destination buffer
+  \param[in]    destination buffer segments
+  \param[in]    number of segments
   \param[in]    sector number to read
   \param[in]    Block Count
   \return       Host controller driver status
   */
-SDMMC_HC_STATUS hc_read_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t BlkCnt){
+SDMMC_HC_STATUS hc_read_setup_sg(sd_handle_t *pHsd, const adma2_seg_t *segs, uint32_t nsegs, uint32_t sector, uint16_t BlkCnt){
 
-    hc_dma_config(pHsd, buff, sector, BlkCnt);
+    if(hc_dma_config_sg(pHsd, segs, nsegs, BlkCnt) != SDMMC_HC_STATUS_OK)
+        return SDMMC_HC_STATUS_ERR;
 
     pHsd->sd_cmd.arg              = sector;
     pHsd->sd_cmd.data_present     = 1;
@@ -1002,6 +1102,8 @@ SDMMC_HC_STATUS hc_read_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector,
 
     if(hc_send_cmd(pHsd, &pHsd->sd_cmd) != SDMMC_HC_STATUS_OK){
         sd_error_handler();
+        pHsd->sd_cmd.data_present = 0;
+        return SDMMC_HC_STATUS_ERR;
     }
 
     pHsd->sd_cmd.data_present = 0;
@@ -1010,17 +1112,38 @@ SDMMC_HC_STATUS hc_read_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector,
 }
 
 /**
-  \fn           SDMMC_HC_STATUS hc_write_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t BlkCnt)
+  \fn           SDMMC_HC_STATUS hc_read_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t BlkCnt)
+  \brief        Setup read parameter and start reading sector from one contiguous buffer
+  \param[in]    Global sd Handle pointer
+  \param[in]    destination buffer
+  \param[in]    sector number to read
+  \param[in]    Block Count
+  \return       Host controller driver status
+  */
+SDMMC_HC_STATUS hc_read_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t BlkCnt){
+
+    adma2_seg_t seg;
+
+    seg.addr = buff;
+    seg.len  = BlkCnt * SDMMC_BLK_SIZE_512_Msk;
+
+    return hc_read_setup_sg(pHsd, &seg, 1, sector, BlkCnt);
+}
+
+/**
+  \fn           SDMMC_HC_STATUS hc_write_setup_sg(sd_handle_t *pHsd, const adma2_seg_t *segs, uint32_t nsegs, uint32_t sector, uint16_t BlkCnt)
   \brief        Setup write parameter and start writing sector
   \param[in]    Global sd Handle pointer
-  \param[in]    source buffer
+  \param[in]    source buffer segments
+  \param[in]    number of segments
   \param[in]    sector number to write
   \param[in]    Block Count
   \return       Host controller driver status
   */
-SDMMC_HC_STATUS hc_write_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t BlkCnt){
+SDMMC_HC_STATUS hc_write_setup_sg(sd_handle_t *pHsd, const adma2_seg_t *segs, uint32_t nsegs, uint32_t sector, uint16_t BlkCnt){
 
-    hc_dma_config(pHsd, buff, sector, BlkCnt);
+    if(hc_dma_config_sg(pHsd, segs, nsegs, BlkCnt) != SDMMC_HC_STATUS_OK)
+        return SDMMC_HC_STATUS_ERR;
 
     pHsd->sd_cmd.arg              = sector;
     pHsd->sd_cmd.data_present     = 1;
@@ -1041,6 +1164,8 @@ SDMMC_HC_STATUS hc_write_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector
 
     if(hc_send_cmd(pHsd, &pHsd->sd_cmd) != SDMMC_HC_STATUS_OK){
         sd_error_handler();
+        pHsd->sd_cmd.data_present = 0;
+        return SDMMC_HC_STATUS_ERR;
     }
 
     pHsd->sd_cmd.data_present = 0;
@@ -1048,6 +1173,25 @@ SDMMC_HC_STATUS hc_write_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector
     return SDMMC_HC_STATUS_OK;
 }
 
+/**
+  \fn           SDMMC_HC_STATUS hc_write_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t BlkCnt)
+  \brief        Setup write parameter and start writing sector from one contiguous buffer
+  \param[in]    Global sd Handle pointer
+  \param[in]    source buffer
+  \param[in]    sector number to write
+  \param[in]    Block Count
+  \return       Host controller driver status
+  */
+SDMMC_HC_STATUS hc_write_setup(sd_handle_t *pHsd, uint32_t buff, uint32_t sector, uint16_t BlkCnt){
+
+    adma2_seg_t seg;
+
+    seg.addr = buff;
+    seg.len  = BlkCnt * SDMMC_BLK_SIZE_512_Msk;
+
+    return hc_write_setup_sg(pHsd, &seg, 1, sector, BlkCnt);
+}
+
 /**
   \fn           SDMMC_HC_STATUS hc_check_xfer_done(sd_handle_t *pHsd, uint32_t timeout_cnt)
   \brief        Check for transfer complete
@@ -1169,6 +1169,176 @@ void lpspi_dma_transfer(SPI_Type *lpspi)
                       SPI_IMR_MULTI_MASTER_CONTENTION_INTERRUPT_MASK);
 }
 
+/**
+  \fn          static void spi_tx_fill_8(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+  \brief       Write count 8-bit frames from the Tx buffer to the FIFO.
+  \param[in]   spi       Pointer to the SPI register map
+  \param[in]   transfer  Pointer to transfer structure
+  \param[in]   count     Number of frames
+  \return      none
+*/
+static void spi_tx_fill_8(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+{
+    const uint8_t *buff = transfer->tx_buff;
+
+    while (count--)
+    {
+        spi->SPI_DR[0] = *buff++;
+    }
+
+    transfer->tx_buff = buff;
+}
+
+/**
+  \fn          static void spi_tx_fill_16(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+  \brief       Write count 16-bit frames from the (2 byte aligned) Tx buffer to the FIFO.
+  \param[in]   spi       Pointer to the SPI register map
+  \param[in]   transfer  Pointer to transfer structure
+  \param[in]   count     Number of frames
+  \return      none
+*/
+static void spi_tx_fill_16(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+{
+    const uint16_t *buff = (const uint16_t *) transfer->tx_buff;
+
+    while (count--)
+    {
+        spi->SPI_DR[0] = *buff++;
+    }
+
+    transfer->tx_buff = (const uint8_t *) buff;
+}
+
+/**
+  \fn          static void spi_tx_fill_32(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+  \brief       Write count 32-bit frames from the (4 byte aligned) Tx buffer to the FIFO.
+  \param[in]   spi       Pointer to the SPI register map
+  \param[in]   transfer  Pointer to transfer structure
+  \param[in]   count     Number of frames
+  \return      none
+*/
+static void spi_tx_fill_32(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+{
+    const uint32_t *buff = (const uint32_t *) transfer->tx_buff;
+
+    while (count--)
+    {
+        spi->SPI_DR[0] = *buff++;
+    }
+
+    transfer->tx_buff = (const uint8_t *) buff;
+}
+
+/**
+  \fn          static void spi_tx_fill_default(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+  \brief       Write count frames of the default Tx value (or 0) to the FIFO.
+  \param[in]   spi       Pointer to the SPI register map
+  \param[in]   transfer  Pointer to transfer structure
+  \param[in]   count     Number of frames
+  \return      none
+*/
+static void spi_tx_fill_default(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+{
+    uint32_t tx_data = transfer->tx_default_enable ? transfer->tx_default_val : 0U;
+
+    while (count--)
+    {
+        spi->SPI_DR[0] = tx_data;
+    }
+}
+
+/**
+  \fn          static void spi_rx_drain_8(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+  \brief       Read count 8-bit frames from the FIFO to the Rx buffer.
+  \param[in]   spi       Pointer to the SPI register map
+  \param[in]   transfer  Pointer to transfer structure
+  \param[in]   count     Number of frames
+  \return      none
+*/
+static void spi_rx_drain_8(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+{
+    uint8_t *buff = (uint8_t *) transfer->rx_buff;
+
+    while (count--)
+    {
+        *buff++ = (uint8_t) spi->SPI_DR[0];
+    }
+
+    transfer->rx_buff = buff;
+}
+
+/**
+  \fn          static void spi_rx_drain_16(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+  \brief       Read count 16-bit frames from the FIFO to the (2 byte aligned) Rx buffer.
+  \param[in]   spi       Pointer to the SPI register map
+  \param[in]   transfer  Pointer to transfer structure
+  \param[in]   count     Number of frames
+  \return      none
+*/
+static void spi_rx_drain_16(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+{
+    uint16_t *buff = (uint16_t *) transfer->rx_buff;
+
+    while (count--)
+    {
+        *buff++ = (uint16_t) spi->SPI_DR[0];
+    }
+
+    transfer->rx_buff = buff;
+}
+
+/**
+  \fn          static void spi_rx_drain_32(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+  \brief       Read count 32-bit frames from the FIFO to the (4 byte aligned) Rx buffer.
+  \param[in]   spi       Pointer to the SPI register map
+  \param[in]   transfer  Pointer to transfer structure
+  \param[in]   count     Number of frames
+  \return      none
+*/
+static void spi_rx_drain_32(SPI_Type *spi, spi_transfer_t *transfer, uint32_t count)
+{
+    uint32_t *buff = (uint32_t *) transfer->rx_buff;
+
+    while (count--)
+    {
+        *buff++ = spi->SPI_DR[0];
+    }
+
+    transfer->rx_buff = buff;
+}
+
+/**
+  \fn          void spi_set_fifo_handlers(spi_transfer_t *transfer)
+  \brief       Select the FIFO fill and drain routines used by spi_irq_handler
+               for the transfer, from its frame size and Tx buffer. To be
+               called once the transfer structure is set up.
+  \param[in]   transfer  Pointer to transfer structure
+  \return      none
+*/
+void spi_set_fifo_handlers(spi_transfer_t *transfer)
+{
+    if (transfer->frame_size > 16)
+    {
+        transfer->tx_fill  = spi_tx_fill_32;
+        transfer->rx_drain = spi_rx_drain_32;
+    }
+    else if (transfer->frame_size > 8)
+    {
+        transfer->tx_fill  = spi_tx_fill_16;
+        transfer->rx_drain = spi_rx_drain_16;
+    }
+    else
+    {
+        transfer->tx_fill  = spi_tx_fill_8;
+        transfer->rx_drain = spi_rx_drain_8;
+    }
+
+    if (transfer->tx_buff == NULL)
+    {
+        transfer->tx_fill = spi_tx_fill_default;
+    }
+}
+
 /**
   \fn          void spi_irq_handler(SPI_Type *spi, spi_master_transfer_t *transfer)
   \brief       Handle interrupts for the SPI instance.
@@ -1196,6 +1366,13 @@ void spi_irq_handler(SPI_Type *spi, spi_transfer_t *transfer)
             tx_count = (transfer->tx_total_cnt - transfer->tx_current_cnt);
         }
 
+        if (transfer->tx_fill)
+        {
+            transfer->tx_fill(spi, transfer, tx_count);
+            transfer->tx_current_cnt += tx_count;
+            tx_count = 0;
+        }
+
         for (index = 0; index < tx_count; index++)
         {
             tx_data = 0;
@@ -1235,7 +1412,12 @@ void spi_irq_handler(SPI_Type *spi, spi_transfer_t *transfer)
     {
         rx_count = spi->SPI_RXFLR;
 
-        if (transfer->frame_size > 16)
+        if (transfer->rx_drain)
+        {
+            transfer->rx_drain(spi, transfer, rx_count);
+            transfer->rx_current_cnt += rx_count;
+        }
+        else if (transfer->frame_size > 16)
         {
             for (index = 0; index < rx_count; index++)
             {